@@ -0,0 +1,64 @@
+#ifndef BOOST_ARCHIVE_ARCHIVE_STATS_HPP
+#define BOOST_ARCHIVE_ARCHIVE_STATS_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// archive/archive_stats.hpp:
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef> // size_t
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{ 
+    using ::size_t; 
+} // namespace std
+#endif
+
+namespace boost {
+namespace archive {
+
+//////////////////////////////////////////////////////////////////////
+// counters maintained by every archive.  Useful for seeing where the
+// time goes when serializing large object graphs.
+struct archive_stats
+{
+    // objects serialized other than through a pointer
+    std::size_t objects;
+    // non-null pointers serialized
+    std::size_t pointers;
+    // distinct objects entered in the object tracking table
+    std::size_t tracked_objects;
+    // tracked objects or pointers found to be already serialized
+    std::size_t object_references;
+    // distinct classes registered with the archive
+    std::size_t classes;
+    // lookups of the class information of an object or pointer
+    std::size_t class_lookups;
+    // class lookups which couldn't be satisfied from the archive's cache
+    std::size_t class_lookup_misses;
+
+    archive_stats() :
+        objects(0),
+        pointers(0),
+        tracked_objects(0),
+        object_references(0),
+        classes(0),
+        class_lookups(0),
+        class_lookup_misses(0)
+    {}
+};
+
+} // namespace archive
+} // namespace boost
+
+#endif //BOOST_ARCHIVE_ARCHIVE_STATS_HPP
@@ -0,0 +1,208 @@
+#ifndef BOOST_ARCHIVE_BASIC_BINARY_MEMORY_IPRIMITIVE_HPP
+#define BOOST_ARCHIVE_BASIC_BINARY_MEMORY_IPRIMITIVE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning( disable : 4800 )
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// basic_binary_memory_iprimitive.hpp
+//
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+// native binary input read in place from a contiguous block of memory,
+// for instance a memory mapped file, rather than through a
+// std::streambuf.  The format is the same as that of
+// basic_binary_iprimitive.
+
+// IN GENERAL, ARCHIVES CREATED WITH THIS CLASS WILL NOT BE READABLE
+// ON PLATFORM APART FROM THE ONE THEY ARE CREATE ON
+
+#include <boost/assert.hpp>
+#include <string>
+#include <cstddef> // size_t, NULL
+#include <cstring> // memcpy
+
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::memcpy;
+    using ::size_t;
+} // namespace std
+#endif
+
+#include <boost/serialization/throw_exception.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/array_view.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/archive/detail/auto_link_archive.hpp>
+#include <boost/archive/detail/abi_prefix.hpp> // must be the last header
+
+namespace boost {
+namespace archive {
+
+/////////////////////////////////////////////////////////////////////////////
+// class basic_binary_memory_iprimitive - read primitives from memory
+template<class Archive>
+class basic_binary_memory_iprimitive
+{
+#ifndef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+    friend class load_access;
+protected:
+#else
+public:
+#endif
+    const char * m_begin;
+    const char * m_pos;
+    const char * m_end;
+
+    // the part of the std::streambuf interface used by
+    // basic_binary_iarchive::init to read the library version
+    class memory_buf {
+        const char * & m_pos;
+        const char * const & m_end;
+    public:
+        memory_buf(const char * & pos, const char * const & end) :
+            m_pos(pos),
+            m_end(end)
+        {}
+        int sgetc() const {
+            if(m_pos == m_end)
+                return std::char_traits<char>::eof();
+            return std::char_traits<char>::to_int_type(* m_pos);
+        }
+        int sbumpc(){
+            const int c = sgetc();
+            if(m_pos != m_end)
+                ++m_pos;
+            return c;
+        }
+    } m_sb;
+
+    // return a pointer to the most derived class
+    Archive * This(){
+        return static_cast<Archive *>(this);
+    }
+
+    // main template for serilization of primitive types
+    template<class T>
+    void load(T & t){
+        load_binary(& t, sizeof(T));
+    }
+
+    /////////////////////////////////////////////////////////
+    // fundamental types that need special treatment
+
+    // trap usage of invalid uninitialized boolean
+    void load(bool & t){
+        load_binary(& t, sizeof(t));
+        int i = t;
+        BOOST_ASSERT(0 == i || 1 == i);
+        (void)i; // warning suppression for release builds.
+    }
+    BOOST_ARCHIVE_DECL(void)
+    load(std::string &s);
+    #ifndef BOOST_NO_STD_WSTRING
+    BOOST_ARCHIVE_DECL(void)
+    load(std::wstring &ws);
+    #endif
+    BOOST_ARCHIVE_DECL(void)
+    load(char * t);
+    BOOST_ARCHIVE_DECL(void)
+    load(wchar_t * t);
+
+    BOOST_ARCHIVE_DECL(void)
+    init();
+
+    // return the address of count elements of the given size, aligned
+    // to alignment from the start of the archive, and skip past them.
+    // Nothing is copied.
+    BOOST_ARCHIVE_DECL(const void *)
+    load_in_place(
+        std::size_t count,
+        std::size_t size,
+        std::size_t alignment
+    );
+
+    BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+    basic_binary_memory_iprimitive(const void * address, std::size_t size);
+public:
+    // we provide an optimized load for all fundamental types
+    // typedef serialization::is_bitwise_serializable<mpl::_1>
+    // use_array_optimization;
+    struct use_array_optimization {
+        template <class T>
+        #if defined(BOOST_NO_DEPENDENT_NESTED_DERIVATIONS)
+            struct apply {
+                typedef BOOST_DEDUCED_TYPENAME boost::serialization::is_bitwise_serializable< T >::type type;
+            };
+        #else
+            struct apply : public boost::serialization::is_bitwise_serializable< T > {};
+        #endif
+    };
+
+    // the optimized load_array dispatches to load_binary
+    template <class ValueType>
+    void load_array(serialization::array<ValueType>& a, unsigned int)
+    {
+      load_binary(a.address(),a.count()*sizeof(ValueType));
+    }
+
+    // views refer to the elements in the buffer instead of copying them
+    template <class ValueType>
+    void load_view(serialization::array_view<ValueType>& v, unsigned int)
+    {
+      boost::serialization::collection_size_type count;
+      * this->This() >> BOOST_SERIALIZATION_NVP(count);
+      const void * address = load_in_place(
+          count,
+          sizeof(ValueType),
+          boost::alignment_of<ValueType>::value
+      );
+      v.reset(static_cast<const ValueType *>(address), count);
+    }
+
+    void
+    load_binary(void *address, std::size_t count);
+
+    // number of bytes read so far
+    std::size_t size() const {
+        return static_cast<std::size_t>(m_pos - m_begin);
+    }
+};
+
+template<class Archive>
+inline void
+basic_binary_memory_iprimitive<Archive>::load_binary(
+    void *address,
+    std::size_t count
+){
+    if(static_cast<std::size_t>(m_end - m_pos) < count)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::input_stream_error)
+        );
+    std::memcpy(address, m_pos, count);
+    m_pos += count;
+}
+
+} // namespace archive
+} // namespace boost
+
+#include <boost/archive/detail/abi_suffix.hpp> // pop pragmas
+
+#endif // BOOST_ARCHIVE_BASIC_BINARY_MEMORY_IPRIMITIVE_HPP
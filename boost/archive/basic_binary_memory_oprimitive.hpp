@@ -0,0 +1,192 @@
+#ifndef BOOST_ARCHIVE_BASIC_BINARY_MEMORY_OPRIMITIVE_HPP
+#define BOOST_ARCHIVE_BASIC_BINARY_MEMORY_OPRIMITIVE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// basic_binary_memory_oprimitive.hpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+// native binary output written directly into a contiguous block of
+// memory rather than through a std::streambuf.  The format is the same
+// as that of basic_binary_oprimitive.
+
+// IN GENERAL, ARCHIVES CREATED WITH THIS CLASS WILL NOT BE READABLE
+// ON PLATFORM APART FROM THE ONE THEY ARE CREATE ON
+
+#include <boost/assert.hpp>
+#include <string>
+#include <vector>
+#include <cstddef> // size_t
+#include <cstring> // memcpy
+
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::size_t;
+    using ::memcpy;
+} // namespace std
+#endif
+
+#include <boost/serialization/throw_exception.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/array_view.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/archive/detail/auto_link_archive.hpp>
+#include <boost/archive/detail/abi_prefix.hpp> // must be the last header
+
+namespace boost {
+namespace archive {
+
+/////////////////////////////////////////////////////////////////////////
+// class basic_binary_memory_oprimitive - binary output of prmitives to memory
+
+template<class Archive>
+class basic_binary_memory_oprimitive
+{
+#ifndef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+    friend class save_access;
+protected:
+#else
+public:
+#endif
+    // the vector grown as required, or NULL when writing to a fixed region
+    std::vector<char> * m_vector;
+    // offset in m_vector of the first byte of this archive
+    std::size_t m_offset;
+    char * m_begin;
+    char * m_pos;
+    char * m_end;
+
+    // return a pointer to the most derived class
+    Archive * This(){
+        return static_cast<Archive *>(this);
+    }
+    // default saving of primitives.
+    template<class T>
+    void save(const T & t)
+    {
+        save_binary(& t, sizeof(T));
+    }
+
+    /////////////////////////////////////////////////////////
+    // fundamental types that need special treatment
+
+    // trap usage of invalid uninitialized boolean which would
+    // otherwise crash on load.
+    void save(const bool t){
+        BOOST_ASSERT(0 == static_cast<int>(t) || 1 == static_cast<int>(t));
+        save_binary(& t, sizeof(t));
+    }
+    BOOST_ARCHIVE_DECL(void)
+    save(const std::string &s);
+    #ifndef BOOST_NO_STD_WSTRING
+    BOOST_ARCHIVE_DECL(void)
+    save(const std::wstring &ws);
+    #endif
+    BOOST_ARCHIVE_DECL(void)
+    save(const char * t);
+    BOOST_ARCHIVE_DECL(void)
+    save(const wchar_t * t);
+
+    BOOST_ARCHIVE_DECL(void)
+    init();
+
+    // make room for count more bytes, or throw if the region is fixed
+    BOOST_ARCHIVE_DECL(void)
+    grow(std::size_t count);
+
+    // pad with zeros so that the next byte is at a multiple of
+    // alignment from the start of the archive
+    void align(std::size_t alignment){
+        static const char zeros[16] = { 0 };
+        std::size_t pad = (alignment - size() % alignment) % alignment;
+        while(0 < pad){
+            std::size_t n = (pad < sizeof(zeros)) ? pad : sizeof(zeros);
+            save_binary(zeros, n);
+            pad -= n;
+        }
+    }
+
+    BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+    basic_binary_memory_oprimitive(std::vector<char> & v);
+    BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+    basic_binary_memory_oprimitive(void * address, std::size_t size);
+    BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+    ~basic_binary_memory_oprimitive();
+public:
+
+    // we provide an optimized save for all fundamental types
+    // typedef serialization::is_bitwise_serializable<mpl::_1>
+    // use_array_optimization;
+    // workaround without using mpl lambdas
+    struct use_array_optimization {
+        template <class T>
+        #if defined(BOOST_NO_DEPENDENT_NESTED_DERIVATIONS)
+            struct apply {
+                typedef BOOST_DEDUCED_TYPENAME boost::serialization::is_bitwise_serializable< T >::type type;
+            };
+        #else
+            struct apply : public boost::serialization::is_bitwise_serializable< T > {};
+        #endif
+    };
+
+    // the optimized save_array dispatches to save_binary
+    template <class ValueType>
+    void save_array(boost::serialization::array<ValueType> const& a, unsigned int)
+    {
+      save_binary(a.address(),a.count()*sizeof(ValueType));
+    }
+
+    // views are written aligned to their element type so that
+    // basic_binary_memory_iprimitive can return them in place
+    template <class ValueType>
+    void save_view(boost::serialization::array_view<ValueType> const& v, unsigned int)
+    {
+      const boost::serialization::collection_size_type count(v.count());
+      * this->This() << BOOST_SERIALIZATION_NVP(count);
+      align(boost::alignment_of<ValueType>::value);
+      if(0 < v.count())
+          save_binary(v.address(), v.count()*sizeof(ValueType));
+    }
+
+    void save_binary(const void *address, std::size_t count);
+
+    // number of bytes written so far
+    std::size_t size() const {
+        return static_cast<std::size_t>(m_pos - m_begin);
+    }
+};
+
+template<class Archive>
+inline void
+basic_binary_memory_oprimitive<Archive>::save_binary(
+    const void *address,
+    std::size_t count
+){
+    if(static_cast<std::size_t>(m_end - m_pos) < count)
+        grow(count);
+    std::memcpy(m_pos, address, count);
+    m_pos += count;
+}
+
+} //namespace boost
+} //namespace archive
+
+#include <boost/archive/detail/abi_suffix.hpp> // pop pragmas
+
+#endif // BOOST_ARCHIVE_BASIC_BINARY_MEMORY_OPRIMITIVE_HPP
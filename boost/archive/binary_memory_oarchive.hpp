@@ -0,0 +1,136 @@
+#ifndef BOOST_ARCHIVE_BINARY_MEMORY_OARCHIVE_HPP
+#define BOOST_ARCHIVE_BINARY_MEMORY_OARCHIVE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// binary_memory_oarchive.hpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+#include <vector>
+#include <cstddef> // size_t
+#include <boost/config.hpp>
+#include <boost/serialization/pfto.hpp>
+#include <boost/archive/basic_binary_memory_oprimitive.hpp>
+#include <boost/archive/basic_binary_oarchive.hpp>
+#include <boost/archive/detail/register_archive.hpp>
+
+#ifdef BOOST_MSVC
+#  pragma warning(push)
+#  pragma warning(disable : 4511 4512)
+#endif
+
+namespace boost { 
+namespace archive {
+
+template<class Archive>
+class binary_memory_oarchive_impl : 
+    public basic_binary_memory_oprimitive<Archive>,
+    public basic_binary_oarchive<Archive>
+{
+#ifdef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+public:
+#else
+    friend class detail::interface_oarchive<Archive>;
+    friend class basic_binary_oarchive<Archive>;
+    friend class save_access;
+protected:
+#endif
+    // make this protected so it can be called from a derived archive
+    template<class T>
+    void save_override(T & t, BOOST_PFTO int){
+        this->basic_binary_oarchive<Archive>::save_override(t, 0L);
+    }
+    void init(unsigned int flags) {
+        if(0 != (flags & no_header))
+            return;
+        #if ! defined(__MWERKS__)
+            this->basic_binary_oarchive<Archive>::init();
+            this->basic_binary_memory_oprimitive<Archive>::init();
+        #else
+            basic_binary_oarchive<Archive>::init();
+            basic_binary_memory_oprimitive<Archive>::init();
+        #endif
+    }
+    binary_memory_oarchive_impl(
+        std::vector<char> & v, 
+        unsigned int flags
+    ) :
+        basic_binary_memory_oprimitive<Archive>(v),
+        basic_binary_oarchive<Archive>(flags)
+    {
+        init(flags);
+    }
+    binary_memory_oarchive_impl(
+        void * address,
+        std::size_t size,
+        unsigned int flags
+    ) :
+        basic_binary_memory_oprimitive<Archive>(address, size),
+        basic_binary_oarchive<Archive>(flags)
+    {
+        init(flags);
+    }
+};
+
+} // namespace archive
+} // namespace boost
+
+// note special treatment of shared_ptr. This type needs a special
+// structure associated with every archive.  We created a "mix-in"
+// class to provide this functionality.  Since shared_ptr holds a
+// special esteem in the boost library - we included it here by default.
+#include <boost/archive/shared_ptr_helper.hpp>
+
+namespace boost { 
+namespace archive {
+
+// do not derive from this class.  If you want to extend this functionality
+// via inhertance, derived from binary_memory_oarchive_impl instead.  This
+// will preserve correct static polymorphism.
+
+// Output is appended to the end of the vector, which is grown as required
+// and trimmed to the size of the archive when the archive is destroyed.
+// Alternatively output is written to a fixed region of memory such as a
+// writable memory mapped file, and archive_exception::output_stream_error
+// is thrown if the region is too small.
+class binary_memory_oarchive : 
+    public binary_memory_oarchive_impl<binary_memory_oarchive>,
+    public detail::shared_ptr_helper
+{
+public:
+    binary_memory_oarchive(std::vector<char> & v, unsigned int flags = 0) :
+        binary_memory_oarchive_impl<binary_memory_oarchive>(v, flags)
+    {}
+    binary_memory_oarchive(
+        void * address,
+        std::size_t size,
+        unsigned int flags = 0
+    ) :
+        binary_memory_oarchive_impl<binary_memory_oarchive>(
+            address, size, flags
+        )
+    {}
+};
+
+} // namespace archive
+} // namespace boost
+
+// required by export
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::binary_memory_oarchive)
+BOOST_SERIALIZATION_USE_ARRAY_OPTIMIZATION(boost::archive::binary_memory_oarchive)
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+#endif // BOOST_ARCHIVE_BINARY_MEMORY_OARCHIVE_HPP
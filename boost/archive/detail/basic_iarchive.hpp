@@ -25,6 +25,7 @@
 #include <boost/type_traits/broken_compiler_spec.hpp>
 #include <boost/serialization/tracking_enum.hpp>
 #include <boost/archive/basic_archive.hpp>
+#include <boost/archive/archive_stats.hpp>
 #include <boost/archive/detail/decl.hpp>
 #include <boost/archive/detail/abi_prefix.hpp> // must be the last header
 
@@ -89,6 +90,11 @@ public:
     get_library_version() const;
     unsigned int
     get_flags() const;
+    // make room in the object tracking table for this many objects
+    void
+    reserve(std::size_t object_count);
+    archive_stats
+    get_stats() const;
     void 
     reset_object_address(const void * new_address, const void * old_address);
     void 
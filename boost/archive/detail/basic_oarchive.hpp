@@ -26,6 +26,7 @@
 // #include <boost/scoped_ptr.hpp>
 
 #include <boost/archive/basic_archive.hpp>
+#include <boost/archive/archive_stats.hpp>
 #include <boost/serialization/tracking_enum.hpp>
 
 #include <boost/archive/detail/abi_prefix.hpp> // must be the last header
@@ -89,6 +90,9 @@ public:
     void end_preamble(); // default implementation does nothing
     library_version_type get_library_version() const;
     unsigned int get_flags() const;
+    // make room in the object tracking table for this many objects
+    void reserve(std::size_t object_count);
+    archive_stats get_stats() const;
 };
 
 } // namespace detail
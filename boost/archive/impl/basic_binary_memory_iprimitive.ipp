@@ -0,0 +1,187 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// basic_binary_memory_iprimitive.ipp:
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+#include <boost/assert.hpp>
+#include <cstddef> // size_t, NULL
+#include <cstring> // memcpy
+
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::size_t;
+    using ::memcpy;
+} // namespace std
+#endif
+
+#include <boost/detail/workaround.hpp> // fixup for RogueWave
+
+#include <boost/serialization/throw_exception.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_binary_memory_iprimitive.hpp>
+
+namespace boost {
+namespace archive {
+
+//////////////////////////////////////////////////////////////////////
+// implementation of basic_binary_memory_iprimitive
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_iprimitive<Archive>::init()
+{
+    // Detect  attempts to pass native binary archives across
+    // incompatible platforms. This is not fool proof but its
+    // better than nothing.
+    unsigned char size;
+    this->This()->load(size);
+    if(sizeof(int) != size)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "size of int"
+            )
+        );
+    this->This()->load(size);
+    if(sizeof(long) != size)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "size of long"
+            )
+        );
+    this->This()->load(size);
+    if(sizeof(float) != size)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "size of float"
+            )
+        );
+    this->This()->load(size);
+    if(sizeof(double) != size)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "size of double"
+            )
+        );
+
+    // for checking endian
+    int i;
+    this->This()->load(i);
+    if(1 != i)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "endian setting"
+            )
+        );
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_iprimitive<Archive>::load(wchar_t * ws)
+{
+    std::size_t l; // number of wchar_t !!!
+    this->This()->load(l);
+    load_binary(ws, l * sizeof(wchar_t) / sizeof(char));
+    ws[l] = L'\0';
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_iprimitive<Archive>::load(std::string & s)
+{
+    std::size_t l;
+    this->This()->load(l);
+    if(static_cast<std::size_t>(m_end - m_pos) < l)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::input_stream_error)
+        );
+    // construct the string directly from the buffer
+    s.assign(m_pos, l);
+    m_pos += l;
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_iprimitive<Archive>::load(char * s)
+{
+    std::size_t l;
+    this->This()->load(l);
+    load_binary(s, l);
+    s[l] = '\0';
+}
+
+#ifndef BOOST_NO_STD_WSTRING
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_iprimitive<Archive>::load(std::wstring & ws)
+{
+    std::size_t l;
+    this->This()->load(l);
+    // borland de-allocator fixup
+    #if BOOST_WORKAROUND(_RWSTD_VER, BOOST_TESTED_AT(20101))
+    if(NULL != ws.data())
+    #endif
+        ws.resize(l);
+    // note breaking a rule here - is could be a problem on some platform
+    if(0 < l)
+        load_binary(const_cast<wchar_t *>(ws.data()), l * sizeof(wchar_t) / sizeof(char));
+}
+#endif
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(const void *)
+basic_binary_memory_iprimitive<Archive>::load_in_place(
+    std::size_t count,
+    std::size_t size,
+    std::size_t alignment
+){
+    BOOST_ASSERT(0 < size && 0 < alignment);
+    // skip the padding inserted by basic_binary_memory_oprimitive::align
+    const std::size_t pad = (alignment - this->size() % alignment) % alignment;
+    if(static_cast<std::size_t>(m_end - m_pos) < pad)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::input_stream_error)
+        );
+    m_pos += pad;
+    if(static_cast<std::size_t>(m_end - m_pos) / size < count)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::input_stream_error)
+        );
+    // the data can only be used in place if the buffer itself is
+    // suitably aligned.
+    if(0 != reinterpret_cast<std::size_t>(m_pos) % alignment)
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::input_stream_error,
+                "misaligned archive buffer"
+            )
+        );
+    const void * address = m_pos;
+    m_pos += count * size;
+    return address;
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+basic_binary_memory_iprimitive<Archive>::basic_binary_memory_iprimitive(
+    const void * address,
+    std::size_t size
+) :
+    m_begin(static_cast<const char *>(address)),
+    m_pos(static_cast<const char *>(address)),
+    m_end(static_cast<const char *>(address) + size),
+    m_sb(m_pos, m_end)
+{}
+
+} // namespace archive
+} // namespace boost
@@ -0,0 +1,161 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// basic_binary_memory_oprimitive.ipp:
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef> // NULL
+#include <cstring>
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::strlen;
+} // namespace std
+#endif
+
+#ifndef BOOST_NO_CWCHAR
+#include <cwchar>
+#ifdef BOOST_NO_STDC_NAMESPACE
+namespace std{ using ::wcslen; }
+#endif
+#endif
+
+#include <boost/serialization/throw_exception.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_binary_memory_oprimitive.hpp>
+
+namespace boost {
+namespace archive {
+
+//////////////////////////////////////////////////////////////////////
+// implementation of basic_binary_memory_oprimitive
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::init()
+{
+    // record native sizes of fundamental types
+    // this is to permit detection of attempts to pass
+    // native binary archives accross incompatible machines.
+    // This is not foolproof but its better than nothing.
+    this->This()->save(static_cast<unsigned char>(sizeof(int)));
+    this->This()->save(static_cast<unsigned char>(sizeof(long)));
+    this->This()->save(static_cast<unsigned char>(sizeof(float)));
+    this->This()->save(static_cast<unsigned char>(sizeof(double)));
+    // for checking endianness
+    this->This()->save(int(1));
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::save(const char * s)
+{
+    std::size_t l = std::strlen(s);
+    this->This()->save(l);
+    save_binary(s, l);
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::save(const std::string &s)
+{
+    std::size_t l = static_cast<std::size_t>(s.size());
+    this->This()->save(l);
+    save_binary(s.data(), l);
+}
+
+#ifndef BOOST_NO_CWCHAR
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::save(const wchar_t * ws)
+{
+    std::size_t l = std::wcslen(ws);
+    this->This()->save(l);
+    save_binary(ws, l * sizeof(wchar_t) / sizeof(char));
+}
+#endif
+
+#ifndef BOOST_NO_STD_WSTRING
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::save(const std::wstring &ws)
+{
+    std::size_t l = ws.size();
+    this->This()->save(l);
+    save_binary(ws.data(), l * sizeof(wchar_t) / sizeof(char));
+}
+#endif
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+basic_binary_memory_oprimitive<Archive>::grow(std::size_t count)
+{
+    if(NULL == m_vector)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::output_stream_error)
+        );
+    const std::size_t used = size();
+    if(m_vector->max_size() - m_offset - used < count)
+        boost::serialization::throw_exception(
+            archive_exception(archive_exception::output_stream_error)
+        );
+    // grow geometrically so that the cost of resizing is amortized
+    std::size_t capacity = static_cast<std::size_t>(m_end - m_begin);
+    std::size_t new_capacity = capacity + capacity / 2;
+    if(new_capacity < used + count)
+        new_capacity = used + count;
+    if(new_capacity < 256)
+        new_capacity = 256;
+    if(m_vector->max_size() - m_offset < new_capacity)
+        new_capacity = m_vector->max_size() - m_offset;
+    m_vector->resize(m_offset + new_capacity);
+    m_begin = & (* m_vector)[0] + m_offset;
+    m_pos = m_begin + used;
+    m_end = m_begin + new_capacity;
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+basic_binary_memory_oprimitive<Archive>::basic_binary_memory_oprimitive(
+    std::vector<char> & v
+) :
+    m_vector(& v),
+    m_offset(v.size()),
+    m_begin(NULL),
+    m_pos(NULL),
+    m_end(NULL)
+{
+    grow(0);
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+basic_binary_memory_oprimitive<Archive>::basic_binary_memory_oprimitive(
+    void * address,
+    std::size_t size
+) :
+    m_vector(NULL),
+    m_offset(0),
+    m_begin(static_cast<char *>(address)),
+    m_pos(static_cast<char *>(address)),
+    m_end(static_cast<char *>(address) + size)
+{
+    BOOST_ASSERT(NULL != address);
+}
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(BOOST_PP_EMPTY())
+basic_binary_memory_oprimitive<Archive>::~basic_binary_memory_oprimitive(){
+    // trim the unused capacity from the vector. Shrinking never throws.
+    if(NULL != m_vector)
+        m_vector->resize(m_offset + size());
+}
+
+} // namespace archive
+} // namespace boost
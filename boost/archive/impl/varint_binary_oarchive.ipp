@@ -0,0 +1,74 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// varint_binary_oarchive.ipp:
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+#include <string>
+#include <cstddef> // size_t
+
+#include <boost/config.hpp> // for BOOST_DEDUCED_TYPENAME
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{ 
+    using ::size_t; 
+}
+#endif
+
+#ifndef BOOST_NO_CWCHAR
+#include <cwchar>
+#ifdef BOOST_NO_STDC_NAMESPACE
+namespace std{ using ::wcslen; }
+#endif
+#endif
+
+#include <boost/archive/varint_binary_oarchive.hpp>
+
+namespace boost {
+namespace archive {
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// implementation of varint_binary_oarchive
+
+// wide characters are written one varint each so that the archive
+// doesn't depend upon sizeof(wchar_t)
+
+#ifndef BOOST_NO_STD_WSTRING
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+varint_binary_oarchive_impl<Archive>::save(const std::wstring & ws){
+    const std::size_t l = ws.size();
+    save(l);
+    for(std::size_t i = 0; i < l; ++i)
+        save(ws[i]);
+}
+#endif
+
+#ifndef BOOST_NO_INTRINSIC_WCHAR_T
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+varint_binary_oarchive_impl<Archive>::save(const wchar_t * ws){
+    const std::size_t l = std::wcslen(ws);
+    save(l);
+    for(std::size_t i = 0; i < l; ++i)
+        save(ws[i]);
+}
+#endif
+
+template<class Archive>
+BOOST_ARCHIVE_DECL(void)
+varint_binary_oarchive_impl<Archive>::init(unsigned int flags){
+    if(0 != (flags & no_header))
+        return;
+    // write signature in an archive version independent manner
+    const std::string file_signature(BOOST_ARCHIVE_SIGNATURE());
+    * this->detail_common_oarchive::This() << file_signature;
+    // write library version
+    const library_version_type v(BOOST_ARCHIVE_VERSION());
+    * this->detail_common_oarchive::This() << v;
+}
+
+} // namespace archive
+} // namespace boost
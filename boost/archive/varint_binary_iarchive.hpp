@@ -0,0 +1,318 @@
+#ifndef BOOST_ARCHIVE_VARINT_BINARY_IARCHIVE_HPP
+#define BOOST_ARCHIVE_VARINT_BINARY_IARCHIVE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// varint_binary_iarchive.hpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+// read archives created by varint_binary_oarchive
+
+#include <istream>
+#include <string>
+#include <cstddef> // size_t
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/endian.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/serialization/pfto.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/throw_exception.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_archive.hpp>
+#include <boost/archive/basic_binary_iprimitive.hpp>
+#include <boost/archive/detail/common_iarchive.hpp>
+#include <boost/archive/detail/register_archive.hpp>
+#include <boost/archive/varint_binary_oarchive.hpp> // varint_category
+
+#ifdef BOOST_MSVC
+#  pragma warning(push)
+#  pragma warning(disable : 4511 4512)
+#endif
+
+namespace boost {
+namespace archive {
+
+template<class Archive>
+class varint_binary_iarchive_impl :
+    public basic_binary_iprimitive<Archive, char, std::char_traits<char> >,
+    public detail::common_iarchive<Archive>
+{
+    typedef basic_binary_iprimitive<
+        Archive, char, std::char_traits<char>
+    > primitive_base_t;
+    typedef detail::common_iarchive<Archive> detail_common_iarchive;
+    typedef std::char_traits<char> traits_type;
+#ifdef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+public:
+#else
+    friend class detail::interface_iarchive<Archive>;
+    friend class basic_binary_iprimitive<
+        Archive, char, std::char_traits<char>
+    >;
+    friend class load_access;
+protected:
+#endif
+    unsigned char get(){
+        const traits_type::int_type c = this->m_sb.sbumpc();
+        if(traits_type::eq_int_type(c, traits_type::eof()))
+            boost::serialization::throw_exception(
+                archive_exception(archive_exception::input_stream_error)
+            );
+        return static_cast<unsigned char>(traits_type::to_char_type(c));
+    }
+    boost::uintmax_t get_varint(){
+        const unsigned int digits =
+            std::numeric_limits<boost::uintmax_t>::digits;
+        boost::uintmax_t x = 0;
+        for(unsigned int shift = 0;; shift += 7){
+            const unsigned char b = get();
+            // more bits than fit in the largest integer
+            if(digits <= shift
+            || (digits < shift + 7 && 0 != ((b & 0x7f) >> (digits - shift))))
+                boost::serialization::throw_exception(
+                    archive_exception(archive_exception::input_stream_error)
+                );
+            x |= static_cast<boost::uintmax_t>(b & 0x7f) << shift;
+            if(0 == (b & 0x80))
+                return x;
+        }
+    }
+    static void out_of_range(){
+        boost::serialization::throw_exception(
+            archive_exception(
+                archive_exception::incompatible_native_format,
+                "integer too large"
+            )
+        );
+    }
+    template<class T>
+    void load_fixed(T & t){
+        this->load_binary(& t, sizeof(T));
+        #if defined(BOOST_BIG_ENDIAN)
+            char * p = reinterpret_cast<char *>(& t);
+            for(std::size_t i = 0; i < sizeof(T) / 2; ++i){
+                const char c = p[i];
+                p[i] = p[sizeof(T) - 1 - i];
+                p[sizeof(T) - 1 - i] = c;
+            }
+        #endif
+    }
+    template<class T>
+    void load_arithmetic(T & t, mpl::true_, mpl::true_){
+        load_fixed(t);
+    }
+    template<class T>
+    void load_arithmetic(T & t, mpl::true_, mpl::false_){
+        load_fixed(t);
+    }
+    template<class T>
+    void load_arithmetic(T & t, mpl::false_, mpl::true_){
+        const boost::uintmax_t u = get_varint();
+        const boost::intmax_t i = (0 == (u & 1)) ?
+            static_cast<boost::intmax_t>(u >> 1) :
+            static_cast<boost::intmax_t>(~(u >> 1));
+        if(i < static_cast<boost::intmax_t>((std::numeric_limits< T >::min)())
+        || i > static_cast<boost::intmax_t>((std::numeric_limits< T >::max)()))
+            out_of_range();
+        t = static_cast< T >(i);
+    }
+    template<class T>
+    void load_arithmetic(T & t, mpl::false_, mpl::false_){
+        const boost::uintmax_t u = get_varint();
+        if(u > static_cast<boost::uintmax_t>((std::numeric_limits< T >::max)()))
+            out_of_range();
+        t = static_cast< T >(u);
+    }
+    template<class T>
+    void load_varint(T & t, mpl::true_){
+        typedef detail::varint_category< T > category;
+        load_arithmetic(
+            t,
+            BOOST_DEDUCED_TYPENAME category::is_fixed(),
+            BOOST_DEDUCED_TYPENAME category::is_zigzag()
+        );
+    }
+    // the types used by the library itself
+    template<class T>
+    void load_varint(T & t, mpl::false_){
+        load_strong(t);
+    }
+    void load_strong(library_version_type & t){
+        uint_least16_t x = 0;
+        load(x);
+        t = library_version_type(x);
+    }
+    void load_strong(version_type & t){
+        uint_least32_t x = 0;
+        load(x);
+        t = version_type(x);
+    }
+    void load_strong(class_id_type & t){
+        int x = 0;
+        load(x);
+        t = class_id_type(x);
+    }
+    void load_strong(object_id_type & t){
+        uint_least32_t x = 0;
+        load(x);
+        t = object_id_type(x);
+    }
+    void load_strong(tracking_type & t){
+        bool x = false;
+        load(x);
+        t = tracking_type(x);
+    }
+    void load_strong(serialization::collection_size_type & t){
+        std::size_t x = 0;
+        load(x);
+        t = serialization::collection_size_type(x);
+    }
+    void load_strong(serialization::item_version_type & t){
+        unsigned int x = 0;
+        load(x);
+        t = serialization::item_version_type(x);
+    }
+
+    template<class T>
+    void load_primitive(T & t, mpl::true_){
+        load_varint(t, BOOST_DEDUCED_TYPENAME is_arithmetic< T >::type());
+    }
+    template<class T>
+    void load_primitive(T & t, mpl::false_){
+        primitive_base_t::load(t);
+    }
+
+    // all primitives other than strings
+    template<class T>
+    void load(T & t){
+        load_primitive(t, BOOST_DEDUCED_TYPENAME detail::is_varint< T >::type());
+    }
+    void load(bool & t){
+        primitive_base_t::load(t);
+    }
+    void load(std::string & s){
+        primitive_base_t::load(s);
+    }
+    void load(char * s){
+        primitive_base_t::load(s);
+    }
+    #ifndef BOOST_NO_STD_WSTRING
+    BOOST_ARCHIVE_DECL(void)
+    load(std::wstring & ws);
+    #endif
+    #ifndef BOOST_NO_INTRINSIC_WCHAR_T
+    BOOST_ARCHIVE_DECL(void)
+    load(wchar_t * ws);
+    #endif
+
+    // any datatype not specifed below will be handled by base class
+    template<class T>
+    void load_override(T & t, BOOST_PFTO int){
+        this->detail_common_iarchive::load_override(t, 0);
+    }
+    // binary files don't include the optional information
+    void load_override(class_id_optional_type & /* t */, int){}
+    BOOST_ARCHIVE_DECL(void)
+    load_override(class_name_type & t, int);
+
+    BOOST_ARCHIVE_DECL(void)
+    init(unsigned int flags);
+
+    varint_binary_iarchive_impl(std::streambuf & bsb, unsigned int flags) :
+        primitive_base_t(bsb, 0 != (flags & no_codecvt)),
+        detail_common_iarchive(flags)
+    {
+        init(flags);
+    }
+    varint_binary_iarchive_impl(std::istream & is, unsigned int flags) :
+        primitive_base_t(* is.rdbuf(), 0 != (flags & no_codecvt)),
+        detail_common_iarchive(flags)
+    {
+        init(flags);
+    }
+public:
+    // see varint_binary_oarchive_impl::save_array
+    struct use_array_optimization {
+        template <class T>
+        #if defined(BOOST_NO_DEPENDENT_NESTED_DERIVATIONS)
+            struct apply {
+                typedef BOOST_DEDUCED_TYPENAME boost::is_arithmetic< T >::type type;
+            };
+        #else
+            struct apply : public boost::is_arithmetic< T > {};
+        #endif
+    };
+    template <class ValueType>
+    void load_array(
+        boost::serialization::array<ValueType> & a,
+        unsigned int
+    ){
+        #if ! defined(BOOST_BIG_ENDIAN)
+        if(detail::varint_category<ValueType>::is_fixed::value){
+            // already in the right format
+            this->load_binary(a.address(), a.count() * sizeof(ValueType));
+            return;
+        }
+        #endif
+        ValueType * p = a.address();
+        for(std::size_t n = a.count(); n > 0; --n)
+            load(* p++);
+    }
+};
+
+} // namespace archive
+} // namespace boost
+
+// note special treatment of shared_ptr. This type needs a special
+// structure associated with every archive.  We created a "mix-in"
+// class to provide this functionality.  Since shared_ptr holds a
+// special esteem in the boost library - we included it here by default.
+#include <boost/archive/shared_ptr_helper.hpp>
+
+namespace boost {
+namespace archive {
+
+// do not derive from this class.  If you want to extend this functionality
+// via inhertance, derived from varint_binary_iarchive_impl instead.  This
+// will preserve correct static polymorphism.
+class varint_binary_iarchive :
+    public varint_binary_iarchive_impl<varint_binary_iarchive>,
+    public detail::shared_ptr_helper
+{
+public:
+    varint_binary_iarchive(std::istream & is, unsigned int flags = 0) :
+        varint_binary_iarchive_impl<varint_binary_iarchive>(is, flags)
+    {}
+    varint_binary_iarchive(std::streambuf & bsb, unsigned int flags = 0) :
+        varint_binary_iarchive_impl<varint_binary_iarchive>(bsb, flags)
+    {}
+};
+
+} // namespace archive
+} // namespace boost
+
+// required by export
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::varint_binary_iarchive)
+BOOST_SERIALIZATION_USE_ARRAY_OPTIMIZATION(boost::archive::varint_binary_iarchive)
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+#endif // BOOST_ARCHIVE_VARINT_BINARY_IARCHIVE_HPP
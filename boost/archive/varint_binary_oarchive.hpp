@@ -0,0 +1,332 @@
+#ifndef BOOST_ARCHIVE_VARINT_BINARY_OARCHIVE_HPP
+#define BOOST_ARCHIVE_VARINT_BINARY_OARCHIVE_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// varint_binary_oarchive.hpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+// A compact and portable binary archive.  Integers, including sizes and
+// the ids and versions written by the library, are written as LEB128
+// variable length integers, signed ones after zig-zag encoding.  Small
+// values therefore take a single byte whatever the size of their type.
+// Floating point values are written in little endian byte order.
+
+#include <ostream>
+#include <string>
+#include <cstddef> // size_t
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/detail/endian.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/serialization/pfto.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/item_version_type.hpp>
+#include <boost/archive/basic_archive.hpp>
+#include <boost/archive/basic_binary_oprimitive.hpp>
+#include <boost/archive/detail/common_oarchive.hpp>
+#include <boost/archive/detail/register_archive.hpp>
+
+#ifdef BOOST_MSVC
+#  pragma warning(push)
+#  pragma warning(disable : 4511 4512)
+#endif
+
+namespace boost {
+namespace archive {
+namespace detail {
+
+// how each arithmetic type is written
+template<class T>
+struct varint_category {
+    typedef BOOST_DEDUCED_TYPENAME mpl::or_<
+        is_floating_point< T >,
+        mpl::bool_<1 == sizeof(T)>
+    >::type is_fixed;
+    // wchar_t is signed on some platforms and not on others
+    typedef mpl::bool_<
+        is_signed< T >::value && ! is_same< T, wchar_t >::value
+    > is_zigzag;
+};
+
+// types written as variable length integers.  Other primitives, those
+// declared so with BOOST_CLASS_IMPLEMENTATION, are written as they are
+template<class T>
+struct is_varint : public is_arithmetic< T > {};
+template<>
+struct is_varint<library_version_type> : public mpl::true_ {};
+template<>
+struct is_varint<version_type> : public mpl::true_ {};
+template<>
+struct is_varint<class_id_type> : public mpl::true_ {};
+template<>
+struct is_varint<class_id_reference_type> : public mpl::true_ {};
+template<>
+struct is_varint<object_id_type> : public mpl::true_ {};
+template<>
+struct is_varint<object_reference_type> : public mpl::true_ {};
+template<>
+struct is_varint<tracking_type> : public mpl::true_ {};
+template<>
+struct is_varint<serialization::collection_size_type> : public mpl::true_ {};
+template<>
+struct is_varint<serialization::item_version_type> : public mpl::true_ {};
+
+// the integers underlying the types used by the library itself
+template<class T>
+inline BOOST_DEDUCED_TYPENAME enable_if<is_arithmetic< T >, T>::type
+varint_value(const T & t){
+    return t;
+}
+inline boost::uint_least16_t
+varint_value(const library_version_type & t){
+    return t;
+}
+inline boost::uint_least32_t
+varint_value(const version_type & t){
+    return t;
+}
+inline int
+varint_value(const class_id_type & t){
+    return t;
+}
+inline boost::uint_least32_t
+varint_value(const object_id_type & t){
+    return t;
+}
+inline bool
+varint_value(const tracking_type & t){
+    return t;
+}
+inline std::size_t
+varint_value(const serialization::collection_size_type & t){
+    return t;
+}
+inline unsigned int
+varint_value(const serialization::item_version_type & t){
+    return t;
+}
+
+} // namespace detail
+
+template<class Archive>
+class varint_binary_oarchive_impl :
+    public basic_binary_oprimitive<Archive, char, std::char_traits<char> >,
+    public detail::common_oarchive<Archive>
+{
+    typedef basic_binary_oprimitive<
+        Archive, char, std::char_traits<char>
+    > primitive_base_t;
+    typedef detail::common_oarchive<Archive> detail_common_oarchive;
+#ifdef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
+public:
+#else
+    friend class detail::interface_oarchive<Archive>;
+    friend class basic_binary_oprimitive<
+        Archive, char, std::char_traits<char>
+    >;
+    friend class save_access;
+protected:
+#endif
+    void put(boost::uintmax_t x){
+        // at most 10 bytes for 64 bits
+        char buffer[(sizeof(x) * 8 + 6) / 7];
+        std::size_t n = 0;
+        while(0x80 <= x){
+            buffer[n++] = static_cast<char>((x & 0x7f) | 0x80);
+            x >>= 7;
+        }
+        buffer[n++] = static_cast<char>(x);
+        this->save_binary(buffer, n);
+    }
+    template<class T>
+    void save_fixed(const T & t){
+        #if defined(BOOST_BIG_ENDIAN)
+            char buffer[sizeof(T)];
+            const char * p = reinterpret_cast<const char *>(& t);
+            for(std::size_t i = 0; i < sizeof(T); ++i)
+                buffer[i] = p[sizeof(T) - 1 - i];
+            this->save_binary(buffer, sizeof(T));
+        #else
+            this->save_binary(& t, sizeof(T));
+        #endif
+    }
+    template<class T>
+    void save_arithmetic(const T & t, mpl::true_, mpl::true_){
+        save_fixed(t);
+    }
+    template<class T>
+    void save_arithmetic(const T & t, mpl::true_, mpl::false_){
+        save_fixed(t);
+    }
+    template<class T>
+    void save_arithmetic(const T & t, mpl::false_, mpl::true_){
+        // zig-zag encoding maps small negative values to small
+        // unsigned ones
+        const boost::intmax_t i = t;
+        const boost::uintmax_t u = static_cast<boost::uintmax_t>(i) << 1;
+        put(i < 0 ? ~u : u);
+    }
+    template<class T>
+    void save_arithmetic(const T & t, mpl::false_, mpl::false_){
+        put(static_cast<boost::uintmax_t>(t));
+    }
+    template<class T>
+    void save_value(const T & t){
+        typedef detail::varint_category< T > category;
+        save_arithmetic(
+            t,
+            BOOST_DEDUCED_TYPENAME category::is_fixed(),
+            BOOST_DEDUCED_TYPENAME category::is_zigzag()
+        );
+    }
+
+    template<class T>
+    void save_primitive(const T & t, mpl::true_){
+        save_value(detail::varint_value(t));
+    }
+    template<class T>
+    void save_primitive(const T & t, mpl::false_){
+        primitive_base_t::save(t);
+    }
+
+    // all primitives other than strings
+    template<class T>
+    void save(const T & t){
+        save_primitive(t, BOOST_DEDUCED_TYPENAME detail::is_varint< T >::type());
+    }
+    void save(const bool t){
+        primitive_base_t::save(t);
+    }
+    void save(const std::string & s){
+        primitive_base_t::save(s);
+    }
+    void save(const char * s){
+        primitive_base_t::save(s);
+    }
+    #ifndef BOOST_NO_STD_WSTRING
+    BOOST_ARCHIVE_DECL(void)
+    save(const std::wstring & ws);
+    #endif
+    #ifndef BOOST_NO_INTRINSIC_WCHAR_T
+    BOOST_ARCHIVE_DECL(void)
+    save(const wchar_t * ws);
+    #endif
+
+    // any datatype not specifed below will be handled by base class
+    template<class T>
+    void save_override(T & t, BOOST_PFTO int){
+        this->detail_common_oarchive::save_override(t, 0);
+    }
+    // binary files don't include the optional information
+    void save_override(const class_id_optional_type & /* t */, int){}
+    // explicitly convert to char * to avoid compile ambiguities
+    void save_override(const class_name_type & t, int){
+        const std::string s(t);
+        * this->detail_common_oarchive::This() << s;
+    }
+
+    BOOST_ARCHIVE_DECL(void)
+    init(unsigned int flags);
+
+    varint_binary_oarchive_impl(std::streambuf & bsb, unsigned int flags) :
+        primitive_base_t(bsb, 0 != (flags & no_codecvt)),
+        detail_common_oarchive(flags)
+    {
+        init(flags);
+    }
+    varint_binary_oarchive_impl(std::ostream & os, unsigned int flags) :
+        primitive_base_t(* os.rdbuf(), 0 != (flags & no_codecvt)),
+        detail_common_oarchive(flags)
+    {
+        init(flags);
+    }
+public:
+    // arrays of arithmetic types are written in a single pass which
+    // doesn't go through the serialization machinery for each element
+    struct use_array_optimization {
+        template <class T>
+        #if defined(BOOST_NO_DEPENDENT_NESTED_DERIVATIONS)
+            struct apply {
+                typedef BOOST_DEDUCED_TYPENAME boost::is_arithmetic< T >::type type;
+            };
+        #else
+            struct apply : public boost::is_arithmetic< T > {};
+        #endif
+    };
+    template <class ValueType>
+    void save_array(
+        boost::serialization::array<ValueType> const & a,
+        unsigned int
+    ){
+        #if ! defined(BOOST_BIG_ENDIAN)
+        if(detail::varint_category<ValueType>::is_fixed::value){
+            // already in the right format
+            this->save_binary(a.address(), a.count() * sizeof(ValueType));
+            return;
+        }
+        #endif
+        const ValueType * p = a.address();
+        for(std::size_t n = a.count(); n > 0; --n)
+            save(* p++);
+    }
+};
+
+} // namespace archive
+} // namespace boost
+
+// note special treatment of shared_ptr. This type needs a special
+// structure associated with every archive.  We created a "mix-in"
+// class to provide this functionality.  Since shared_ptr holds a
+// special esteem in the boost library - we included it here by default.
+#include <boost/archive/shared_ptr_helper.hpp>
+
+namespace boost {
+namespace archive {
+
+// do not derive from this class.  If you want to extend this functionality
+// via inhertance, derived from varint_binary_oarchive_impl instead.  This
+// will preserve correct static polymorphism.
+class varint_binary_oarchive :
+    public varint_binary_oarchive_impl<varint_binary_oarchive>,
+    public detail::shared_ptr_helper
+{
+public:
+    varint_binary_oarchive(std::ostream & os, unsigned int flags = 0) :
+        varint_binary_oarchive_impl<varint_binary_oarchive>(os, flags)
+    {}
+    varint_binary_oarchive(std::streambuf & bsb, unsigned int flags = 0) :
+        varint_binary_oarchive_impl<varint_binary_oarchive>(bsb, flags)
+    {}
+};
+
+} // namespace archive
+} // namespace boost
+
+// required by export
+BOOST_SERIALIZATION_REGISTER_ARCHIVE(boost::archive::varint_binary_oarchive)
+BOOST_SERIALIZATION_USE_ARRAY_OPTIMIZATION(boost::archive::varint_binary_oarchive)
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+#endif // BOOST_ARCHIVE_VARINT_BINARY_OARCHIVE_HPP
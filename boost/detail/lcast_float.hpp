@@ -0,0 +1,726 @@
+// Copyright Antony Polukhin, 2013.
+
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_DETAIL_LCAST_FLOAT_HPP_INCLUDED
+#define BOOST_DETAIL_LCAST_FLOAT_HPP_INCLUDED
+
+// Conversions between float or double and decimal text for lexical_cast,
+// which do not depend on the C library or on iostreams:
+//
+// lcast_put_float writes the shortest string that reads back as the same
+// value, using the Grisu2 algorithm from "Printing Floating-Point Numbers
+// Quickly and Accurately with Integers" by Florian Loitsch, in the format
+// of printf("%.*g") with the precision lexical_cast has always used.
+//
+// lcast_decimal_to_float gives the correctly rounded value of a decimal
+// number, computing it directly when the digits and the power of ten are
+// both exact in the floating point type, and otherwise refining an
+// estimate by comparing it against the decimal number with big integers.
+//
+// Both need IEEE 754 single and double precision and a 64 bit integer
+// type. Where those are missing, BOOST_LCAST_NO_FAST_FLOAT is defined and
+// lexical_cast uses the C library as before.
+
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/detail/lcast_precision.hpp>
+
+#if !defined(BOOST_LCAST_NO_FAST_FLOAT) && ( \
+        defined(BOOST_NO_INT64_T) || FLT_RADIX != 2 || \
+        FLT_MANT_DIG != 24 || FLT_MIN_EXP != -125 || FLT_MAX_EXP != 128 || \
+        DBL_MANT_DIG != 53 || DBL_MIN_EXP != -1021 || DBL_MAX_EXP != 1024)
+#define BOOST_LCAST_NO_FAST_FLOAT
+#endif
+
+namespace boost { namespace detail {
+
+// The decimal digits of a number, with the power of ten of the last one.
+// Only the first max_digits significant digits are kept, which is enough
+// to decide how any decimal number rounds.
+struct lcast_decimal
+{
+    enum { max_digits = 800 };
+
+    unsigned char digits[max_digits];
+    std::size_t size;
+    int exponent;
+    bool truncated; // whether there are non-zero digits after the ones kept
+    boost::uintmax_t head; // the first head_digits digits as a number
+
+    BOOST_STATIC_CONSTANT(std::size_t, head_digits = std::numeric_limits<boost::uintmax_t>::digits10);
+
+    lcast_decimal() : size(0), exponent(0), truncated(false), head(0) {}
+
+    void push_integer_digit(unsigned d)
+    {
+        if (size == 0 && d == 0) return;
+        if (size < head_digits) head = head * 10 + d;
+        if (size < max_digits) digits[size++] = static_cast<unsigned char>(d);
+        else {
+            truncated = truncated || d != 0;
+            ++exponent;
+        }
+    }
+
+    void push_fraction_digit(unsigned d)
+    {
+        if (size == 0 && d == 0) {
+            --exponent;
+            return;
+        }
+        if (size < head_digits) head = head * 10 + d;
+        if (size < max_digits) {
+            digits[size++] = static_cast<unsigned char>(d);
+            --exponent;
+        } else {
+            truncated = truncated || d != 0;
+        }
+    }
+};
+
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+
+template <class T> struct lcast_float_layout;
+
+template <>
+struct lcast_float_layout<float>
+{
+    typedef boost::uint32_t bits_type;
+    BOOST_STATIC_CONSTANT(int, digits = 24);
+    BOOST_STATIC_CONSTANT(int, min_exponent = -125);
+    BOOST_STATIC_CONSTANT(int, max_exponent = 128);
+    // Largest n for which 10^n is exact
+    BOOST_STATIC_CONSTANT(int, max_exact_pow10 = 10);
+    // Numbers whose first digit is further from the point than these
+    // round to zero or overflow
+    BOOST_STATIC_CONSTANT(int, min_lead_pow10 = -46);
+    BOOST_STATIC_CONSTANT(int, max_lead_pow10 = 38);
+};
+
+template <>
+struct lcast_float_layout<double>
+{
+    typedef boost::uint64_t bits_type;
+    BOOST_STATIC_CONSTANT(int, digits = 53);
+    BOOST_STATIC_CONSTANT(int, min_exponent = -1021);
+    BOOST_STATIC_CONSTANT(int, max_exponent = 1024);
+    BOOST_STATIC_CONSTANT(int, max_exact_pow10 = 22);
+    BOOST_STATIC_CONSTANT(int, min_lead_pow10 = -324);
+    BOOST_STATIC_CONSTANT(int, max_lead_pow10 = 308);
+};
+
+inline double lcast_pow10(int n)
+{
+    static const double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return powers[n];
+}
+
+/******************************** OUTPUT ********************************/
+
+// A number f * 2^e
+struct lcast_diyfp
+{
+    boost::uint64_t f;
+    int e;
+
+    lcast_diyfp(boost::uint64_t f_, int e_) : f(f_), e(e_) {}
+
+    // The 64 most significant bits of the product, rounded
+    static lcast_diyfp mul(const lcast_diyfp& x, const lcast_diyfp& y)
+    {
+        const boost::uint64_t x_lo = x.f & 0xFFFFFFFFu, x_hi = x.f >> 32;
+        const boost::uint64_t y_lo = y.f & 0xFFFFFFFFu, y_hi = y.f >> 32;
+        const boost::uint64_t p0 = x_lo * y_lo, p1 = x_lo * y_hi;
+        const boost::uint64_t p2 = x_hi * y_lo, p3 = x_hi * y_hi;
+        boost::uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += boost::uint64_t(1) << 31;
+        return lcast_diyfp(p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static lcast_diyfp normalize(lcast_diyfp x)
+    {
+        int error = 0;
+        return normalize(x, error);
+    }
+
+    // Also scales error, in units of the last bit
+    static lcast_diyfp normalize(lcast_diyfp x, int& error)
+    {
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER)
+        const int shift = __builtin_clzll(x.f);
+#else
+        int shift = 0;
+        for (int step = 32; step; step /= 2) {
+            if ((x.f << shift) >> (64 - step) == 0) shift += step;
+        }
+#endif
+        x.f <<= shift;
+        x.e -= shift;
+        if (error) error <<= shift;
+        return x;
+    }
+};
+
+// 10^k for k = -300, -292, ..., 324 as (hi, lo) * 2^e, rounded
+struct lcast_cached_power
+{
+    boost::uint32_t hi, lo;
+    int e, k;
+};
+
+inline const lcast_cached_power& lcast_get_cached_power(int k_index)
+{
+    static const lcast_cached_power powers[] = {
+        { 0xAB70FE17u, 0xC79AC6CAu, -1060, -300 },
+        { 0xFF77B1FCu, 0xBEBCDC4Fu, -1034, -292 },
+        { 0xBE5691EFu, 0x416BD60Cu, -1007, -284 },
+        { 0x8DD01FADu, 0x907FFC3Cu,  -980, -276 },
+        { 0xD3515C28u, 0x31559A83u,  -954, -268 },
+        { 0x9D71AC8Fu, 0xADA6C9B5u,  -927, -260 },
+        { 0xEA9C2277u, 0x23EE8BCBu,  -901, -252 },
+        { 0xAECC4991u, 0x4078536Du,  -874, -244 },
+        { 0x823C1279u, 0x5DB6CE57u,  -847, -236 },
+        { 0xC2109436u, 0x4DFB5637u,  -821, -228 },
+        { 0x9096EA6Fu, 0x3848984Fu,  -794, -220 },
+        { 0xD77485CBu, 0x25823AC7u,  -768, -212 },
+        { 0xA086CFCDu, 0x97BF97F4u,  -741, -204 },
+        { 0xEF340A98u, 0x172AACE5u,  -715, -196 },
+        { 0xB23867FBu, 0x2A35B28Eu,  -688, -188 },
+        { 0x84C8D4DFu, 0xD2C63F3Bu,  -661, -180 },
+        { 0xC5DD4427u, 0x1AD3CDBAu,  -635, -172 },
+        { 0x936B9FCEu, 0xBB25C996u,  -608, -164 },
+        { 0xDBAC6C24u, 0x7D62A584u,  -582, -156 },
+        { 0xA3AB6658u, 0x0D5FDAF6u,  -555, -148 },
+        { 0xF3E2F893u, 0xDEC3F126u,  -529, -140 },
+        { 0xB5B5ADA8u, 0xAAFF80B8u,  -502, -132 },
+        { 0x87625F05u, 0x6C7C4A8Bu,  -475, -124 },
+        { 0xC9BCFF60u, 0x34C13053u,  -449, -116 },
+        { 0x964E858Cu, 0x91BA2655u,  -422, -108 },
+        { 0xDFF97724u, 0x70297EBDu,  -396, -100 },
+        { 0xA6DFBD9Fu, 0xB8E5B88Fu,  -369,  -92 },
+        { 0xF8A95FCFu, 0x88747D94u,  -343,  -84 },
+        { 0xB9447093u, 0x8FA89BCFu,  -316,  -76 },
+        { 0x8A08F0F8u, 0xBF0F156Bu,  -289,  -68 },
+        { 0xCDB02555u, 0x653131B6u,  -263,  -60 },
+        { 0x993FE2C6u, 0xD07B7FACu,  -236,  -52 },
+        { 0xE45C10C4u, 0x2A2B3B06u,  -210,  -44 },
+        { 0xAA242499u, 0x697392D3u,  -183,  -36 },
+        { 0xFD87B5F2u, 0x8300CA0Eu,  -157,  -28 },
+        { 0xBCE50864u, 0x92111AEBu,  -130,  -20 },
+        { 0x8CBCCC09u, 0x6F5088CCu,  -103,  -12 },
+        { 0xD1B71758u, 0xE219652Cu,   -77,   -4 },
+        { 0x9C400000u, 0x00000000u,   -50,    4 },
+        { 0xE8D4A510u, 0x00000000u,   -24,   12 },
+        { 0xAD78EBC5u, 0xAC620000u,     3,   20 },
+        { 0x813F3978u, 0xF8940984u,    30,   28 },
+        { 0xC097CE7Bu, 0xC90715B3u,    56,   36 },
+        { 0x8F7E32CEu, 0x7BEA5C70u,    83,   44 },
+        { 0xD5D238A4u, 0xABE98068u,   109,   52 },
+        { 0x9F4F2726u, 0x179A2245u,   136,   60 },
+        { 0xED63A231u, 0xD4C4FB27u,   162,   68 },
+        { 0xB0DE6538u, 0x8CC8ADA8u,   189,   76 },
+        { 0x83C7088Eu, 0x1AAB65DBu,   216,   84 },
+        { 0xC45D1DF9u, 0x42711D9Au,   242,   92 },
+        { 0x924D692Cu, 0xA61BE758u,   269,  100 },
+        { 0xDA01EE64u, 0x1A708DEAu,   295,  108 },
+        { 0xA26DA399u, 0x9AEF774Au,   322,  116 },
+        { 0xF209787Bu, 0xB47D6B85u,   348,  124 },
+        { 0xB454E4A1u, 0x79DD1877u,   375,  132 },
+        { 0x865B8692u, 0x5B9BC5C2u,   402,  140 },
+        { 0xC83553C5u, 0xC8965D3Du,   428,  148 },
+        { 0x952AB45Cu, 0xFA97A0B3u,   455,  156 },
+        { 0xDE469FBDu, 0x99A05FE3u,   481,  164 },
+        { 0xA59BC234u, 0xDB398C25u,   508,  172 },
+        { 0xF6C69A72u, 0xA3989F5Cu,   534,  180 },
+        { 0xB7DCBF53u, 0x54E9BECEu,   561,  188 },
+        { 0x88FCF317u, 0xF22241E2u,   588,  196 },
+        { 0xCC20CE9Bu, 0xD35C78A5u,   614,  204 },
+        { 0x98165AF3u, 0x7B2153DFu,   641,  212 },
+        { 0xE2A0B5DCu, 0x971F303Au,   667,  220 },
+        { 0xA8D9D153u, 0x5CE3B396u,   694,  228 },
+        { 0xFB9B7CD9u, 0xA4A7443Cu,   720,  236 },
+        { 0xBB764C4Cu, 0xA7A44410u,   747,  244 },
+        { 0x8BAB8EEFu, 0xB6409C1Au,   774,  252 },
+        { 0xD01FEF10u, 0xA657842Cu,   800,  260 },
+        { 0x9B10A4E5u, 0xE9913129u,   827,  268 },
+        { 0xE7109BFBu, 0xA19C0C9Du,   853,  276 },
+        { 0xAC2820D9u, 0x623BF429u,   880,  284 },
+        { 0x80444B5Eu, 0x7AA7CF85u,   907,  292 },
+        { 0xBF21E440u, 0x03ACDD2Du,   933,  300 },
+        { 0x8E679C2Fu, 0x5E44FF8Fu,   960,  308 },
+        { 0xD433179Du, 0x9C8CB841u,   986,  316 },
+        { 0x9E19DB92u, 0xB4E31BA9u,  1013,  324 }
+    };
+    return powers[k_index];
+}
+
+// Appends the digits of the shortest decimal number between low and high
+// (exclusive) to buffer, choosing the one closest to w among those, and
+// adjusts decimal_exponent for them
+inline void lcast_grisu2_digits(char* buffer, int& length, int& decimal_exponent,
+        lcast_diyfp low, lcast_diyfp w, lcast_diyfp high)
+{
+    boost::uint64_t delta = high.f - low.f;
+    boost::uint64_t dist = high.f - w.f;
+    const int shift = -high.e;
+    const boost::uint64_t one = boost::uint64_t(1) << shift;
+    boost::uint32_t p1 = static_cast<boost::uint32_t>(high.f >> shift);
+    boost::uint64_t p2 = high.f & (one - 1);
+
+    boost::uint32_t pow10 = 1;
+    int n = 1;
+    while (n < 10 && p1 >= pow10 * 10u) {
+        pow10 *= 10u;
+        ++n;
+    }
+
+    boost::uint64_t rest, unit;
+    for (;;) {
+        const boost::uint32_t d = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + d);
+        --n;
+        rest = (static_cast<boost::uint64_t>(p1) << shift) + p2;
+        if (rest <= delta) {
+            decimal_exponent += n;
+            unit = static_cast<boost::uint64_t>(pow10) << shift;
+            break;
+        }
+        if (n == 0) {
+            for (;;) {
+                p2 *= 10u;
+                delta *= 10u;
+                dist *= 10u;
+                buffer[length++] = static_cast<char>('0' + (p2 >> shift));
+                p2 &= one - 1;
+                --n;
+                if (p2 <= delta) break;
+            }
+            decimal_exponent += n;
+            rest = p2;
+            unit = one;
+            break;
+        }
+        pow10 /= 10u;
+    }
+
+    // Move the last digit towards w while staying inside the interval
+    while (rest < dist && delta - rest >= unit
+            && (rest + unit < dist || dist - rest > rest + unit - dist)) {
+        --buffer[length - 1];
+        rest += unit;
+    }
+}
+
+// Writes the shortest digits which read back as value, which must be
+// positive and finite, and returns the number of digits and the power of
+// ten of the last one
+template <class T>
+inline int lcast_grisu2(T value, char* buffer, int& decimal_exponent)
+{
+    typedef lcast_float_layout<T> layout;
+    typedef BOOST_DEDUCED_TYPENAME layout::bits_type bits_type;
+    const int precision = layout::digits;
+    const int bias = layout::max_exponent - 1 + precision - 1;
+    const boost::uint64_t hidden_bit = boost::uint64_t(1) << (precision - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const boost::uint64_t f = bits & (hidden_bit - 1);
+    const int e = static_cast<int>(bits >> (precision - 1));
+
+    const lcast_diyfp v = e == 0 ? lcast_diyfp(f, 1 - bias) : lcast_diyfp(f + hidden_bit, e - bias);
+    // The boundaries halfway to the neighbours, which is closer below a
+    // power of two
+    const lcast_diyfp high = lcast_diyfp::normalize(lcast_diyfp(2 * v.f + 1, v.e - 1));
+    lcast_diyfp low = (f == 0 && e > 1) ? lcast_diyfp(4 * v.f - 1, v.e - 2) : lcast_diyfp(2 * v.f - 1, v.e - 1);
+    low.f <<= low.e - high.e;
+    low.e = high.e;
+    const lcast_diyfp w = lcast_diyfp::normalize(v);
+
+    // Scale by a cached power of ten, so that the result's binary exponent
+    // is in [-60, -32] and its integer part fits in 32 bits
+    const int min_cached_k = -300, cached_k_step = 8;
+    const int target = -61 - high.e;
+    const int k = (target * 78913) / (1 << 18) + (target > 0 ? 1 : 0);
+    const lcast_cached_power& cached =
+        lcast_get_cached_power((k - min_cached_k + cached_k_step - 1) / cached_k_step);
+    const lcast_diyfp c((static_cast<boost::uint64_t>(cached.hi) << 32) | cached.lo, cached.e);
+
+    const lcast_diyfp w_scaled = lcast_diyfp::mul(w, c);
+    lcast_diyfp low_scaled = lcast_diyfp::mul(low, c);
+    lcast_diyfp high_scaled = lcast_diyfp::mul(high, c);
+    // Allow for the rounding of the products
+    ++low_scaled.f;
+    --high_scaled.f;
+
+    int length = 0;
+    decimal_exponent = -cached.k;
+    lcast_grisu2_digits(buffer, length, decimal_exponent, low_scaled, w_scaled, high_scaled);
+    return length;
+}
+
+// Writes value, which must be finite, like printf("%.*g") with the
+// precision lexical_cast uses for T, but with the fewest digits that
+// read back as value, and returns the end of the output
+template <class T, class CharT>
+inline CharT* lcast_put_float(T value, CharT* begin)
+{
+    typedef BOOST_DEDUCED_TYPENAME lcast_float_layout<T>::bits_type bits_type;
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if (bits >> (sizeof(bits) * CHAR_BIT - 1)) {
+        *begin++ = static_cast<CharT>('-');
+        value = -value;
+    }
+    if (value == 0) {
+        *begin++ = static_cast<CharT>('0');
+        return begin;
+    }
+
+    char digits[20];
+    int exponent;
+    int length = lcast_grisu2(value, digits, exponent);
+    while (digits[length - 1] == '0') {
+        --length;
+        ++exponent;
+    }
+
+    // The power of ten of the first digit decides the format
+    const int lead = exponent + length - 1;
+    const int precision = static_cast<int>(boost::detail::lcast_get_precision<T>());
+    if (lead < -4 || lead >= precision) {
+        *begin++ = static_cast<CharT>(digits[0]);
+        if (length > 1) {
+            *begin++ = static_cast<CharT>('.');
+            for (int i = 1; i < length; ++i) *begin++ = static_cast<CharT>(digits[i]);
+        }
+        *begin++ = static_cast<CharT>('e');
+        *begin++ = static_cast<CharT>(lead < 0 ? '-' : '+');
+        const int abs_lead = lead < 0 ? -lead : lead;
+        if (abs_lead >= 100) *begin++ = static_cast<CharT>('0' + abs_lead / 100);
+        *begin++ = static_cast<CharT>('0' + abs_lead / 10 % 10);
+        *begin++ = static_cast<CharT>('0' + abs_lead % 10);
+    } else if (lead < 0) {
+        *begin++ = static_cast<CharT>('0');
+        *begin++ = static_cast<CharT>('.');
+        for (int i = -1; i > lead; --i) *begin++ = static_cast<CharT>('0');
+        for (int i = 0; i < length; ++i) *begin++ = static_cast<CharT>(digits[i]);
+    } else {
+        for (int i = 0; i <= lead; ++i) *begin++ = static_cast<CharT>(i < length ? digits[i] : '0');
+        if (length > lead + 1) {
+            *begin++ = static_cast<CharT>('.');
+            for (int i = lead + 1; i < length; ++i) *begin++ = static_cast<CharT>(digits[i]);
+        }
+    }
+    return begin;
+}
+
+/******************************** INPUT *********************************/
+
+// An unsigned integer big enough for the comparisons made by
+// lcast_decimal_to_float
+class lcast_bignum
+{
+public:
+    enum { max_limbs = 100 };
+
+    explicit lcast_bignum(boost::uint64_t value) : m_size(0)
+    {
+        while (value) {
+            m_limbs[m_size++] = static_cast<boost::uint32_t>(value);
+            value >>= 32;
+        }
+    }
+
+    void multiply_add(boost::uint32_t factor, boost::uint32_t addend)
+    {
+        boost::uint64_t carry = addend;
+        for (std::size_t i = 0; i < m_size; ++i) {
+            carry += static_cast<boost::uint64_t>(m_limbs[i]) * factor;
+            m_limbs[i] = static_cast<boost::uint32_t>(carry);
+            carry >>= 32;
+        }
+        if (carry) push(static_cast<boost::uint32_t>(carry));
+    }
+
+    void multiply_pow5(int n)
+    {
+        // 5^13 is the largest power of five that fits in 32 bits
+        for (; n >= 13; n -= 13) multiply_add(1220703125u, 0);
+        boost::uint32_t factor = 1;
+        for (; n > 0; --n) factor *= 5;
+        if (factor != 1) multiply_add(factor, 0);
+    }
+
+    void shift_left(int n)
+    {
+        if (m_size == 0 || n == 0) return;
+        const std::size_t limbs = static_cast<std::size_t>(n) / 32;
+        const int bits = n % 32;
+        if (bits) {
+            boost::uint32_t carry = 0;
+            for (std::size_t i = 0; i < m_size; ++i) {
+                const boost::uint32_t next = m_limbs[i] >> (32 - bits);
+                m_limbs[i] = (m_limbs[i] << bits) | carry;
+                carry = next;
+            }
+            if (carry) push(carry);
+        }
+        BOOST_ASSERT(m_size + limbs <= max_limbs);
+        for (std::size_t i = m_size; i-- > 0; ) m_limbs[i + limbs] = m_limbs[i];
+        for (std::size_t i = 0; i < limbs; ++i) m_limbs[i] = 0;
+        m_size += limbs;
+    }
+
+    friend int compare(const lcast_bignum& a, const lcast_bignum& b)
+    {
+        if (a.m_size != b.m_size) return a.m_size < b.m_size ? -1 : 1;
+        for (std::size_t i = a.m_size; i-- > 0; ) {
+            if (a.m_limbs[i] != b.m_limbs[i]) return a.m_limbs[i] < b.m_limbs[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+private:
+    void push(boost::uint32_t limb)
+    {
+        BOOST_ASSERT(m_size < max_limbs);
+        m_limbs[m_size++] = limb;
+    }
+
+    boost::uint32_t m_limbs[max_limbs];
+    std::size_t m_size;
+};
+
+// Compares the decimal number d, whose digits are in digits, with
+// m * 2^k
+inline int lcast_compare(const lcast_decimal& d, const lcast_bignum& digits,
+        boost::uint64_t m, int k)
+{
+    // d * 10^e <=> m * 2^k  is  digits * 5^e <=> m * 2^(k-e)  for e >= 0
+    // and  digits <=> m * 5^-e * 2^(k-e)  for e < 0
+    lcast_bignum right(m);
+    if (d.exponent < 0) right.multiply_pow5(-d.exponent);
+    const int shift = k - d.exponent;
+    int result;
+    if (shift >= 0) {
+        right.shift_left(shift);
+        result = compare(digits, right);
+    } else {
+        lcast_bignum left(digits);
+        left.shift_left(-shift);
+        result = compare(left, right);
+    }
+    return result == 0 && d.truncated ? 1 : result;
+}
+
+// m * 2^k, where m < 2^digits, and m >= 2^(digits-1) unless k is the
+// smallest exponent
+template <class T>
+inline T lcast_make_float(boost::uint64_t m, int k)
+{
+    typedef lcast_float_layout<T> layout;
+    typedef BOOST_DEDUCED_TYPENAME layout::bits_type bits_type;
+    const boost::uint64_t hidden_bit = boost::uint64_t(1) << (layout::digits - 1);
+    bits_type bits = static_cast<bits_type>(m & (hidden_bit - 1));
+    if (m & hidden_bit) {
+        bits |= static_cast<bits_type>(k + layout::digits - 1 + layout::max_exponent - 1) << (layout::digits - 1);
+    }
+    T result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+const int lcast_min_cached_k = -300;
+
+// Sets m * 2^k to mantissa * 10^exponent rounded to T, where mantissa is
+// too small by less than one if inexact, and returns false if the error
+// of the 64 bit arithmetic used means that could be the wrong way
+template <class T>
+inline bool lcast_approximate(boost::uint64_t mantissa, int exponent, bool inexact,
+        boost::uint64_t& m, int& k)
+{
+    typedef lcast_float_layout<T> layout;
+    const int cached_k_step = 8;
+
+    // The error is counted in eighths of the last bit
+    int error = inexact ? 8 : 0;
+    lcast_diyfp x = lcast_diyfp::normalize(lcast_diyfp(mantissa, 0), error);
+
+    const int index = (exponent - lcast_min_cached_k) / cached_k_step;
+    const lcast_cached_power& cached = lcast_get_cached_power(index);
+    const int adjustment = exponent - cached.k;
+    if (adjustment != 0) {
+        boost::uint64_t pow10 = 1;
+        for (int i = 0; i < adjustment; ++i) pow10 *= 10;
+        x = lcast_diyfp::mul(x, lcast_diyfp::normalize(lcast_diyfp(pow10, 0)));
+        error += 8;
+        x = lcast_diyfp::normalize(x, error);
+    }
+    x = lcast_diyfp::mul(x, lcast_diyfp((static_cast<boost::uint64_t>(cached.hi) << 32) | cached.lo, cached.e));
+    error += 16;
+    x = lcast_diyfp::normalize(x, error);
+
+    // Denormal numbers have fewer bits
+    const int min_k = layout::min_exponent - layout::digits;
+    int precision = layout::digits;
+    if (x.e + 64 - precision < min_k) precision = x.e + 64 - min_k;
+    const int dropped = 64 - precision;
+    if (precision <= 0 || dropped > 62) {
+        m = 0;
+        k = min_k;
+        return false;
+    }
+
+    const boost::uint64_t rest = x.f & ((boost::uint64_t(1) << dropped) - 1);
+    const boost::uint64_t half = boost::uint64_t(1) << (dropped - 1);
+    const boost::uint64_t units = static_cast<boost::uint64_t>((error + 7) / 8);
+    m = x.f >> dropped;
+    k = x.e + dropped;
+    if (rest > half) ++m;
+    if (m == boost::uint64_t(1) << layout::digits) {
+        m >>= 1;
+        ++k;
+    }
+    return rest + units < half || rest > half + units;
+}
+
+// Sets value to the decimal number d rounded to the nearest T, ties to
+// even, and returns false if it is too big for T
+template <class T>
+inline bool lcast_decimal_to_float(const lcast_decimal& d, T& value)
+{
+    typedef lcast_float_layout<T> layout;
+    value = 0;
+    if (d.size == 0) return true;
+    const int lead = d.exponent + static_cast<int>(d.size) - 1;
+    if (lead < layout::min_lead_pow10) return true;
+    if (lead > layout::max_lead_pow10) return false;
+
+    // As many digits as fit in 64 bits
+    const std::size_t head = d.size < d.head_digits ? d.size : d.head_digits;
+    const boost::uint64_t mantissa = d.head;
+    int exponent = d.exponent + static_cast<int>(d.size - head);
+
+    const boost::uint64_t max_exact = boost::uint64_t(1) << layout::digits;
+    if (head == d.size && !d.truncated && mantissa <= max_exact
+            && exponent >= -layout::max_exact_pow10 && exponent <= layout::max_exact_pow10) {
+        // Both are exact, so the result is correctly rounded
+        value = static_cast<T>(mantissa);
+        if (exponent < 0) value /= static_cast<T>(lcast_pow10(-exponent));
+        else value *= static_cast<T>(lcast_pow10(exponent));
+        return true;
+    }
+
+    const int min_k = layout::min_exponent - layout::digits;
+    const int max_k = layout::max_exponent - layout::digits;
+    const boost::uint64_t hidden_bit = max_exact >> 1;
+    boost::uint64_t m;
+    int k;
+
+    // Usually 64 bits are enough to tell how the number rounds...
+    if (exponent >= lcast_min_cached_k) {
+        if (lcast_approximate<T>(mantissa, exponent, head != d.size, m, k)) {
+            if (k > max_k) return false;
+            value = lcast_make_float<T>(m, k);
+            return true;
+        }
+        if (k > max_k) {
+            m = max_exact - 1;
+            k = max_k;
+        }
+    } else {
+        // ...and where they aren't, an estimate within a few units in the
+        // last place...
+        double estimate = static_cast<double>(mantissa);
+        for (; exponent < -22; exponent += 22) estimate /= 1e22;
+        estimate /= lcast_pow10(-exponent);
+        // ...as m * 2^k, with m < 2^digits...
+        const T rounded = static_cast<T>(estimate);
+        int e;
+        const double fraction = std::frexp(static_cast<double>(rounded), &e);
+        m = static_cast<boost::uint64_t>(std::ldexp(fraction, layout::digits));
+        k = e - layout::digits;
+        if (rounded == 0 || k < min_k) {
+            m >>= rounded == 0 ? 0 : min_k - k;
+            k = min_k;
+        }
+    }
+
+    // ...which is moved to the nearest neighbour until the halfway points
+    // to both neighbours are on either side of the decimal number
+    lcast_bignum digits(0);
+    for (std::size_t i = 0; i < d.size; i += 9) {
+        boost::uint32_t chunk = 0, scale = 1;
+        for (std::size_t j = i; j < i + 9 && j < d.size; ++j) {
+            chunk = chunk * 10 + d.digits[j];
+            scale *= 10;
+        }
+        digits.multiply_add(scale, chunk);
+    }
+    if (d.exponent > 0) digits.multiply_pow5(d.exponent);
+
+    for (;;) {
+        int c = lcast_compare(d, digits, 2 * m + 1, k - 1);
+        if (c > 0 || (c == 0 && (m & 1))) {
+            if (++m == max_exact) {
+                m = hidden_bit;
+                if (++k > max_k) return false;
+            }
+            continue;
+        }
+        if (m == 0) break;
+        const bool closer_below = m == hidden_bit && k > min_k;
+        c = closer_below ? lcast_compare(d, digits, 4 * m - 1, k - 2)
+                         : lcast_compare(d, digits, 2 * m - 1, k - 1);
+        if (c < 0 || (c == 0 && (m & 1))) {
+            if (closer_below) {
+                m = max_exact - 1;
+                --k;
+            } else {
+                --m;
+            }
+            continue;
+        }
+        break;
+    }
+    value = lcast_make_float<T>(m, k);
+    return true;
+}
+
+#else // BOOST_LCAST_NO_FAST_FLOAT
+
+// Without IEEE floating point, an approximation as good as long double
+// arithmetic allows
+template <class T>
+inline bool lcast_decimal_to_float(const lcast_decimal& d, T& value)
+{
+    const std::size_t head = d.size < d.head_digits ? d.size : d.head_digits;
+    const long double mantissa = static_cast<long double>(d.head);
+    const int exponent = d.exponent + static_cast<int>(d.size - head);
+    const long double result = std::pow(static_cast<long double>(10.0), exponent) * mantissa;
+    value = static_cast<T>(result);
+    return value <= (std::numeric_limits<T>::max)();
+}
+
+#endif // BOOST_LCAST_NO_FAST_FLOAT
+
+}}
+
+#endif // BOOST_DETAIL_LCAST_FLOAT_HPP_INCLUDED
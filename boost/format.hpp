@@ -48,6 +48,7 @@
 #include <boost/format/group.hpp>                   // class for grouping arguments
 #include <boost/format/feed_args.hpp>               // argument-feeding functions
 #include <boost/format/parsing.hpp>                 // format-string parsing (member-)functions
+#include <boost/format/compiled_format.hpp>         // format-strings parsed once
 
 // **** Implementation of the free functions ----------------------
 #include <boost/format/free_funcs.hpp>
@@ -0,0 +1,561 @@
+// ----------------------------------------------------------------------------
+// compiled_format.hpp :  format-strings parsed once, for repeated formatting
+// ----------------------------------------------------------------------------
+
+//  Copyright Samuel Krempp 2013. Use, modification, and distribution are
+//  subject to the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/format for library home page
+
+// ----------------------------------------------------------------------------
+
+#ifndef BOOST_FORMAT_COMPILED_FORMAT_HPP
+#define BOOST_FORMAT_COMPILED_FORMAT_HPP
+
+#include <cstdio>  // sprintf
+#include <cmath>   // fabs
+#include <vector>
+#include <string>
+#include <iterator>
+
+#include <boost/config.hpp>
+#include <boost/limits.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+
+#include <boost/format/format_class.hpp>
+#include <boost/format/exceptions.hpp>
+#include <boost/format/feed_args.hpp>
+
+#ifndef BOOST_FORMAT_COMPILED_MAX_ARGS
+#define BOOST_FORMAT_COMPILED_MAX_ARGS 10
+#endif
+
+namespace boost {
+namespace io {
+namespace detail {
+
+#ifdef BOOST_HAS_LONG_LONG
+    typedef ::boost::ulong_long_type  compiled_uint_t;
+#else
+    typedef unsigned long             compiled_uint_t;
+#endif
+
+    // big enough for any integer, and for the floating point values
+    // that are converted without a stream (see put_compiled_float)
+    const std::size_t compiled_buffer_size = 256;
+
+    // Input : the magnitude and sign of an integer of 'size' bytes,
+    //         and the flags of the stream it would be written to
+    // Effects : writes the characters a stream would write (without padding)
+    //           so that they end at end.
+    // Returns : the position of the first character
+    inline char* put_compiled_integer(char* end, compiled_uint_t u,
+                                      bool negative, bool is_signed,
+                                      std::size_t size,
+                                      std::ios_base::fmtflags f)
+    {
+        const std::ios_base::fmtflags base = f & std::ios_base::basefield;
+        char* p = end;
+        if(base == std::ios_base::hex || base == std::ios_base::oct) {
+            // negative values are written as their unsigned counterpart
+            if(negative) {
+                u = compiled_uint_t(0) - u;
+                if(size < sizeof(compiled_uint_t))
+                    u &= (compiled_uint_t(1) << (size * 8)) - 1;
+            }
+            const bool nonzero = u != 0;
+            if(base == std::ios_base::hex) {
+                const char* digits = (f & std::ios_base::uppercase) ?
+                    "0123456789ABCDEF" : "0123456789abcdef";
+                do { *--p = digits[u & 15]; u >>= 4; } while(u);
+                if((f & std::ios_base::showbase) && nonzero) {
+                    *--p = (f & std::ios_base::uppercase) ? 'X' : 'x';
+                    *--p = '0';
+                }
+            }
+            else {
+                do { *--p = static_cast<char>('0' + (u & 7)); u >>= 3; } while(u);
+                if((f & std::ios_base::showbase) && nonzero)
+                    *--p = '0';
+            }
+        }
+        else {
+            do { *--p = static_cast<char>('0' + u % 10); u /= 10; } while(u);
+            if(negative)
+                *--p = '-';
+            else if(is_signed && (f & std::ios_base::showpos))
+                *--p = '+';
+        }
+        return p;
+    }
+
+    // Input : the flags of a stream, and whether the value is a long double
+    // Effects : writes the printf conversion the stream would use,
+    //           taking the precision as an argument ("%.*g" and the like)
+    inline void compiled_float_conversion(char* p, std::ios_base::fmtflags f,
+                                          bool long_double)
+    {
+        const std::ios_base::fmtflags field = f & std::ios_base::floatfield;
+        const bool upper = (f & std::ios_base::uppercase) != 0;
+        *p++ = '%';
+        if(f & std::ios_base::showpos)
+            *p++ = '+';
+        if(f & std::ios_base::showpoint)
+            *p++ = '#';
+        *p++ = '.';
+        *p++ = '*';
+        if(long_double)
+            *p++ = 'L';
+        if(field == std::ios_base::fixed)
+            *p++ = 'f';
+        else if(field == std::ios_base::scientific)
+            *p++ = upper ? 'E' : 'e';
+        else
+            *p++ = upper ? 'G' : 'g';
+        *p = 0;
+    }
+
+    // Input : a floating point value, and the precision and flags of the
+    //         stream it would be written to
+    // Effects : writes the characters the stream would write (without
+    //           padding) into buf, which has compiled_buffer_size chars.
+    // Returns : the number of characters, or 0 if the value can't be written
+    //           in buf, and should be left to a stream.
+    template<class T>
+    std::size_t put_compiled_float(char* buf, T x, std::streamsize prec,
+                                   std::ios_base::fmtflags f)
+    {
+        using namespace std;
+        if(prec < 0)
+            prec = 6;
+        // stay well inside the buffer, and leave inf and nan to streams
+        if(prec > 100 || !(fabs(x) < 1e100))
+            return 0;
+        char conv[16];
+        compiled_float_conversion(conv, f, sizeof(T) != sizeof(double));
+        const int n =
+#if defined(_MSC_VER) && (_MSC_VER >= 1400) && !defined(__SGI_STL_PORT) && !defined(_STLPORT_VERSION)
+            sprintf_s(buf, compiled_buffer_size, conv, static_cast<int>(prec), x);
+#else
+            sprintf(buf, conv, static_cast<int>(prec), x);
+#endif
+        return n > 0 ? static_cast<std::size_t>(n) : 0;
+    }
+
+
+//---- compiled_arg  --------------------------------------------------------//
+
+//   one argument of a basic_compiled_format call.  Built-in types are
+//   written without a stream, the others (and the built-in types, in
+//   the rare cases where padding needs a stream) are passed to put(..)
+    template<class Ch, class Tr, class Alloc>
+    struct compiled_arg
+    {
+        typedef format_item<Ch, Tr, Alloc>                 format_item_t;
+        typedef ::std::basic_string<Ch, Tr, Alloc>         string_type;
+        typedef void (*put_type)(const compiled_arg& x, const format_item_t& specs,
+                                 string_type& res, locale_t* loc_p);
+        enum kind_values { integer_kind, float_kind, long_double_kind,
+                           char_kind, string_kind, other_kind };
+
+        template<class T>
+        compiled_arg(const T& x)
+            : kind_(other_kind), arg_(&x), put_(&put_value<T>) {}
+
+        compiled_arg(const bool& x)               { set_unsigned(x); signed_ = true; }
+        compiled_arg(const short& x)              { set_signed(x); }
+        compiled_arg(const unsigned short& x)     { set_unsigned(x); }
+        compiled_arg(const int& x)                { set_signed(x); }
+        compiled_arg(const unsigned int& x)       { set_unsigned(x); }
+        compiled_arg(const long& x)               { set_signed(x); }
+        compiled_arg(const unsigned long& x)      { set_unsigned(x); }
+#ifdef BOOST_HAS_LONG_LONG
+        compiled_arg(const ::boost::long_long_type& x)  { set_signed(x); }
+        compiled_arg(const ::boost::ulong_long_type& x) { set_unsigned(x); }
+#endif
+        compiled_arg(const float& x)
+            : kind_(float_kind), arg_(&x), put_(&put_value<float>) { d_ = x; }
+        compiled_arg(const double& x)
+            : kind_(float_kind), arg_(&x), put_(&put_value<double>) { d_ = x; }
+        compiled_arg(const long double& x)
+            : kind_(long_double_kind), arg_(&x), put_(&put_value<long double>)
+            { ld_ = x; }
+        compiled_arg(const char& x)
+            : kind_(char_kind), arg_(&x), put_(&put_value<char>) {}
+        compiled_arg(const Ch* x)                 { set_string(x, x ? Tr::length(x) : 0); }
+        compiled_arg(Ch* x)                       { set_string(x, x ? Tr::length(x) : 0); }
+        template<class Alloc2>
+        compiled_arg(const ::std::basic_string<Ch, Tr, Alloc2>& x)
+            { set_string(x.data(), x.size()); }
+
+        // --- data ---
+        int kind_;
+        const void* arg_;  //- the argument, for put(..)
+        put_type put_;
+        bool negative_;    //- for integer_kind : the sign,
+        bool signed_;      //  whether the type is signed,
+        std::size_t size_; //  and its size. For string_kind : the length
+        union {
+            compiled_uint_t u_;  //- magnitude of an integer
+            double d_;
+            long double ld_;
+            const Ch* str_;
+        };
+
+    private:
+        template<class T>
+        void set_signed(const T& x) {
+            kind_ = integer_kind; arg_ = &x; put_ = &put_value<T>;
+            negative_ = x < 0; signed_ = true; size_ = sizeof(T);
+            u_ = static_cast<compiled_uint_t>(x);
+            if(negative_)
+                u_ = compiled_uint_t(0) - u_;
+        }
+        template<class T>
+        void set_unsigned(const T& x) {
+            kind_ = integer_kind; arg_ = &x; put_ = &put_value<T>;
+            negative_ = false; signed_ = false; size_ = sizeof(T);
+            u_ = x;
+        }
+        void set_string(const Ch* s, std::size_t n) {
+            kind_ = string_kind; arg_ = 0; put_ = &put_string;
+            str_ = s; size_ = n;
+        }
+
+        template<class T>
+        static void put_value(const compiled_arg& x, const format_item_t& specs,
+                              string_type& res, locale_t* loc_p) {
+            typename basic_format<Ch, Tr, Alloc>::internal_streambuf_t buf;
+            put<Ch, Tr, Alloc, const T&>(*static_cast<const T*>(x.arg_),
+                                         specs, res, buf, loc_p);
+        }
+        static void put_string(const compiled_arg& x, const format_item_t& specs,
+                               string_type& res, locale_t* loc_p) {
+            const string_type s(x.str_, x.size_);
+            typename basic_format<Ch, Tr, Alloc>::internal_streambuf_t buf;
+            put<Ch, Tr, Alloc, const string_type&>(s, specs, res, buf, loc_p);
+        }
+    };
+
+} // namespace detail
+} // namespace io
+
+
+//---- basic_compiled_format ------------------------------------------------//
+
+//   a format-string parsed once, and then used for any number of calls,
+//   possibly from several threads : it is never modified by formatting.
+//   The arguments are passed all at once, to str(..) or write(..), and
+//   the result is written without going through a stream when the
+//   arguments are of built-in types.
+    template<class Ch, class Tr, class Alloc>
+    class basic_compiled_format
+    {
+    public:
+        typedef Ch  CharT;
+        typedef std::basic_string<Ch, Tr, Alloc>              string_type;
+        typedef typename string_type::size_type               size_type;
+        typedef io::detail::format_item<Ch, Tr, Alloc>        format_item_t;
+        typedef io::detail::compiled_arg<Ch, Tr, Alloc>       arg_type;
+
+        explicit basic_compiled_format(const Ch* str);
+        explicit basic_compiled_format(const string_type& s);
+#if !defined(BOOST_NO_STD_LOCALE)
+        basic_compiled_format(const Ch* str, const std::locale & loc);
+        basic_compiled_format(const string_type& s, const std::locale & loc);
+#endif
+        io::detail::locale_t getloc() const { return loc_; }
+
+        // The total number of arguments expected by str(..) and write(..)
+        int expected_args() const { return num_args_; }
+
+        // ** formatting ** //
+        // write(out, x1, .., xN) writes the result to the output iterator
+        // out and returns its end, str(x1, .., xN) returns it as a string.
+        // Both take from 0 to BOOST_FORMAT_COMPILED_MAX_ARGS arguments.
+        template<class OutIter>
+        OutIter write(OutIter out) const
+            { return write_args(out, 0, 0); }
+        string_type str() const
+            { return str_args(0, 0); }
+
+#define BOOST_FORMAT_COMPILED_ARG(z, n, data) arg_type(x##n)
+#define BOOST_FORMAT_COMPILED_CALL(z, n, data)                              \
+        template<class OutIter, BOOST_PP_ENUM_PARAMS(n, class T)>           \
+        OutIter write(OutIter out,                                          \
+                      BOOST_PP_ENUM_BINARY_PARAMS(n, const T, & x)) const { \
+            const arg_type args[n] = {                                      \
+                BOOST_PP_ENUM_ ## z(n, BOOST_FORMAT_COMPILED_ARG, ~) };     \
+            return write_args(out, args, n);                                \
+        }                                                                   \
+        template<BOOST_PP_ENUM_PARAMS(n, class T)>                          \
+        string_type str(BOOST_PP_ENUM_BINARY_PARAMS(n, const T, & x)) const { \
+            const arg_type args[n] = {                                      \
+                BOOST_PP_ENUM_ ## z(n, BOOST_FORMAT_COMPILED_ARG, ~) };     \
+            return str_args(args, n);                                       \
+        }
+
+        BOOST_PP_REPEAT_FROM_TO(1, BOOST_PP_INC(BOOST_FORMAT_COMPILED_MAX_ARGS),
+                                BOOST_FORMAT_COMPILED_CALL, ~)
+
+#undef BOOST_FORMAT_COMPILED_CALL
+#undef BOOST_FORMAT_COMPILED_ARG
+
+        // same as write(out, x1, .., xN), with the arguments in an array
+        template<class OutIter>
+        OutIter write_args(OutIter out, const arg_type* args, int n) const;
+        string_type str_args(const arg_type* args, int n) const;
+
+    private:
+        void init(const basic_format<Ch, Tr, Alloc>& f);
+        void widen(const char* beg, const char* end, Ch* dst) const;
+
+        template<class OutIter>
+        OutIter put(OutIter out, const arg_type& x, const format_item_t& specs,
+                    std::size_t& count) const;
+
+        template<class OutIter>
+        static OutIter put_chars(OutIter out, const Ch* s, std::size_t n,
+                                 std::size_t& count) {
+            count += n;
+            return std::copy(s, s + n, out);
+        }
+        template<class OutIter>
+        static OutIter put_fill(OutIter out, Ch c, std::size_t n,
+                                std::size_t& count) {
+            count += n;
+            for(; n > 0; --n)
+                *out++ = c;
+            return out;
+        }
+
+        // member data --------------------------------------------//
+        std::vector<format_item_t>  items_; // each '%..' directive leads to a format_item
+        string_type      prefix_; // piece of string to insert before first item
+        int            num_args_; // number of expected arguments
+        io::detail::locale_t loc_; // the global locale at construction, if none given
+#if !defined(BOOST_NO_STD_LOCALE)
+        const std::ctype<Ch>* fac_;
+#endif
+        bool       fast_numbers_; // false if the locale groups digits, or uses a
+                                  // decimal point other than '.'
+        Ch plus_, minus_, space_, zero_, x_, X_;
+    }; // class basic_compiled_format
+
+
+// ---  basic_compiled_format implementation --------------------------------//
+
+    template<class Ch, class Tr, class Alloc>
+    basic_compiled_format<Ch, Tr, Alloc>:: basic_compiled_format(const Ch* s)
+        : num_args_(0)
+    {
+        init(basic_format<Ch, Tr, Alloc>(s));
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    basic_compiled_format<Ch, Tr, Alloc>:: basic_compiled_format(const string_type& s)
+        : num_args_(0)
+    {
+        init(basic_format<Ch, Tr, Alloc>(s));
+    }
+
+#if !defined(BOOST_NO_STD_LOCALE)
+    template<class Ch, class Tr, class Alloc>
+    basic_compiled_format<Ch, Tr, Alloc>::
+    basic_compiled_format(const Ch* s, const std::locale & loc)
+        : num_args_(0), loc_(loc)
+    {
+        init(basic_format<Ch, Tr, Alloc>(s, loc));
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    basic_compiled_format<Ch, Tr, Alloc>::
+    basic_compiled_format(const string_type& s, const std::locale & loc)
+        : num_args_(0), loc_(loc)
+    {
+        init(basic_format<Ch, Tr, Alloc>(s, loc));
+    }
+#endif // ! BOOST_NO_STD_LOCALE
+
+    template<class Ch, class Tr, class Alloc>
+    void basic_compiled_format<Ch, Tr, Alloc>::
+    init (const basic_format<Ch, Tr, Alloc>& f) {
+        // the format-string is parsed by basic_format, we keep the result
+        items_ = f.items_;
+        prefix_ = f.prefix_;
+        num_args_ = f.num_args_;
+#if !defined(BOOST_NO_STD_LOCALE)
+        fac_ = & BOOST_USE_FACET(std::ctype<Ch>, loc_);
+        const std::numpunct<Ch>& np = BOOST_USE_FACET(std::numpunct<Ch>, loc_);
+        fast_numbers_ = np.grouping().empty() && np.decimal_point() == fac_->widen('.');
+#else
+        fast_numbers_ = true;
+#endif
+        const char chars[] = "+- 0xX";
+        Ch wide[sizeof(chars)];
+        widen(chars, chars + sizeof(chars) - 1, wide);
+        plus_ = wide[0]; minus_ = wide[1]; space_ = wide[2];
+        zero_ = wide[3]; x_ = wide[4]; X_ = wide[5];
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    void basic_compiled_format<Ch, Tr, Alloc>::
+    widen (const char* beg, const char* end, Ch* dst) const {
+#if !defined(BOOST_NO_STD_LOCALE)
+        fac_->widen(beg, end, dst);
+#else
+        io::basic_oaltstringstream<Ch, Tr, Alloc> fac;
+        for(; beg != end; ++beg, ++dst)
+            *dst = fac.widen(*beg);
+#endif
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    typename basic_compiled_format<Ch, Tr, Alloc>::string_type
+    basic_compiled_format<Ch, Tr, Alloc>::
+    str_args (const arg_type* args, int n) const {
+        string_type res;
+        res.reserve(prefix_.size() + 16 * items_.size());
+        write_args(std::back_inserter(res), args, n);
+        return res;
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    template<class OutIter>
+    OutIter basic_compiled_format<Ch, Tr, Alloc>::
+    write_args (OutIter out, const arg_type* args, int n) const {
+        if(n < num_args_)
+            boost::throw_exception(io::too_few_args(n, num_args_));
+        if(n > num_args_)
+            boost::throw_exception(io::too_many_args(n, num_args_));
+
+        std::size_t count = 0; // characters written, for tabulations
+        out = put_chars(out, prefix_.data(), prefix_.size(), count);
+        for(unsigned long i=0; i < items_.size(); ++i) {
+            const format_item_t& item = items_[i];
+            if(item.argN_ >= 0)
+                out = put(out, args[item.argN_], item, count);
+            else if(item.argN_ == format_item_t::argN_tabulation) {
+                if(static_cast<std::size_t>(item.fmtstate_.width_) > count)
+                    out = put_fill(out, item.fmtstate_.fill_,
+                                   static_cast<std::size_t>(item.fmtstate_.width_) - count,
+                                   count);
+            }
+            out = put_chars(out, item.appendix_.data(), item.appendix_.size(), count);
+        }
+        return out;
+    }
+
+    template<class Ch, class Tr, class Alloc>
+    template<class OutIter>
+    OutIter basic_compiled_format<Ch, Tr, Alloc>::
+    put (OutIter out, const arg_type& x, const format_item_t& specs,
+         std::size_t& count) const {
+        // does what io::detail::put(..) does, without a stream
+
+        const std::ios_base::fmtflags fl = specs.fmtstate_.flags_;
+        const std::streamsize w = specs.fmtstate_.width_;
+        const bool internal = (fl & std::ios_base::internal) != 0;
+        const Ch fill = specs.fmtstate_.fill_ != 0 ? specs.fmtstate_.fill_ : space_;
+
+        char cbuf[io::detail::compiled_buffer_size];
+        Ch buf[io::detail::compiled_buffer_size];
+        const Ch* beg = buf;
+        std::size_t size = 0;
+        bool direct = true;
+        // internal padding with space-padding or truncation is left to put(..)
+        if(internal && w != 0 &&
+           ((specs.pad_scheme_ & format_item_t::spacepad) ||
+            specs.truncate_ != format_item_t::max_streamsize()))
+            direct = false;
+        else switch(x.kind_) {
+        case arg_type::integer_kind:
+            if(fast_numbers_) {
+                char* end = cbuf + io::detail::compiled_buffer_size;
+                char* p = io::detail::put_compiled_integer(end, x.u_, x.negative_,
+                                                           x.signed_, x.size_, fl);
+                widen(p, end, buf);
+                size = end - p;
+            }
+            else
+                direct = false;
+            break;
+        case arg_type::float_kind:
+        case arg_type::long_double_kind:
+            if(fast_numbers_) {
+                const std::streamsize prec = specs.fmtstate_.precision_;
+                size = x.kind_ == arg_type::float_kind ?
+                    io::detail::put_compiled_float(cbuf, x.d_, prec, fl) :
+                    io::detail::put_compiled_float(cbuf, x.ld_, prec, fl);
+                widen(cbuf, cbuf + size, buf);
+            }
+            direct = size != 0;
+            break;
+        case arg_type::char_kind:
+            widen(static_cast<const char*>(x.arg_), static_cast<const char*>(x.arg_) + 1, buf);
+            size = 1;
+            break;
+        case arg_type::string_kind:
+            beg = x.str_;
+            size = x.size_;
+            break;
+        default:
+            direct = false;
+        }
+
+        if(! direct) {
+            string_type res;
+            x.put_(x, specs, res, const_cast<io::detail::locale_t*>(&loc_));
+            return put_chars(out, res.data(), res.size(), count);
+        }
+
+        if(internal && w != 0) {
+            // the padding goes after the sign or the base, as in streams
+            std::size_t split = 0;
+            if(x.kind_ != arg_type::string_kind && x.kind_ != arg_type::char_kind && size > 0) {
+                if(beg[0] == plus_ || beg[0] == minus_)
+                    split = 1;
+                else if(size > 1 && beg[0] == zero_ && (beg[1] == x_ || beg[1] == X_))
+                    split = 2;
+            }
+            if(w > 0 && static_cast<std::size_t>(w) > size) {
+                out = put_chars(out, beg, split, count);
+                out = put_fill(out, fill, static_cast<std::size_t>(w) - size, count);
+                return put_chars(out, beg + split, size - split, count);
+            }
+            return put_chars(out, beg, size, count);
+        }
+
+        // the same steps as put(..) and mk_str(..)
+        Ch prefix_space = 0;
+        if(specs.pad_scheme_ & format_item_t::spacepad)
+            if(size == 0 || (beg[0] != plus_ && beg[0] != minus_))
+                prefix_space = space_;
+        size = (std::min)(static_cast<std::size_t>(specs.truncate_ - !!prefix_space), size);
+        std::size_t n_before = 0, n_after = 0;
+        if(w > 0 && static_cast<std::size_t>(w) > size) {
+            const std::size_t n = static_cast<std::size_t>(w) - size - !!prefix_space;
+            if(specs.pad_scheme_ & format_item_t::centered)
+                n_after = n/2, n_before = n - n_after;
+            else if(fl & std::ios_base::left)
+                n_after = n;
+            else
+                n_before = n;
+        }
+        out = put_fill(out, fill, n_before, count);
+        if(prefix_space)
+            out = put_fill(out, prefix_space, 1, count);
+        out = put_chars(out, beg, size, count);
+        return put_fill(out, fill, n_after, count);
+    }
+
+} // namespace boost
+
+
+#endif // BOOST_FORMAT_COMPILED_FORMAT_HPP
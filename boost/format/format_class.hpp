@@ -139,6 +139,9 @@ namespace boost {
         basic_format<Ch2, Tr2, Alloc2>&  
         io::detail::bind_arg_body (basic_format<Ch2, Tr2, Alloc2>&, int, const T&);
 
+        template<class Ch2, class Tr2, class Alloc2>
+        friend class basic_compiled_format;
+
     private:
 #endif
         typedef io::detail::stream_format_state<Ch, Tr>  stream_format_state;
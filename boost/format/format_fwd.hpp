@@ -29,11 +29,21 @@ namespace boost {
 #endif
     class basic_format;
 
+    template <class Ch, 
+#if !( BOOST_WORKAROUND(__GNUC__, <3) && !defined(__SGI_STL_PORT) && !defined(_STLPORT_VERSION) )
+        class Tr = BOOST_IO_STD char_traits<Ch>, class Alloc = std::allocator<Ch> > 
+#else
+        class Tr = std::string_char_traits<Ch>, class Alloc = std::alloc > 
+#endif
+    class basic_compiled_format;
+
     typedef basic_format<char >     format;
+    typedef basic_compiled_format<char >  compiled_format;
 
 #if !defined(BOOST_NO_STD_WSTRING)  && !defined(BOOST_NO_STD_WSTREAMBUF) \
     && !defined(BOOST_FORMAT_IGNORE_STRINGSTREAM)
     typedef basic_format<wchar_t >  wformat;
+    typedef basic_compiled_format<wchar_t >  wcompiled_format;
 #endif
 
     namespace io {
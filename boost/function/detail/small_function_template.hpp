@@ -0,0 +1,311 @@
+// Boost.Function library
+
+//  Copyright Douglas Gregor 2001-2006
+//  Use, modification and distribution is subject to the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org/libs/function
+
+// Note: this header is a header template and must NOT have multiple-inclusion
+// protection.
+#if !defined(BOOST_PP_IS_ITERATING)
+# error Boost.Function - do not include this file!
+#endif
+
+#if defined(BOOST_MSVC)
+#   pragma warning( push )
+#   pragma warning( disable : 4127 ) // "conditional expression is constant"
+#endif
+
+#define BOOST_SMALL_FUNCTION_NUM_ARGS BOOST_PP_ITERATION()
+
+#define BOOST_SMALL_FUNCTION_TEMPLATE_PARMS BOOST_PP_ENUM_PARAMS(BOOST_SMALL_FUNCTION_NUM_ARGS, typename T)
+
+#define BOOST_SMALL_FUNCTION_TEMPLATE_ARGS BOOST_PP_ENUM_PARAMS(BOOST_SMALL_FUNCTION_NUM_ARGS, T)
+
+#define BOOST_SMALL_FUNCTION_PARM(J,I,D) BOOST_PP_CAT(T,I) BOOST_PP_CAT(a,I)
+
+#define BOOST_SMALL_FUNCTION_PARMS BOOST_PP_ENUM(BOOST_SMALL_FUNCTION_NUM_ARGS,BOOST_SMALL_FUNCTION_PARM,BOOST_PP_EMPTY)
+
+// Arguments taken by value are moved on to the target when possible
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+#  define BOOST_SMALL_FUNCTION_ARG(J,I,D) static_cast<BOOST_PP_CAT(T,I)&&>(BOOST_PP_CAT(a,I))
+#else
+#  define BOOST_SMALL_FUNCTION_ARG(J,I,D) BOOST_PP_CAT(a,I)
+#endif
+
+#define BOOST_SMALL_FUNCTION_ARGS BOOST_PP_ENUM(BOOST_SMALL_FUNCTION_NUM_ARGS,BOOST_SMALL_FUNCTION_ARG,BOOST_PP_EMPTY)
+
+#define BOOST_SMALL_FUNCTION_ARG_TYPE(J,I,D) \
+  typedef BOOST_PP_CAT(T,I) BOOST_PP_CAT(BOOST_PP_CAT(arg, BOOST_PP_INC(I)),_type);
+
+#define BOOST_SMALL_FUNCTION_ARG_TYPES BOOST_PP_REPEAT(BOOST_SMALL_FUNCTION_NUM_ARGS,BOOST_SMALL_FUNCTION_ARG_TYPE,BOOST_PP_EMPTY)
+
+// Comma if nonzero number of arguments
+#if BOOST_SMALL_FUNCTION_NUM_ARGS == 0
+#  define BOOST_SMALL_FUNCTION_COMMA
+#else
+#  define BOOST_SMALL_FUNCTION_COMMA ,
+#endif // BOOST_SMALL_FUNCTION_NUM_ARGS > 0
+
+// Class names used in this version of the code
+#define BOOST_SMALL_FUNCTION_INVOKER \
+  BOOST_JOIN(small_function_obj_invoker,BOOST_SMALL_FUNCTION_NUM_ARGS)
+#define BOOST_SMALL_FUNCTION_VOID_INVOKER \
+  BOOST_JOIN(small_function_void_obj_invoker,BOOST_SMALL_FUNCTION_NUM_ARGS)
+#define BOOST_SMALL_FUNCTION_VTABLE \
+  BOOST_JOIN(small_vtable,BOOST_SMALL_FUNCTION_NUM_ARGS)
+
+namespace boost {
+  namespace detail {
+    namespace function {
+      template<
+        typename Functor,
+        std::size_t BufferSize,
+        bool Inline,
+        typename R BOOST_SMALL_FUNCTION_COMMA
+        BOOST_SMALL_FUNCTION_TEMPLATE_PARMS
+        >
+      struct BOOST_SMALL_FUNCTION_INVOKER
+      {
+        static R invoke(small_function_buffer<BufferSize>& buffer BOOST_SMALL_FUNCTION_COMMA
+                        BOOST_SMALL_FUNCTION_PARMS)
+        {
+          Functor* f = Inline? reinterpret_cast<Functor*>(&buffer.data)
+                             : static_cast<Functor*>(buffer.obj_ptr);
+          return small_function_target(*f)(BOOST_SMALL_FUNCTION_ARGS);
+        }
+      };
+
+      template<
+        typename Functor,
+        std::size_t BufferSize,
+        bool Inline,
+        typename R BOOST_SMALL_FUNCTION_COMMA
+        BOOST_SMALL_FUNCTION_TEMPLATE_PARMS
+        >
+      struct BOOST_SMALL_FUNCTION_VOID_INVOKER
+      {
+        static void invoke(small_function_buffer<BufferSize>& buffer BOOST_SMALL_FUNCTION_COMMA
+                           BOOST_SMALL_FUNCTION_PARMS)
+        {
+          Functor* f = Inline? reinterpret_cast<Functor*>(&buffer.data)
+                             : static_cast<Functor*>(buffer.obj_ptr);
+          small_function_target(*f)(BOOST_SMALL_FUNCTION_ARGS);
+        }
+      };
+
+      /**
+       * The vtable of a boost::small_function: the manager shared by
+       * all signatures followed by the invoker for this one.
+       */
+      template<typename R BOOST_SMALL_FUNCTION_COMMA
+               BOOST_SMALL_FUNCTION_TEMPLATE_PARMS, std::size_t BufferSize>
+      struct BOOST_SMALL_FUNCTION_VTABLE
+      {
+        typedef R (*invoker_type)(small_function_buffer<BufferSize>&
+                                  BOOST_SMALL_FUNCTION_COMMA
+                                  BOOST_SMALL_FUNCTION_TEMPLATE_ARGS);
+
+        small_vtable_base<BufferSize> base;
+        invoker_type invoker;
+      };
+    } // end namespace function
+  } // end namespace detail
+
+  template<typename R BOOST_SMALL_FUNCTION_COMMA
+           BOOST_SMALL_FUNCTION_TEMPLATE_PARMS, std::size_t BufferSize>
+  class small_function<R (BOOST_SMALL_FUNCTION_TEMPLATE_ARGS), BufferSize>
+    : public detail::function::small_function_base<BufferSize>
+  {
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(small_function)
+
+    typedef detail::function::small_function_base<BufferSize> base_type;
+    typedef detail::function::BOOST_SMALL_FUNCTION_VTABLE<
+              R BOOST_SMALL_FUNCTION_COMMA BOOST_SMALL_FUNCTION_TEMPLATE_ARGS,
+              BufferSize>
+      vtable_type;
+
+    struct clear_type {};
+
+  public:
+    typedef R         result_type;
+    typedef small_function self_type;
+
+    BOOST_STATIC_CONSTANT(int, arity = BOOST_SMALL_FUNCTION_NUM_ARGS);
+    BOOST_SMALL_FUNCTION_ARG_TYPES
+
+    small_function() BOOST_NOEXCEPT : base_type() { }
+
+    // Function objects are taken by value and moved into place, so
+    // move-only function objects can be passed as rvalues.
+    template<typename Functor>
+    small_function(Functor f,
+                   typename enable_if_c<
+                            (boost::type_traits::ice_not<
+                             (is_integral<Functor>::value)>::value),
+                                        int>::type = 0) :
+      base_type()
+    {
+      this->assign_to(f);
+    }
+
+    small_function(clear_type*) BOOST_NOEXCEPT : base_type() { }
+
+    small_function(BOOST_RV_REF(small_function) f) BOOST_NOEXCEPT : base_type()
+    {
+      this->move_assign(f);
+    }
+
+    small_function& operator=(BOOST_RV_REF(small_function) f) BOOST_NOEXCEPT
+    {
+      if (&f != this)
+        this->move_assign(f);
+      return *this;
+    }
+
+    template<typename Functor>
+    typename enable_if_c<
+               (boost::type_traits::ice_not<
+                 (is_integral<Functor>::value)>::value),
+               small_function&>::type
+    operator=(Functor f)
+    {
+      small_function tmp(boost::move(f));
+      this->move_assign(tmp);
+      return *this;
+    }
+
+    small_function& operator=(clear_type*) BOOST_NOEXCEPT
+    {
+      this->clear();
+      return *this;
+    }
+
+    void swap(small_function& other) BOOST_NOEXCEPT
+    {
+      this->swap_base(other);
+    }
+
+    result_type operator()(BOOST_SMALL_FUNCTION_PARMS) const
+    {
+      if (this->empty())
+        boost::throw_exception(bad_function_call());
+
+      return reinterpret_cast<const vtable_type*>(this->get_vtable())
+               ->invoker(this->functor BOOST_SMALL_FUNCTION_COMMA BOOST_SMALL_FUNCTION_ARGS);
+    }
+
+  private:
+    struct dummy {
+      void nonnull() {}
+    };
+
+    typedef void (dummy::*safe_bool)();
+
+  public:
+    operator safe_bool () const
+      { return (this->empty())? 0 : &dummy::nonnull; }
+
+    bool operator!() const
+      { return this->empty(); }
+
+  private:
+    template<typename Functor>
+    void assign_to(Functor& f)
+    {
+      typedef typename detail::function::get_function_tag<Functor>::type tag;
+      this->assign_to(f, tag());
+    }
+
+    template<typename FunctionPtr>
+    void assign_to(FunctionPtr& f, detail::function::function_ptr_tag)
+    {
+      if (f)
+        this->store(f);
+    }
+
+#if BOOST_SMALL_FUNCTION_NUM_ARGS > 0
+    template<typename MemberPtr>
+    void assign_to(MemberPtr& f, detail::function::member_ptr_tag)
+    {
+      if (f)
+        this->assign_mem_fn(boost::mem_fn(f));
+    }
+
+    template<typename MemFn>
+    void assign_mem_fn(MemFn f)
+    {
+      this->store(f);
+    }
+#endif // BOOST_SMALL_FUNCTION_NUM_ARGS > 0
+
+    template<typename FunctionObj>
+    void assign_to(FunctionObj& f, detail::function::function_obj_tag)
+    {
+      this->store(f);
+    }
+
+    template<typename FunctionObj>
+    void assign_to(FunctionObj& f, detail::function::function_obj_ref_tag)
+    {
+      this->store(f);
+    }
+
+    template<typename Functor>
+    void store(Functor& f)
+    {
+      using detail::function::small_function_allows_inline;
+
+      typedef mpl::bool_<(small_function_allows_inline<Functor, BufferSize>::value)>
+        is_inline;
+      typedef typename mpl::if_c<(is_void<R>::value),
+                         detail::function::BOOST_SMALL_FUNCTION_VOID_INVOKER<
+                           Functor, BufferSize, is_inline::value,
+                           R BOOST_SMALL_FUNCTION_COMMA BOOST_SMALL_FUNCTION_TEMPLATE_ARGS>,
+                         detail::function::BOOST_SMALL_FUNCTION_INVOKER<
+                           Functor, BufferSize, is_inline::value,
+                           R BOOST_SMALL_FUNCTION_COMMA BOOST_SMALL_FUNCTION_TEMPLATE_ARGS>
+                       >::type
+        invoker_type;
+
+      // Note: it is extremely important that this initialization use
+      // static initialization. Otherwise, we will have a race
+      // condition here in multi-threaded code. See
+      // http://thread.gmane.org/gmane.comp.lib.boost.devel/164902/.
+      static const vtable_type stored_vtable =
+        { { &detail::function::small_functor_manager<Functor, BufferSize>::manage },
+          &invoker_type::invoke };
+
+      this->assign_functor(f, &stored_vtable.base, is_inline());
+    }
+  };
+
+  template<typename R BOOST_SMALL_FUNCTION_COMMA
+           BOOST_SMALL_FUNCTION_TEMPLATE_PARMS, std::size_t BufferSize>
+  inline void swap(small_function<R (BOOST_SMALL_FUNCTION_TEMPLATE_ARGS), BufferSize>& f1,
+                   small_function<R (BOOST_SMALL_FUNCTION_TEMPLATE_ARGS), BufferSize>& f2)
+  {
+    f1.swap(f2);
+  }
+} // end namespace boost
+
+// Cleanup after ourselves...
+#undef BOOST_SMALL_FUNCTION_VTABLE
+#undef BOOST_SMALL_FUNCTION_VOID_INVOKER
+#undef BOOST_SMALL_FUNCTION_INVOKER
+#undef BOOST_SMALL_FUNCTION_COMMA
+#undef BOOST_SMALL_FUNCTION_ARG_TYPES
+#undef BOOST_SMALL_FUNCTION_ARG_TYPE
+#undef BOOST_SMALL_FUNCTION_ARGS
+#undef BOOST_SMALL_FUNCTION_ARG
+#undef BOOST_SMALL_FUNCTION_PARMS
+#undef BOOST_SMALL_FUNCTION_PARM
+#undef BOOST_SMALL_FUNCTION_TEMPLATE_ARGS
+#undef BOOST_SMALL_FUNCTION_TEMPLATE_PARMS
+#undef BOOST_SMALL_FUNCTION_NUM_ARGS
+
+#if defined(BOOST_MSVC)
+#   pragma warning( pop )
+#endif
@@ -0,0 +1,367 @@
+// Boost.Function library
+
+//  Copyright Douglas Gregor 2001-2006
+//  Use, modification and distribution is subject to the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org/libs/function
+
+#ifndef BOOST_FUNCTION_SMALL_FUNCTION_HPP
+#define BOOST_FUNCTION_SMALL_FUNCTION_HPP
+
+#include <cstddef>
+#include <new>
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/detail/sp_typeinfo.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/type_with_alignment.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/has_nothrow_copy.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_void.hpp>
+#include <boost/type_traits/ice.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/move/move.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/ref.hpp>
+#include <boost/mem_fn.hpp>
+#include <boost/function/function_base.hpp>
+#include <boost/preprocessor/iterate.hpp>
+#include <boost/preprocessor/enum.hpp>
+#include <boost/preprocessor/enum_params.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/inc.hpp>
+#include <boost/preprocessor/repeat.hpp>
+#include <boost/preprocessor/facilities/empty.hpp>
+
+#if !defined(BOOST_NO_CXX11_NOEXCEPT) && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#  include <boost/utility/declval.hpp>
+#endif
+
+#ifndef BOOST_FUNCTION_MAX_ARGS
+#  define BOOST_FUNCTION_MAX_ARGS 10
+#endif // BOOST_FUNCTION_MAX_ARGS
+
+// Default size, in bytes, of the inline buffer of boost::small_function.
+#ifndef BOOST_FUNCTION_SMALL_BUFFER_SIZE
+#  define BOOST_FUNCTION_SMALL_BUFFER_SIZE (4 * sizeof(void*))
+#endif
+
+namespace boost {
+  template<typename Signature,
+           std::size_t BufferSize = BOOST_FUNCTION_SMALL_BUFFER_SIZE>
+  class small_function;
+
+  namespace detail {
+    namespace function {
+      /**
+       * The buffer of a boost::small_function. Function objects that
+       * fit in BufferSize bytes and cannot throw when moved are
+       * stored in data; all others are allocated on the heap and
+       * only obj_ptr is used.
+       */
+      template<std::size_t BufferSize>
+      union small_function_buffer
+      {
+        mutable void* obj_ptr;
+        mutable char data[BufferSize];
+        boost::detail::max_align align;
+      };
+
+      /**
+       * Determine whether moving an F is known not to throw. Only such
+       * objects are stored in the inline buffer, so that moving a
+       * small_function never throws and never allocates.
+       */
+      template<typename F>
+      struct small_function_nothrow_move
+      {
+#if !defined(BOOST_NO_CXX11_NOEXCEPT) && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        BOOST_STATIC_CONSTANT
+          (bool,
+           value = (has_trivial_copy<F>::value
+                    || noexcept(F(boost::declval<F>()))));
+#else
+        BOOST_STATIC_CONSTANT
+          (bool,
+           value = (has_trivial_copy<F>::value
+                    || has_nothrow_copy<F>::value));
+#endif
+      };
+
+      /**
+       * Determine if boost::small_function can store the function
+       * object type F in a BufferSize byte buffer.
+       */
+      template<typename F, std::size_t BufferSize>
+      struct small_function_allows_inline
+      {
+        BOOST_STATIC_CONSTANT
+          (bool,
+           value = ((sizeof(F) <= BufferSize &&
+                     (alignment_of<small_function_buffer<BufferSize> >::value
+                      % alignment_of<F>::value == 0) &&
+                     small_function_nothrow_move<F>::value)));
+      };
+
+      /**
+       * Inline objects that can be moved with a byte copy and need no
+       * destruction. The low bit of the vtable pointer of the
+       * small_function is set for them, as in boost::function.
+       */
+      template<typename F, std::size_t BufferSize>
+      struct small_function_is_trivial
+      {
+        BOOST_STATIC_CONSTANT
+          (bool,
+           value = (small_function_allows_inline<F, BufferSize>::value &&
+                    has_trivial_copy<F>::value &&
+                    has_trivial_destructor<F>::value));
+      };
+
+      // The object to call: the stored function object itself, or the
+      // object referred to by a stored reference_wrapper.
+      template<typename F>
+      inline F& small_function_target(F& f) { return f; }
+
+      template<typename F>
+      inline F& small_function_target(reference_wrapper<F>& f) { return f.get(); }
+
+      /**
+       * The small_functor_manager class contains a static function
+       * "manage" which can move or destroy the stored function
+       * object, report its type or return its address. Only
+       * move_functor_tag, destroy_functor_tag, check_functor_type_tag
+       * and get_functor_type_tag are used.
+       */
+      template<typename Functor, std::size_t BufferSize>
+      struct small_functor_manager
+      {
+      private:
+        typedef Functor functor_type;
+        typedef small_function_buffer<BufferSize> buffer_type;
+
+        // Function objects stored in the inline buffer.
+        static inline void*
+        manager(buffer_type& in_buffer, buffer_type* out_buffer,
+                functor_manager_operation_type op, mpl::true_)
+        {
+          functor_type* f = reinterpret_cast<functor_type*>(&in_buffer.data);
+
+          if (op == move_functor_tag) {
+            new (reinterpret_cast<void*>(&out_buffer->data))
+              functor_type(boost::move(*f));
+            f->~Functor();
+          } else if (op == destroy_functor_tag) {
+            f->~Functor();
+          } else /* op == check_functor_type_tag */ {
+            return f;
+          }
+          return 0;
+        }
+
+        // Function objects that require heap allocation
+        static inline void*
+        manager(buffer_type& in_buffer, buffer_type* out_buffer,
+                functor_manager_operation_type op, mpl::false_)
+        {
+          if (op == move_functor_tag) {
+            out_buffer->obj_ptr = in_buffer.obj_ptr;
+            in_buffer.obj_ptr = 0;
+          } else if (op == destroy_functor_tag) {
+            delete static_cast<functor_type*>(in_buffer.obj_ptr);
+            in_buffer.obj_ptr = 0;
+          } else /* op == check_functor_type_tag */ {
+            return in_buffer.obj_ptr;
+          }
+          return 0;
+        }
+
+      public:
+        static inline void*
+        manage(buffer_type& in_buffer, buffer_type* out_buffer,
+               functor_manager_operation_type op)
+        {
+          if (op == get_functor_type_tag)
+            return const_cast<detail::sp_typeinfo*>(&BOOST_SP_TYPEID(functor_type));
+
+          return manager(in_buffer, out_buffer, op,
+                         mpl::bool_<(small_function_allows_inline<functor_type,
+                                                                  BufferSize>::value)>());
+        }
+      };
+
+      /**
+       * Stores the "manager" portion of the vtable for a
+       * boost::small_function object.
+       */
+      template<std::size_t BufferSize>
+      struct small_vtable_base
+      {
+        void* (*manager)(small_function_buffer<BufferSize>& in_buffer,
+                         small_function_buffer<BufferSize>* out_buffer,
+                         functor_manager_operation_type op);
+      };
+
+      /**
+       * The part of boost::small_function that does not depend on the
+       * signature: storage, moving, destruction and type queries.
+       */
+      template<std::size_t BufferSize>
+      class small_function_base
+      {
+        BOOST_STATIC_ASSERT(BufferSize >= sizeof(void*));
+
+      public:
+        typedef small_function_buffer<BufferSize> buffer_type;
+        typedef small_vtable_base<BufferSize> vtable_base_type;
+
+        small_function_base() BOOST_NOEXCEPT : vtable(0) { }
+
+        ~small_function_base() { clear(); }
+
+        /** Determine if the function is empty (i.e., has no target). */
+        bool empty() const BOOST_NOEXCEPT { return !vtable; }
+
+        /** Retrieve the type of the stored function object, or
+            BOOST_SP_TYPEID(void) if this is empty. */
+        const detail::sp_typeinfo& target_type() const
+        {
+          if (!vtable) return BOOST_SP_TYPEID(void);
+
+          return *static_cast<const detail::sp_typeinfo*>(
+                   get_vtable()->manager(functor, 0, get_functor_type_tag));
+        }
+
+        template<typename Functor>
+          Functor* target()
+          {
+            if (!vtable || !(target_type() == BOOST_SP_TYPEID(Functor)))
+              return 0;
+
+            return static_cast<Functor*>(
+                     get_vtable()->manager(functor, 0, check_functor_type_tag));
+          }
+
+        template<typename Functor>
+          const Functor* target() const
+          {
+            if (!vtable || !(target_type() == BOOST_SP_TYPEID(Functor)))
+              return 0;
+
+            return static_cast<const Functor*>(
+                     get_vtable()->manager(functor, 0, check_functor_type_tag));
+          }
+
+        /** Destroy the stored function object, if any. */
+        void clear() BOOST_NOEXCEPT
+        {
+          if (vtable) {
+            if (!has_trivial_move_and_destroy())
+              get_vtable()->manager(functor, 0, destroy_functor_tag);
+            vtable = 0;
+          }
+        }
+
+        /** The maximum size of a function object stored without
+            allocating. */
+        static std::size_t buffer_size() BOOST_NOEXCEPT { return BufferSize; }
+
+        /** Whether the stored function object lives in the inline
+            buffer. */
+        bool stored_inline() const BOOST_NOEXCEPT
+        {
+          if (!vtable) return false;
+          if (has_trivial_move_and_destroy()) return true;
+
+          return get_vtable()->manager(functor, 0, check_functor_type_tag)
+                   == static_cast<void*>(&functor.data);
+        }
+
+      protected:
+        // Take the target of f, leaving f empty. Never throws.
+        void move_assign(small_function_base& f) BOOST_NOEXCEPT
+        {
+          BOOST_ASSERT(&f != this);
+          clear();
+
+          if (f.vtable) {
+            if (f.has_trivial_move_and_destroy())
+              functor = f.functor;
+            else
+              f.get_vtable()->manager(f.functor, &functor, move_functor_tag);
+
+            vtable = f.vtable;
+            f.vtable = 0;
+          }
+        }
+
+        void swap_base(small_function_base& other) BOOST_NOEXCEPT
+        {
+          if (&other == this)
+            return;
+
+          small_function_base tmp;
+          tmp.move_assign(other);
+          other.move_assign(*this);
+          this->move_assign(tmp);
+        }
+
+        template<typename Functor>
+        void assign_functor(Functor& f, const vtable_base_type* v,
+                            mpl::true_ /* inline */)
+        {
+          new (reinterpret_cast<void*>(&functor.data)) Functor(boost::move(f));
+          set_vtable(v, small_function_is_trivial<Functor, BufferSize>::value);
+        }
+
+        template<typename Functor>
+        void assign_functor(Functor& f, const vtable_base_type* v,
+                            mpl::false_ /* heap */)
+        {
+          functor.obj_ptr = new Functor(boost::move(f));
+          set_vtable(v, false);
+        }
+
+        const vtable_base_type* get_vtable() const
+        {
+          return reinterpret_cast<const vtable_base_type*>(
+                   reinterpret_cast<std::size_t>(vtable) & ~static_cast<std::size_t>(0x01));
+        }
+
+        bool has_trivial_move_and_destroy() const
+        {
+          return reinterpret_cast<std::size_t>(vtable) & 0x01;
+        }
+
+      private:
+        small_function_base(const small_function_base&);
+        small_function_base& operator=(const small_function_base&);
+
+        void set_vtable(const vtable_base_type* v, bool trivial)
+        {
+          std::size_t value = reinterpret_cast<std::size_t>(v);
+          if (trivial)
+            value |= static_cast<std::size_t>(0x01);
+          vtable = reinterpret_cast<const vtable_base_type*>(value);
+        }
+
+      protected:
+        const vtable_base_type* vtable;
+        mutable buffer_type functor;
+      };
+    } // end namespace function
+  } // end namespace detail
+} // end namespace boost
+
+#define BOOST_PP_ITERATION_PARAMS_1 (3,(0,BOOST_FUNCTION_MAX_ARGS,<boost/function/detail/small_function_template.hpp>))
+#include BOOST_PP_ITERATE()
+#undef BOOST_PP_ITERATION_PARAMS_1
+
+#endif // BOOST_FUNCTION_SMALL_FUNCTION_HPP
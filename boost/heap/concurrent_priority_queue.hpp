@@ -0,0 +1,531 @@
+// boost heap: concurrent priority queue
+//
+// Copyright (C) 2010 Tim Blechmann
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_HEAP_CONCURRENT_PRIORITY_QUEUE_HPP
+#define BOOST_HEAP_CONCURRENT_PRIORITY_QUEUE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+
+#include <boost/heap/detail/stable_heap.hpp>
+
+#ifndef BOOST_DOXYGEN_INVOKED
+#if defined(__GNUC__) && !defined(__APPLE__)
+#define BOOST_HEAP_THREAD_LOCAL __thread
+#elif defined(BOOST_MSVC)
+#define BOOST_HEAP_THREAD_LOCAL __declspec(thread)
+#endif
+#endif
+
+
+namespace boost  {
+namespace heap   {
+namespace detail {
+
+typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
+                              boost::parameter::optional<tag::compare>,
+                              boost::parameter::optional<tag::stable>,
+                              boost::parameter::optional<tag::stability_counter_type>
+                             > concurrent_priority_queue_signature;
+
+static const std::size_t concurrent_cacheline_bytes = 64;
+
+inline boost::uint32_t concurrent_random_seed(void const * address)
+{
+    static boost::atomic<boost::uint32_t> sequence(0);
+
+    boost::uint32_t x = static_cast<boost::uint32_t>(reinterpret_cast<std::size_t>(address))
+                      ^ sequence.fetch_add(0x9e3779b9u, boost::memory_order_relaxed);
+
+    // murmur3 finalizer
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x ? x : 1;
+}
+
+/* xorshift generator for picking queues. the state is kept per thread where the
+ * compiler supports it, so that threads do not contend on a shared seed */
+inline boost::uint32_t concurrent_random(void)
+{
+#ifdef BOOST_HEAP_THREAD_LOCAL
+    static BOOST_HEAP_THREAD_LOCAL boost::uint32_t state = 0;
+    if (state == 0)
+        state = concurrent_random_seed(&state);
+#else
+    boost::uint32_t dummy;
+    boost::uint32_t state = concurrent_random_seed(&dummy);
+#endif
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+template <typename Container>
+struct concurrent_queue_lane
+{
+    explicit concurrent_queue_lane(Container const & c):
+        locked(false), size(0), heap(c)
+    {}
+
+    bool try_lock(void)
+    {
+        return !locked.load(boost::memory_order_relaxed) &&
+               !locked.exchange(true, boost::memory_order_acquire);
+    }
+
+    void lock(void)
+    {
+        for (unsigned int k = 0; !try_lock(); ++k)
+            boost::detail::yield(k);
+    }
+
+    void unlock(void)
+    {
+        locked.store(false, boost::memory_order_release);
+    }
+
+    /* may be called without holding the lock */
+    bool empty(void) const
+    {
+        return size.load(boost::memory_order_relaxed) == 0;
+    }
+
+    void update_size(void)
+    {
+        size.store(heap.size(), boost::memory_order_relaxed);
+    }
+
+    boost::atomic<bool> locked;
+    boost::atomic<std::size_t> size;
+    Container heap;
+};
+
+template <typename Lane>
+class concurrent_lane_guard:
+    boost::noncopyable
+{
+public:
+    concurrent_lane_guard(void):
+        lane_(0)
+    {}
+
+    explicit concurrent_lane_guard(Lane & lane):
+        lane_(&lane)
+    {
+        lane.lock();
+    }
+
+    ~concurrent_lane_guard(void)
+    {
+        if (lane_)
+            lane_->unlock();
+    }
+
+    void acquire(Lane & lane)
+    {
+        BOOST_ASSERT(lane_ == 0);
+        lane.lock();
+        lane_ = &lane;
+    }
+
+    bool try_acquire(Lane & lane)
+    {
+        BOOST_ASSERT(lane_ == 0);
+        if (!lane.try_lock())
+            return false;
+        lane_ = &lane;
+        return true;
+    }
+
+    Lane * get(void) const
+    {
+        return lane_;
+    }
+
+private:
+    Lane * lane_;
+};
+
+} /* namespace detail */
+
+/**
+ * \class concurrent_priority_queue
+ * \brief concurrent priority queue, based on a set of spinlock-protected heaps
+ *
+ * The concurrent_priority_queue class can be used by multiple producer and consumer threads. It is implemented as a
+ * relaxed multi-queue: the elements are distributed over a number of internal heaps, each protected by its own
+ * spinlock. \c push inserts an element into a randomly chosen heap, \c try_pop samples two heaps and removes the
+ * better of the two top elements. Threads only contend if they happen to pick the same internal heap, so the
+ * throughput scales with the number of cores.
+ *
+ * The price for the scalability is a relaxed ordering: \c try_pop does not necessarily return the element with the
+ * highest priority, but one of the top elements of the internal heaps. On average, the rank of the returned element
+ * is proportional to the number of internal heaps. If the queue is accessed by a single thread at a time, \c try_pop
+ * only returns false if the queue is empty.
+ *
+ * The template parameter T is the type to be managed by the container.
+ * The user can specify additional options and if no options are provided default options are used.
+ *
+ * The container supports the following options:
+ * - \c boost::heap::compare<>, defaults to \c compare<std::less<T> >
+ * - \c boost::heap::stable<>, defaults to \c stable<false>
+ * - \c boost::heap::stability_counter_type<>, defaults to \c stability_counter_type<boost::uintmax_t>
+ * - \c boost::heap::allocator<>, defaults to \c allocator<std::allocator<T> >
+ *
+ * \b Note: If configured as stable, elements of the same priority are ordered by a global counter, which is shared
+ *          between all threads. Equivalent elements are returned in FIFO order only within the limits of the relaxed
+ *          ordering.
+ *
+ */
+#ifdef BOOST_DOXYGEN_INVOKED
+template<class T, class ...Options>
+#else
+template <typename T,
+          class A0 = boost::parameter::void_,
+          class A1 = boost::parameter::void_,
+          class A2 = boost::parameter::void_,
+          class A3 = boost::parameter::void_
+         >
+#endif
+class concurrent_priority_queue:
+    private detail::make_heap_base<T, typename detail::concurrent_priority_queue_signature::bind<A0, A1, A2, A3>::type, false>::type,
+    boost::noncopyable
+{
+    typedef detail::make_heap_base<T, typename detail::concurrent_priority_queue_signature::bind<A0, A1, A2, A3>::type, false> heap_base_maker;
+
+    typedef typename heap_base_maker::type super_t;
+    typedef typename super_t::internal_type internal_type;
+    typedef typename heap_base_maker::allocator_argument::template rebind<internal_type>::other internal_type_allocator;
+    typedef std::vector<internal_type, internal_type_allocator> container_type;
+    typedef detail::concurrent_queue_lane<container_type> lane_type;
+    typedef detail::concurrent_lane_guard<lane_type> lane_guard;
+    typedef typename heap_base_maker::allocator_argument::template rebind<char>::other storage_allocator;
+
+#ifndef BOOST_DOXYGEN_INVOKED
+    struct implementation_defined:
+        detail::extract_allocator_types<typename heap_base_maker::allocator_argument>
+    {
+        typedef typename heap_base_maker::compare_argument value_compare;
+        typedef typename heap_base_maker::allocator_argument allocator_type;
+    };
+#endif
+
+    static const std::size_t lane_stride = (sizeof(lane_type) + detail::concurrent_cacheline_bytes - 1)
+                                           / detail::concurrent_cacheline_bytes * detail::concurrent_cacheline_bytes;
+
+    /* number of random attempts to acquire an internal heap, before blocking or falling back to a linear scan */
+    static const int sample_attempts = 4;
+
+public:
+    typedef T value_type;
+    typedef typename implementation_defined::size_type size_type;
+    typedef typename implementation_defined::difference_type difference_type;
+    typedef typename implementation_defined::value_compare value_compare;
+    typedef typename implementation_defined::allocator_type allocator_type;
+    typedef typename implementation_defined::reference reference;
+    typedef typename implementation_defined::const_reference const_reference;
+    typedef typename implementation_defined::pointer pointer;
+    typedef typename implementation_defined::const_pointer const_pointer;
+
+    typedef typename heap_base_maker::stability_counter_type stability_counter_type;
+
+    static const bool constant_time_size = false;
+    static const bool has_ordered_iterators = false;
+    static const bool is_mergable = false;
+    static const bool is_stable = heap_base_maker::is_stable;
+    static const bool has_reserve = false;
+
+    /** Default number of internal heaps, suitable for about 16 concurrent threads */
+    static const size_type default_queue_count = 32;
+
+    /**
+     * \b Effects: constructs an empty priority queue with \c default_queue_count internal heaps.
+     *
+     * \b Complexity: Linear in the number of internal heaps.
+     *
+     * */
+    explicit concurrent_priority_queue(value_compare const & cmp = value_compare()):
+        super_t(cmp), counter_(0)
+    {
+        initialize(default_queue_count);
+    }
+
+    /**
+     * \b Effects: constructs an empty priority queue with \c queue_count internal heaps.
+     *
+     * \b Complexity: Linear in the number of internal heaps.
+     *
+     * \b Note: A good choice for \c queue_count is about twice the number of threads accessing the queue.
+     *          More internal heaps reduce contention, but relax the ordering of \c try_pop.
+     *
+     * */
+    explicit concurrent_priority_queue(size_type queue_count, value_compare const & cmp = value_compare()):
+        super_t(cmp), counter_(0)
+    {
+        initialize(queue_count);
+    }
+
+    ~concurrent_priority_queue(void)
+    {
+        for (size_type i = 0; i != queue_count_; ++i)
+            lane(i).~lane_type();
+        storage_allocator().deallocate(storage_, storage_size());
+    }
+
+    /**
+     * \b Effects: Returns true, if the priority queue contains no elements.
+     *
+     * \b Complexity: Linear in the number of internal heaps.
+     *
+     * \b Note: Thread-safe. In the presence of concurrent operations the result is only a snapshot.
+     *
+     * */
+    bool empty(void) const
+    {
+        for (size_type i = 0; i != queue_count_; ++i)
+            if (!lane(i).empty())
+                return false;
+        return true;
+    }
+
+    /**
+     * \b Effects: Returns the number of elements contained in the priority queue.
+     *
+     * \b Complexity: Linear in the number of internal heaps.
+     *
+     * \b Note: Thread-safe. In the presence of concurrent operations the result is only an approximation.
+     *
+     * */
+    size_type size(void) const
+    {
+        size_type result = 0;
+        for (size_type i = 0; i != queue_count_; ++i)
+            result += lane(i).size.load(boost::memory_order_relaxed);
+        return result;
+    }
+
+    /**
+     * \b Effects: Returns the number of internal heaps.
+     *
+     * \b Complexity: Constant.
+     *
+     * */
+    size_type queue_count(void) const
+    {
+        return queue_count_;
+    }
+
+    /**
+     * \b Effects: Removes all elements from the priority queue.
+     *
+     * \b Complexity: Linear.
+     *
+     * \b Note: Not thread-safe.
+     *
+     * */
+    void clear(void)
+    {
+        for (size_type i = 0; i != queue_count_; ++i) {
+            lane(i).heap.clear();
+            lane(i).update_size();
+        }
+    }
+
+    /**
+     * \b Effects: Adds a new element to the priority queue.
+     *
+     * \b Complexity: Logarithmic (amortized). Linear (worst case).
+     *
+     * \b Note: Thread-safe.
+     *
+     * */
+    void push(value_type const & v)
+    {
+        internal_type node = make_node(v, boost::mpl::bool_<is_stable>());
+
+        lane_guard guard;
+        for (int i = 0; i != sample_attempts; ++i)
+            if (guard.try_acquire(random_lane()))
+                break;
+
+        if (!guard.get())
+            guard.acquire(random_lane());
+
+        lane_type & l = *guard.get();
+        l.heap.push_back(node);
+        std::push_heap(l.heap.begin(), l.heap.end(), static_cast<super_t const &>(*this));
+        l.update_size();
+    }
+
+    /**
+     * \b Effects: Removes one of the top elements of the internal heaps and assigns it to \c ret.
+     *
+     * \b Returns: true, if an element has been removed, false if the priority queue has been found empty.
+     *
+     * \b Complexity: Logarithmic (amortized). Linear in the number of internal heaps, if the queue is empty.
+     *
+     * \b Note: Thread-safe. The removed element is not necessarily the one with the highest priority.
+     *
+     * */
+    bool try_pop(value_type & ret)
+    {
+        for (int attempt = 0; attempt != sample_attempts; ++attempt) {
+            lane_type & first = random_lane();
+            lane_type & second = random_lane();
+            if (first.empty() && second.empty())
+                continue;
+
+            lane_guard first_guard, second_guard;
+            if (!first.empty())
+                first_guard.try_acquire(first);
+            if (!second.empty() && &second != &first)
+                second_guard.try_acquire(second);
+
+            lane_type * best = select(first_guard.get(), second_guard.get());
+            if (best) {
+                pop_from(*best, ret);
+                return true;
+            }
+        }
+
+        /* fall back to a linear scan, so that an empty queue is reliably detected */
+        const size_type offset = detail::concurrent_random() % queue_count_;
+        for (size_type i = 0; i != queue_count_; ++i) {
+            lane_type & l = lane((offset + i) % queue_count_);
+            if (l.empty())
+                continue;
+
+            lane_guard guard(l);
+            if (!l.heap.empty()) {
+                pop_from(l, ret);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * \b Effect: Returns the value_compare object used by the priority queue
+     *
+     * */
+    value_compare const & value_comp(void) const
+    {
+        return super_t::value_comp();
+    }
+
+private:
+    void initialize(size_type queue_count)
+    {
+        BOOST_ASSERT(queue_count > 0);
+        queue_count_ = queue_count;
+        storage_ = storage_allocator().allocate(storage_size());
+
+        std::size_t misalignment = reinterpret_cast<std::size_t>(storage_) % detail::concurrent_cacheline_bytes;
+        lanes_ = misalignment ? storage_ + detail::concurrent_cacheline_bytes - misalignment : storage_;
+
+        container_type prototype((internal_type_allocator()));
+        size_type constructed = 0;
+        BOOST_TRY {
+            for (; constructed != queue_count_; ++constructed)
+                new (lanes_ + constructed * lane_stride) lane_type(prototype);
+        }
+        BOOST_CATCH(...) {
+            for (size_type i = 0; i != constructed; ++i)
+                lane(i).~lane_type();
+            storage_allocator().deallocate(storage_, storage_size());
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+    }
+
+    std::size_t storage_size(void) const
+    {
+        return queue_count_ * lane_stride + detail::concurrent_cacheline_bytes;
+    }
+
+    lane_type & lane(size_type index)
+    {
+        return *reinterpret_cast<lane_type*>(lanes_ + index * lane_stride);
+    }
+
+    lane_type const & lane(size_type index) const
+    {
+        return *reinterpret_cast<lane_type const *>(lanes_ + index * lane_stride);
+    }
+
+    lane_type & random_lane(void)
+    {
+        return lane(detail::concurrent_random() % queue_count_);
+    }
+
+    lane_type * select(lane_type * first, lane_type * second) const
+    {
+        if (first && first->heap.empty())
+            first = 0;
+        if (second && second->heap.empty())
+            second = 0;
+
+        if (!first)
+            return second;
+        if (!second)
+            return first;
+
+        return super_t::operator()(first->heap.front(), second->heap.front()) ? second : first;
+    }
+
+    void pop_from(lane_type & l, value_type & ret)
+    {
+        ret = super_t::get_value(l.heap.front());
+        std::pop_heap(l.heap.begin(), l.heap.end(), static_cast<super_t const &>(*this));
+        l.heap.pop_back();
+        l.update_size();
+    }
+
+    internal_type make_node(value_type const & v, boost::mpl::false_)
+    {
+        return v;
+    }
+
+    internal_type make_node(value_type const & v, boost::mpl::true_)
+    {
+        stability_counter_type count = counter_.fetch_add(1, boost::memory_order_relaxed) + 1;
+        if (count == (std::numeric_limits<stability_counter_type>::max)())
+            BOOST_THROW_EXCEPTION(std::runtime_error("boost::heap counter overflow"));
+        return internal_type(v, count);
+    }
+
+    size_type queue_count_;
+    char * storage_;
+    char * lanes_;
+    char padding_[detail::concurrent_cacheline_bytes]; /* keep the stability counter off the read-mostly members */
+    boost::atomic<stability_counter_type> counter_;
+};
+
+} /* namespace heap */
+} /* namespace boost */
+
+#endif /* BOOST_HEAP_CONCURRENT_PRIORITY_QUEUE_HPP */
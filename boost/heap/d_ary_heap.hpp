@@ -14,6 +14,7 @@
 #include <vector>
 
 #include <boost/assert.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
 
 #include <boost/mem_fn.hpp>
 #include <boost/heap/detail/heap_comparison.hpp>
@@ -222,6 +223,32 @@ public:
         siftup(q_.size() - 1);
     }
 #endif
+
+    template <typename Iterator>
+    void push_range(Iterator begin, Iterator end)
+    {
+        const size_type old_size = size();
+        BOOST_TRY {
+            for (; begin != end; ++begin) {
+                q_.push_back(super_t::make_node(*begin));
+                reset_index(size() - 1, size() - 1);
+            }
+        }
+        BOOST_CATCH(...) {
+            q_.erase(q_.begin() + old_size, q_.end());
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+
+        // bottom-up construction is linear in the size of the heap, while sifting up
+        // the new elements costs O(k log(n)), so it only pays off for large ranges
+        if (size() - old_size > old_size)
+            make_heap();
+        else
+            for (size_type index = old_size; index != size(); ++index)
+                siftup(index);
+    }
+
     void pop(void)
     {
         BOOST_ASSERT(!empty());
@@ -278,6 +305,15 @@ private:
         index_updater::run(q_[index], new_index);
     }
 
+    void make_heap(void)
+    {
+        if (size() < 2)
+            return;
+
+        for (size_type index = parent_index(size() - 1) + 1; index != 0; --index)
+            siftdown(index - 1);
+    }
+
     void siftdown(size_type index)
     {
         while (not_leaf(index)) {
@@ -439,7 +475,7 @@ struct select_dary_heap
  * The user can specify additional options and if no options are provided default options are used.
  *
  * The container supports the following options:
- * - \c boost::heap::arity<>, required
+ * - \c boost::heap::arity<>, required (\c boost::heap::cache_aligned_arity<> selects it from the cache line size)
  * - \c boost::heap::compare<>, defaults to \c compare<std::less<T> >
  * - \c boost::heap::stable<>, defaults to \c stable<false>
  * - \c boost::heap::stability_counter_type<>, defaults to \c stability_counter_type<boost::uintmax_t>
@@ -596,6 +632,41 @@ public:
     }
 #endif
 
+    /**
+     * \b Effects: Adds the elements of the range [begin, end) to the priority queue.
+     *
+     * \b Complexity: Linear if the range is larger than the priority queue, otherwise O(k log(n))
+     *                 for k new elements.
+     *
+     * \b Note: If an exception is thrown, the priority queue is not modified.
+     * */
+    template <typename Iterator>
+    void push_range(Iterator begin, Iterator end)
+    {
+        super_t::push_range(begin, end);
+    }
+
+    /**
+     * \b Effects: Removes the n top elements of the priority queue, writing them to out in order.
+     *
+     * \b Returns: The output iterator past the last written element.
+     *
+     * \b Complexity: O(n log(N)).
+     *
+     * \b Requirement: n <= size()
+     * */
+    template <typename OutputIterator>
+    OutputIterator pop_n(size_type n, OutputIterator out)
+    {
+        BOOST_ASSERT(n <= size());
+        for (; n != 0; --n) {
+            *out = super_t::top();
+            ++out;
+            super_t::pop();
+        }
+        return out;
+    }
+
     /// \copydoc boost::heap::priority_queue::operator<(HeapType const & rhs) const
     template <typename HeapType>
     bool operator<(HeapType const & rhs) const
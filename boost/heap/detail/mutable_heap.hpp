@@ -17,6 +17,8 @@
 #include <utility>
 
 #include <boost/noncopyable.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/iterator/counting_iterator.hpp>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/heap/detail/ordered_adaptor_iterator.hpp>
 
@@ -350,6 +352,24 @@ public:
     }
 #endif
 
+    template <typename Iterator>
+    void push_range(Iterator begin, Iterator end)
+    {
+        const list_iterator old_begin = objects.begin();
+        BOOST_TRY {
+            for (; begin != end; ++begin)
+                objects.push_front(std::make_pair(*begin, 0));
+
+            q_.push_range(boost::counting_iterator<list_iterator>(objects.begin()),
+                          boost::counting_iterator<list_iterator>(old_begin));
+        }
+        BOOST_CATCH(...) {
+            objects.erase(objects.begin(), old_begin);
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+    }
+
     void pop(void)
     {
         BOOST_ASSERT(!empty());
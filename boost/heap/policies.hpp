@@ -14,6 +14,7 @@
 #include <boost/mpl/int.hpp>
 #include <boost/mpl/void.hpp>
 #include <boost/concept_check.hpp>
+#include <cstddef>
 
 
 namespace boost {
@@ -59,6 +60,11 @@ struct arity:
     boost::parameter::template_keyword<tag::arity, boost::mpl::int_<T> >
 {};
 
+template <typename T, std::size_t CacheLineSize = 64>
+struct cache_aligned_arity:
+    arity<((CacheLineSize / sizeof(T)) > 2) ? (unsigned int)(CacheLineSize / sizeof(T)) : 2>
+{};
+
 namespace tag { struct objects_per_page; }
 
 template <unsigned int T>
@@ -161,6 +167,16 @@ struct store_parent_pointer{};
  * */
 template <unsigned int T>
 struct arity{};
+
+/** \brief Specify arity, so that the children of a node fill a cache line.
+ *
+ * Selects the arity of a D-ary heap as the number of elements of type T that fit
+ * into CacheLineSize bytes (at least 2), so that the comparisons needed to find the
+ * top child touch as few cache lines as possible. T should be the type of the elements
+ * stored in the heap's array: for mutable heaps this is a pointer-sized handle.
+ * */
+template <typename T, std::size_t CacheLineSize = 64>
+struct cache_aligned_arity{};
 #endif
 
 } /* namespace heap */
@@ -38,6 +38,7 @@ enum
 ,  AvlSetBaseHook
 ,  BsSetBaseHook
 ,  AnyBaseHook
+,  SkiplistSetBaseHook
 };
 
 struct no_default_definer{};
@@ -77,6 +78,10 @@ template <class Hook>
 struct default_definer<Hook, AnyBaseHook>
 {  typedef Hook default_any_hook;  };
 
+template <class Hook>
+struct default_definer<Hook, SkiplistSetBaseHook>
+{  typedef Hook default_skiplist_set_hook;  };
+
 template <class Hook, unsigned int BaseHookType>
 struct make_default_definer
 {
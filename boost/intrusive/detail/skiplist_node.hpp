@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SKIPLIST_NODE_HPP
+#define BOOST_INTRUSIVE_SKIPLIST_NODE_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <iterator>
+#include <cstddef>
+#include <boost/atomic.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/intrusive/detail/mpl.hpp>
+#include <boost/intrusive/detail/utilities.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+
+namespace boost {
+namespace intrusive {
+
+//A skiplist node holds a tower of MaxHeight forward links. Only the first
+//"height" links are used: height is zero while the node is not linked.
+//Links are atomic so that lookups and insertions can run concurrently.
+template<class VoidPointer, std::size_t MaxHeight>
+struct skiplist_node
+{
+   //Atomic links can only be built on raw pointers
+   BOOST_STATIC_ASSERT((detail::is_same<VoidPointer, void*>::value));
+   BOOST_STATIC_ASSERT((MaxHeight > 0));
+
+   boost::atomic<skiplist_node*>    next_[MaxHeight];
+   boost::atomic<std::size_t>       height_;
+};
+
+//Links are published with release semantics and read with acquire semantics,
+//so a thread that reaches a node through a link also sees the node's
+//value and the links that were stored before the node was published.
+template<class VoidPointer, std::size_t MaxHeight>
+struct skiplist_node_traits
+{
+   typedef skiplist_node<VoidPointer, MaxHeight>   node;
+   typedef node *                                  node_ptr;
+   typedef const node *                            const_node_ptr;
+   static const std::size_t max_height = MaxHeight;
+
+   static node_ptr get_next(const const_node_ptr & n)
+   {  return n->next_[0].load(boost::memory_order_acquire);  }
+
+   static node_ptr get_next(const const_node_ptr & n, std::size_t level)
+   {  return n->next_[level].load(boost::memory_order_acquire);  }
+
+   //Used while the node is still private to the inserting thread or
+   //while the container is accessed exclusively
+   static void set_next(const node_ptr & n, std::size_t level, const node_ptr & next)
+   {  n->next_[level].store(next, boost::memory_order_relaxed);  }
+
+   static void publish_next(const node_ptr & n, std::size_t level, const node_ptr & next)
+   {  n->next_[level].store(next, boost::memory_order_release);  }
+
+   //Atomically replaces the link if it still points to "expected"
+   static bool cas_next
+      (const node_ptr & n, std::size_t level, node_ptr expected, const node_ptr & next)
+   {
+      return n->next_[level].compare_exchange_strong
+         (expected, next, boost::memory_order_release, boost::memory_order_relaxed);
+   }
+
+   static std::size_t get_height(const const_node_ptr & n)
+   {  return n->height_.load(boost::memory_order_acquire);  }
+
+   static void set_height(const node_ptr & n, std::size_t h)
+   {  n->height_.store(h, boost::memory_order_release);  }
+
+   static bool cas_height(const node_ptr & n, std::size_t expected, std::size_t h)
+   {  return n->height_.compare_exchange_weak(expected, h, boost::memory_order_acq_rel);  }
+};
+
+// skiplist_iterator provides some basic functions for a
+// node oriented forward iterator. It walks the bottom level of the
+// skiplist; the end iterator holds a null node pointer.
+template<class Container, bool IsConst>
+class skiplist_iterator
+   :  public std::iterator
+         < std::forward_iterator_tag
+         , typename Container::value_type
+         , typename Container::difference_type
+         , typename detail::if_c<IsConst,typename Container::const_pointer,typename Container::pointer>::type
+         , typename detail::if_c<IsConst,typename Container::const_reference,typename Container::reference>::type
+         >
+{
+   protected:
+   typedef typename Container::real_value_traits   real_value_traits;
+   typedef typename real_value_traits::node_traits node_traits;
+   typedef typename node_traits::node              node;
+   typedef typename node_traits::node_ptr          node_ptr;
+   typedef typename pointer_traits
+      <node_ptr>::template rebind_pointer <void>::type                       void_pointer;
+   static const bool store_container_ptr =
+      detail::store_cont_ptr_on_it<Container>::value;
+
+   public:
+   typedef typename Container::value_type    value_type;
+   typedef typename detail::if_c<IsConst,typename Container::const_pointer,typename Container::pointer>::type pointer;
+   typedef typename detail::if_c<IsConst,typename Container::const_reference,typename Container::reference>::type reference;
+
+   skiplist_iterator()
+      : members_ (node_ptr(), 0)
+   {}
+
+   explicit skiplist_iterator(const node_ptr & node, const Container *cont_ptr)
+      : members_ (node, cont_ptr)
+   {}
+
+   skiplist_iterator(skiplist_iterator<Container, false> const& other)
+      :  members_(other.pointed_node(), other.get_container())
+   {}
+
+   const node_ptr &pointed_node() const
+   { return members_.nodeptr_; }
+
+   skiplist_iterator &operator=(const node_ptr &node)
+   {  members_.nodeptr_ = node;  return static_cast<skiplist_iterator&>(*this);  }
+
+   public:
+   skiplist_iterator& operator++()
+   {
+      members_.nodeptr_ = node_traits::get_next(members_.nodeptr_);
+      return static_cast<skiplist_iterator&> (*this);
+   }
+
+   skiplist_iterator operator++(int)
+   {
+      skiplist_iterator result (*this);
+      members_.nodeptr_ = node_traits::get_next(members_.nodeptr_);
+      return result;
+   }
+
+   friend bool operator== (const skiplist_iterator& l, const skiplist_iterator& r)
+   {  return l.pointed_node() == r.pointed_node();   }
+
+   friend bool operator!= (const skiplist_iterator& l, const skiplist_iterator& r)
+   {  return !(l == r);   }
+
+   reference operator*() const
+   {  return *operator->();   }
+
+   pointer operator->() const
+   { return this->get_real_value_traits()->to_value_ptr(members_.nodeptr_); }
+
+   const Container *get_container() const
+   {
+      if(store_container_ptr)
+         return static_cast<const Container*>(members_.get_ptr());
+      else
+         return 0;
+   }
+
+   skiplist_iterator<Container, false> unconst() const
+   {  return skiplist_iterator<Container, false>(this->pointed_node(), this->get_container());   }
+
+   const real_value_traits *get_real_value_traits() const
+   {
+      if(store_container_ptr)
+         return &this->get_container()->get_real_value_traits();
+      else
+         return 0;
+   }
+
+   private:
+   struct members
+      :  public detail::select_constptr
+         <void_pointer, store_container_ptr>::type
+   {
+      typedef typename detail::select_constptr
+         <void_pointer, store_container_ptr>::type Base;
+
+      members(const node_ptr &n_ptr, const void *cont)
+         :  Base(cont), nodeptr_(n_ptr)
+      {}
+
+      node_ptr nodeptr_;
+   } members_;
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SKIPLIST_NODE_HPP
@@ -45,6 +45,9 @@ class circular_slist_algorithms;
 template<class NodeTraits>
 class rbtree_algorithms;
 
+template<class NodeTraits>
+class skiplist_algorithms;
+
 ////////////////////////////
 //       Containers
 ////////////////////////////
@@ -429,6 +432,70 @@ template<class ...Options>
 #endif
 class bs_set_member_hook;
 
+//skiplist/skiplist_set/skiplist_multiset
+#if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = none
+   , class O2  = none
+   , class O3  = none
+   , class O4  = none
+   >
+#else
+template<class T, class ...Options>
+#endif
+class skiplist;
+
+#if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = none
+   , class O2  = none
+   , class O3  = none
+   , class O4  = none
+   >
+#else
+template<class T, class ...Options>
+#endif
+class skiplist_set;
+
+#if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class T
+   , class O1  = none
+   , class O2  = none
+   , class O3  = none
+   , class O4  = none
+   >
+#else
+template<class T, class ...Options>
+#endif
+class skiplist_multiset;
+
+#if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = none
+   , class O2  = none
+   , class O3  = none
+   , class O4  = none
+   >
+#else
+template<class ...Options>
+#endif
+class skiplist_set_base_hook;
+
+#if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template
+   < class O1  = none
+   , class O2  = none
+   , class O3  = none
+   , class O4  = none
+   >
+#else
+template<class ...Options>
+#endif
+class skiplist_set_member_hook;
+
 //hashtable/unordered_set/unordered_multiset
 
 #if !defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) && !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
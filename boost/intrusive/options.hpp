@@ -50,6 +50,7 @@ BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION(default_uset_hook);
 BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION(default_avl_set_hook);
 BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION(default_splay_set_hook);
 BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION(default_bs_set_hook);
+BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION(default_skiplist_set_hook);
 
 #undef BOOST_INTRUSIVE_DEFAULT_HOOK_MARKER_DEFINITION
 
@@ -511,6 +512,22 @@ struct optimize_multikey
 /// @endcond
 };
 
+//!This option setter specifies the maximum number of levels of a
+//!skiplist hook. Every hook stores that number of links, and with
+//!the default value skiplists stay logarithmic up to several
+//!million elements.
+template<std::size_t MaxHeight>
+struct max_height
+{
+/// @cond
+    template<class Base>
+    struct pack : Base
+    {
+        static const std::size_t max_height = MaxHeight;
+    };
+/// @endcond
+};
+
 //!This option setter specifies if the bucket array will be always power of two.
 //!This allows using masks instead of the default modulo operation to determine
 //!the bucket number from the hash value, leading to better performance.
@@ -797,6 +814,7 @@ struct hook_defaults
       , store_hash<false>
       , linear<false>
       , optimize_multikey<false>
+      , max_height<12>
       >::type
 {};
 
@@ -0,0 +1,962 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SKIPLIST_HPP
+#define BOOST_INTRUSIVE_SKIPLIST_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/atomic.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/skiplist_set_hook.hpp>
+#include <boost/intrusive/skiplist_algorithms.hpp>
+#include <boost/intrusive/detail/skiplist_node.hpp>
+#include <boost/intrusive/detail/clear_on_destructor_base.hpp>
+#include <boost/intrusive/detail/ebo_functor_holder.hpp>
+#include <boost/intrusive/pointer_traits.hpp>
+#include <boost/intrusive/link_mode.hpp>
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/detail/utilities.hpp>
+#include <iterator>
+#include <functional>
+#include <cstddef>
+#include <utility>   //std::pair
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+
+template <class ValueTraits, class Compare, class SizeType, bool ConstantTimeSize>
+struct skiplistopt
+{
+   typedef ValueTraits  value_traits;
+   typedef Compare      compare;
+   typedef SizeType     size_type;
+   static const bool constant_time_size = ConstantTimeSize;
+};
+
+//Size counters are updated by concurrent insertions
+template<bool ConstantTimeSize, class SizeType>
+struct skiplist_size_holder
+{
+   SizeType get_size() const
+   {  return size_.load(boost::memory_order_relaxed);  }
+
+   void set_size(SizeType size)
+   {  size_.store(size, boost::memory_order_relaxed); }
+
+   void decrement()
+   {  size_.fetch_sub(1, boost::memory_order_relaxed); }
+
+   void increment()
+   {  size_.fetch_add(1, boost::memory_order_relaxed); }
+
+   boost::atomic<SizeType> size_;
+};
+
+template<class SizeType>
+struct skiplist_size_holder<false, SizeType>
+{
+   SizeType get_size() const
+   {  return 0;  }
+
+   void set_size(SizeType)
+   {}
+
+   void decrement()
+   {}
+
+   void increment()
+   {}
+};
+
+template <class T>
+struct skiplist_defaults
+   :  pack_options
+      < none
+      , base_hook<detail::default_skiplist_set_hook>
+      , constant_time_size<false>
+      , size_type<std::size_t>
+      , compare<std::less<T> >
+      >::type
+{};
+
+/// @endcond
+
+//! The class template skiplist is an intrusive ordered container based on
+//! a skiplist, used to construct the intrusive skiplist_set and
+//! skiplist_multiset containers.
+//!
+//! Searches (find, lower_bound, upper_bound, equal_range, count), iteration
+//! and insertions can be performed concurrently from several threads without
+//! external locking: insertions only publish new links with atomic
+//! compare-and-swap operations and a value is visible to other threads as
+//! soon as its insertion function returns. Functions that remove elements
+//! (erase, clear and the destructor) require exclusive access to the container.
+//! Inserted values must not be modified in a way that changes their ordering.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<>, \c size_type<> and
+//! \c compare<>.
+//!
+//! constant_time_size<> defaults to false: a shared element counter would be
+//! updated by every insertion and become a point of contention between threads.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+template<class T, class ...Options>
+#else
+template<class Config>
+#endif
+class skiplist_impl
+   :  private detail::clear_on_destructor_base<skiplist_impl<Config> >
+{
+   template<class C> friend class detail::clear_on_destructor_base;
+   public:
+   typedef typename Config::value_traits                             value_traits;
+   /// @cond
+   static const bool external_value_traits =
+      detail::external_value_traits_bool_is_true<value_traits>::value;
+   typedef typename detail::eval_if_c
+      < external_value_traits
+      , detail::eval_value_traits<value_traits>
+      , detail::identity<value_traits>
+      >::type                                                        real_value_traits;
+   /// @endcond
+   typedef typename real_value_traits::pointer                       pointer;
+   typedef typename real_value_traits::const_pointer                 const_pointer;
+   typedef typename pointer_traits<pointer>::element_type            value_type;
+   typedef value_type                                                key_type;
+   typedef typename pointer_traits<pointer>::reference               reference;
+   typedef typename pointer_traits<const_pointer>::reference         const_reference;
+   typedef typename pointer_traits<pointer>::difference_type         difference_type;
+   typedef typename Config::size_type                                size_type;
+   typedef typename Config::compare                                  value_compare;
+   typedef value_compare                                             key_compare;
+   typedef skiplist_iterator<skiplist_impl, false>                   iterator;
+   typedef skiplist_iterator<skiplist_impl, true>                    const_iterator;
+   typedef typename real_value_traits::node_traits                   node_traits;
+   typedef typename node_traits::node                                node;
+   typedef typename node_traits::node_ptr                            node_ptr;
+   typedef typename node_traits::const_node_ptr                      const_node_ptr;
+   typedef skiplist_algorithms<node_traits>                          node_algorithms;
+
+   static const bool constant_time_size = Config::constant_time_size;
+   static const bool stateful_value_traits = detail::is_stateful_value_traits<real_value_traits>::value;
+
+   /// @cond
+   private:
+   typedef skiplist_size_holder<constant_time_size, size_type>       size_traits;
+
+   //noncopyable
+   skiplist_impl (const skiplist_impl&);
+   skiplist_impl operator =(const skiplist_impl&);
+
+   enum { safemode_or_autounlink  =
+            (int)real_value_traits::link_mode == (int)auto_unlink   ||
+            (int)real_value_traits::link_mode == (int)safe_link     };
+
+   //Skiplists can't be unlinked without accessing the container
+   BOOST_STATIC_ASSERT(((int)real_value_traits::link_mode != (int)auto_unlink));
+
+   struct header_plus_size : public size_traits
+   {  node header_;  };
+
+   struct node_plus_pred_t : public detail::ebo_functor_holder<value_compare>
+   {
+      node_plus_pred_t(const value_compare &comp)
+         :  detail::ebo_functor_holder<value_compare>(comp)
+      {}
+      header_plus_size header_plus_size_;
+   };
+
+   struct data_t : public skiplist_impl::value_traits
+   {
+      typedef typename skiplist_impl::value_traits value_traits;
+      data_t(const value_compare & comp, const value_traits &val_traits)
+         :  value_traits(val_traits), node_plus_pred_(comp)
+      {}
+      node_plus_pred_t node_plus_pred_;
+   } data_;
+
+   const value_compare &priv_comp() const
+   {  return data_.node_plus_pred_.get();  }
+
+   value_compare &priv_comp()
+   {  return data_.node_plus_pred_.get();  }
+
+   const value_traits &priv_value_traits() const
+   {  return data_;  }
+
+   value_traits &priv_value_traits()
+   {  return data_;  }
+
+   node_ptr priv_header_ptr()
+   {  return pointer_traits<node_ptr>::pointer_to(data_.node_plus_pred_.header_plus_size_.header_);  }
+
+   const_node_ptr priv_header_ptr() const
+   {  return pointer_traits<const_node_ptr>::pointer_to(data_.node_plus_pred_.header_plus_size_.header_);  }
+
+   static node_ptr uncast(const const_node_ptr & ptr)
+   {  return pointer_traits<node_ptr>::const_cast_from(ptr);  }
+
+   size_traits &priv_size_traits()
+   {  return data_.node_plus_pred_.header_plus_size_;  }
+
+   const size_traits &priv_size_traits() const
+   {  return data_.node_plus_pred_.header_plus_size_;  }
+
+   const real_value_traits &get_real_value_traits(detail::bool_<false>) const
+   {  return data_;  }
+
+   const real_value_traits &get_real_value_traits(detail::bool_<true>) const
+   {  return data_.get_value_traits(*this);  }
+
+   real_value_traits &get_real_value_traits(detail::bool_<false>)
+   {  return data_;  }
+
+   real_value_traits &get_real_value_traits(detail::bool_<true>)
+   {  return data_.get_value_traits(*this);  }
+
+   /// @endcond
+
+   public:
+
+   const real_value_traits &get_real_value_traits() const
+   {  return this->get_real_value_traits(detail::bool_<external_value_traits>());  }
+
+   real_value_traits &get_real_value_traits()
+   {  return this->get_real_value_traits(detail::bool_<external_value_traits>());  }
+
+   //! <b>Effects</b>: Constructs an empty skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor of the value_compare object throws. Basic guarantee.
+   explicit skiplist_impl( const value_compare &cmp = value_compare()
+                         , const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {
+      node_algorithms::init_header(this->priv_header_ptr());
+      this->priv_size_traits().set_size(size_type(0));
+   }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!   cmp must be a comparison function that induces a strict weak ordering.
+   //!
+   //! <b>Effects</b>: Constructs an empty skiplist and inserts elements from
+   //!   [b, e).
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between first and last.
+   //!
+   //! <b>Throws</b>: If value_traits::node_traits::node
+   //!   constructor throws (this does not happen with predefined Boost.Intrusive hooks)
+   //!   or the copy constructor/operator() of the value_compare object throws. Basic guarantee.
+   template<class Iterator>
+   skiplist_impl( bool unique, Iterator b, Iterator e
+                , const value_compare &cmp     = value_compare()
+                , const value_traits &v_traits = value_traits())
+      :  data_(cmp, v_traits)
+   {
+      node_algorithms::init_header(this->priv_header_ptr());
+      this->priv_size_traits().set_size(size_type(0));
+      if(unique)
+         this->insert_unique(b, e);
+      else
+         this->insert_equal(b, e);
+   }
+
+   //! <b>Effects</b>: Detaches all elements from this. The objects in the set
+   //!   are not deleted (i.e. no destructors are called), but the nodes according to
+   //!   the value_traits template parameter are reinitialized and thus can be reused.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this
+   //!   if safe-mode is activated, constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~skiplist_impl()
+   {}
+
+   //! <b>Effects</b>: Returns an iterator pointing to the beginning of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator begin()
+   {  return iterator (node_algorithms::begin_node(this->priv_header_ptr()), this);   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator begin() const
+   {  return cbegin();   }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the beginning of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator cbegin() const
+   {  return const_iterator (node_algorithms::begin_node(this->priv_header_ptr()), this);   }
+
+   //! <b>Effects</b>: Returns an iterator pointing to the end of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator end()
+   {  return iterator (node_ptr(), this);  }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator end() const
+   {  return cend();  }
+
+   //! <b>Effects</b>: Returns a const_iterator pointing to the end of the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator cend() const
+   {  return const_iterator (node_ptr(), this);  }
+
+   //! <b>Effects</b>: Returns the value_compare object used by the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If value_compare copy-constructor throws.
+   value_compare value_comp() const
+   {  return priv_comp();   }
+
+   //! <b>Effects</b>: Returns the key_compare object used by the skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If key_compare copy-constructor throws.
+   key_compare key_comp() const
+   {  return priv_comp();   }
+
+   //! <b>Effects</b>: Returns true if the container is empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   bool empty() const
+   {  return !node_algorithms::begin_node(this->priv_header_ptr());   }
+
+   //! <b>Effects</b>: Returns the number of elements stored in the skiplist.
+   //!
+   //! <b>Complexity</b>: Linear to elements contained in *this
+   //!   if constant-time size option is disabled. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: If insertions are running concurrently the returned value
+   //!   is only a snapshot.
+   size_type size() const
+   {
+      if(constant_time_size)
+         return this->priv_size_traits().get_size();
+      else{
+         return (size_type)node_algorithms::count(this->priv_header_ptr());
+      }
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts value into the skiplist before the upper bound.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called. Can be called concurrently with
+   //!   other insertions and searches. The relative order of equivalent
+   //!   elements is unspecified.
+   iterator insert_equal(reference value)
+   {
+      detail::key_nodeptr_comp<value_compare, skiplist_impl>
+         key_node_comp(priv_comp(), this);
+      node_ptr to_insert(get_real_value_traits().to_node_ptr(value));
+      if(safemode_or_autounlink)
+         BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(node_algorithms::unique(to_insert));
+      iterator ret(node_algorithms::insert_equal
+         (this->priv_header_ptr(), to_insert, key_node_comp), this);
+      this->priv_size_traits().increment();
+      return ret;
+   }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Inserts each element of a range into the skiplist.
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   template<class Iterator>
+   void insert_equal(Iterator b, Iterator e)
+   {
+      for (; b != e; ++b)
+         this->insert_equal(*b);
+   }
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts value into the skiplist if the value
+   //!   is not already present.
+   //!
+   //! <b>Returns</b>: A pair whose second member is true if the value was
+   //!   inserted and whose first member points to the inserted value or to
+   //!   the equivalent value already present.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called. Can be called concurrently with
+   //!   other insertions and searches: if equivalent values are inserted
+   //!   concurrently exactly one of them is inserted.
+   std::pair<iterator, bool> insert_unique(reference value)
+   {
+      detail::key_nodeptr_comp<value_compare, skiplist_impl>
+         key_node_comp(priv_comp(), this);
+      node_ptr to_insert(get_real_value_traits().to_node_ptr(value));
+      if(safemode_or_autounlink)
+         BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(node_algorithms::unique(to_insert));
+      std::pair<node_ptr, bool> ret = node_algorithms::insert_unique
+         (this->priv_header_ptr(), to_insert, key_node_comp);
+      if(ret.second)
+         this->priv_size_traits().increment();
+      return std::pair<iterator, bool>(iterator(ret.first, this), ret.second);
+   }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Tries to insert each element of a range into the skiplist.
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Basic guarantee.
+   //!
+   //! <b>Note</b>: Does not affect the validity of iterators and references.
+   //!   No copy-constructors are called.
+   template<class Iterator>
+   void insert_unique(Iterator b, Iterator e)
+   {
+      for (; b != e; ++b)
+         this->insert_unique(*b);
+   }
+
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called. Requires
+   //!    exclusive access to the container.
+   iterator erase(const_iterator i)
+   {
+      const_iterator ret(i);
+      ++ret;
+      node_ptr to_erase(i.pointed_node());
+      if(safemode_or_autounlink)
+         BOOST_INTRUSIVE_SAFE_HOOK_DEFAULT_ASSERT(!node_algorithms::unique(to_erase));
+      detail::key_nodeptr_comp<value_compare, skiplist_impl>
+         key_node_comp(priv_comp(), this);
+      node_algorithms::erase(this->priv_header_ptr(), to_erase, key_node_comp);
+      this->priv_size_traits().decrement();
+      if(safemode_or_autounlink)
+         node_algorithms::init(to_erase);
+      return ret.unconst();
+   }
+
+   //! <b>Effects</b>: Erases all the elements with the given value.
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of erased elements.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called. Requires
+   //!    exclusive access to the container.
+   size_type erase(const_reference value)
+   {  return this->erase(value, priv_comp());   }
+
+   //! <b>Effects</b>: Erases all the elements with the given key
+   //!   according to the comparison functor "comp".
+   //!
+   //! <b>Returns</b>: The number of erased elements.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of erased elements.
+   //!
+   //! <b>Throws</b>: If "comp" or the internal value_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called. Requires
+   //!    exclusive access to the container.
+   template<class KeyType, class KeyValueCompare>
+   size_type erase(const KeyType& key, KeyValueCompare comp)
+   {
+      std::pair<iterator,iterator> p = this->equal_range(key, comp);
+      size_type n = 0;
+      while(p.first != p.second){
+         p.first = this->erase(p.first);
+         ++n;
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases the element pointed to by i.
+   //!   Disposer::operator()(pointer) is called for the removed element.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   //!
+   //! <b>Note</b>: Invalidates the iterators
+   //!    to the erased elements. Requires exclusive access to the container.
+   template<class Disposer>
+   iterator erase_and_dispose(const_iterator i, Disposer disposer)
+   {
+      node_ptr to_erase(i.pointed_node());
+      iterator ret(this->erase(i));
+      disposer(get_real_value_traits().to_value_ptr(to_erase));
+      return ret;
+   }
+
+   //! <b>Effects</b>: Erases all of the elements.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container
+   //!   if it's a safe-mode hook. Constant time otherwise.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. No destructors are called. Requires
+   //!    exclusive access to the container.
+   void clear()
+   {
+      if(safemode_or_autounlink){
+         this->clear_and_dispose(detail::null_disposer());
+      }
+      else{
+         node_algorithms::init_header(this->priv_header_ptr());
+         this->priv_size_traits().set_size(0);
+      }
+   }
+
+   //! <b>Requires</b>: Disposer::operator()(pointer) shouldn't throw.
+   //!
+   //! <b>Effects</b>: Erases all of the elements calling disposer(p) for
+   //!   each node to be erased.
+   //!
+   //! <b>Complexity</b>: Linear to the number of elements on the container.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Note</b>: Invalidates the iterators (but not the references)
+   //!    to the erased elements. Calls N times to disposer functor.
+   //!    Requires exclusive access to the container.
+   template<class Disposer>
+   void clear_and_dispose(Disposer disposer)
+   {
+      node_ptr n = node_algorithms::begin_node(this->priv_header_ptr());
+      node_algorithms::init_header(this->priv_header_ptr());
+      this->priv_size_traits().set_size(0);
+      while(n){
+         node_ptr next = node_traits::get_next(n);
+         if(safemode_or_autounlink)
+            node_algorithms::init(n);
+         disposer(get_real_value_traits().to_value_ptr(n));
+         n = next;
+      }
+   }
+
+   //! <b>Effects</b>: Returns the number of contained elements with the given value
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of elements with the given value.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   size_type count(const_reference value) const
+   {  return this->count(value, priv_comp());   }
+
+   //! <b>Effects</b>: Returns the number of contained elements with the given key
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of elements with the given key.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   size_type count(const KeyType &key, KeyValueCompare comp) const
+   {
+      std::pair<const_iterator, const_iterator> ret = this->equal_range(key, comp);
+      return size_type(std::distance(ret.first, ret.second));
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   iterator lower_bound(const_reference value)
+   {  return this->lower_bound(value, priv_comp());   }
+
+   //! <b>Effects</b>: Returns a const_iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   const_iterator lower_bound(const_reference value) const
+   {  return this->lower_bound(value, priv_comp());   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   iterator lower_bound(const KeyType &key, KeyValueCompare comp)
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return iterator(node_algorithms::lower_bound
+         (this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is not less than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   const_iterator lower_bound(const KeyType &key, KeyValueCompare comp) const
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return const_iterator(node_algorithms::lower_bound
+         (this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   iterator upper_bound(const_reference value)
+   {  return this->upper_bound(value, priv_comp());   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is greater than k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   const_iterator upper_bound(const_reference value) const
+   {  return this->upper_bound(value, priv_comp());   }
+
+   //! <b>Effects</b>: Returns an iterator to the first element whose
+   //!   key is greater than k according to comp or end() if that element
+   //!   does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   iterator upper_bound(const KeyType &key, KeyValueCompare comp)
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return iterator(node_algorithms::upper_bound
+         (this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Returns a const iterator to the first element whose
+   //!   key is greater than k according to comp or end() if that element
+   //!   does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   const_iterator upper_bound(const KeyType &key, KeyValueCompare comp) const
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return const_iterator(node_algorithms::upper_bound
+         (this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   iterator find(const_reference value)
+   {  return this->find(value, priv_comp()); }
+
+   //! <b>Effects</b>: Finds a const_iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   const_iterator find(const_reference value) const
+   {  return this->find(value, priv_comp()); }
+
+   //! <b>Effects</b>: Finds an iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   iterator find(const KeyType &key, KeyValueCompare comp)
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return iterator
+         (node_algorithms::find(this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Finds a const_iterator to the first element whose key is
+   //!   k or end() if that element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   const_iterator find(const KeyType &key, KeyValueCompare comp) const
+   {
+      detail::key_nodeptr_comp<KeyValueCompare, skiplist_impl>
+         key_node_comp(comp, this);
+      return const_iterator
+         (node_algorithms::find(this->priv_header_ptr(), key, key_node_comp), this);
+   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if they there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   std::pair<iterator,iterator> equal_range(const_reference value)
+   {  return this->equal_range(value, priv_comp());   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if they there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws.
+   std::pair<const_iterator, const_iterator> equal_range(const_reference value) const
+   {  return this->equal_range(value, priv_comp());   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if they there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of elements with key k.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   std::pair<iterator,iterator> equal_range(const KeyType &key, KeyValueCompare comp)
+   {
+      iterator b(this->lower_bound(key, comp)), e(b), end_it(this->end());
+      while(e != end_it && !comp(key, *e))
+         ++e;
+      return std::pair<iterator,iterator>(b, e);
+   }
+
+   //! <b>Effects</b>: Finds a range containing all elements whose key is k or
+   //!   an empty range that indicates the position where those elements would be
+   //!   if they there is no elements with key k.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of elements with key k.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   template<class KeyType, class KeyValueCompare>
+   std::pair<const_iterator, const_iterator>
+      equal_range(const KeyType &key, KeyValueCompare comp) const
+   {
+      const_iterator b(this->lower_bound(key, comp)), e(b), end_it(this->cend());
+      while(e != end_it && !comp(key, *e))
+         ++e;
+      return std::pair<const_iterator,const_iterator>(b, e);
+   }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a skiplist of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid iterator i belonging to the skiplist
+   //!   that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   iterator iterator_to(reference value)
+   {  return iterator (value_traits::to_node_ptr(value), this); }
+
+   //! <b>Requires</b>: value must be an lvalue and shall be in a skiplist of
+   //!   appropriate type. Otherwise the behavior is undefined.
+   //!
+   //! <b>Effects</b>: Returns: a valid const_iterator i belonging to the
+   //!   skiplist that points to the value
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   const_iterator iterator_to(const_reference value) const
+   {  return const_iterator (value_traits::to_node_ptr(const_cast<reference> (value)), this); }
+
+   //! <b>Requires</b>: value shall not be in a skiplist.
+   //!
+   //! <b>Effects</b>: init_node puts the hook of a value in a well-known default
+   //!   state.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Note</b>: This function puts the hook in the well-known default state
+   //!   used by auto_unlink and safe hooks.
+   static void init_node(reference value)
+   { node_algorithms::init(value_traits::to_node_ptr(value)); }
+};
+
+//! Helper metafunction to define a \c skiplist that yields to the same type when the
+//! same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1 = none, class O2 = none
+                , class O3 = none, class O4 = none>
+#endif
+struct make_skiplist
+{
+   /// @cond
+   typedef typename pack_options
+      < skiplist_defaults<T>,
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3, O4
+         #else
+         Options...
+         #endif
+      >::type packed_options;
+
+   typedef typename detail::get_value_traits
+      <T, typename packed_options::value_traits>::type value_traits;
+
+   typedef skiplist_impl
+      < skiplistopt
+         < value_traits
+         , typename packed_options::compare
+         , typename packed_options::size_type
+         , packed_options::constant_time_size
+         >
+      > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+#ifndef BOOST_INTRUSIVE_DOXYGEN_INVOKED
+
+#if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class O1, class O2, class O3, class O4>
+#else
+template<class T, class ...Options>
+#endif
+class skiplist
+   :  public make_skiplist<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type
+{
+   typedef typename make_skiplist
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type   Base;
+   typedef typename Base::real_value_traits  real_value_traits;
+   //Assert if passed value traits are compatible with the type
+   BOOST_STATIC_ASSERT((detail::is_same<typename real_value_traits::value_type, T>::value));
+
+   public:
+   typedef typename Base::value_compare      value_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   explicit skiplist( const value_compare &cmp = value_compare()
+                    , const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   template<class Iterator>
+   skiplist( bool unique, Iterator b, Iterator e
+           , const value_compare &cmp = value_compare()
+           , const value_traits &v_traits = value_traits())
+      :  Base(unique, b, e, cmp, v_traits)
+   {}
+};
+
+#endif
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SKIPLIST_HPP
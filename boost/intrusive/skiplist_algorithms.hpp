@@ -0,0 +1,450 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SKIPLIST_ALGORITHMS_HPP
+#define BOOST_INTRUSIVE_SKIPLIST_ALGORITHMS_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace boost {
+namespace intrusive {
+
+//! skiplist_algorithms provides basic algorithms to manipulate nodes
+//! forming a skiplist: an ordered singly linked list in which every node
+//! also belongs to a random number of sparser "express" lists, so that
+//! searches take logarithmic time on average.
+//!
+//! A skiplist is represented by a header node whose links are the heads of
+//! every level and whose height is the number of levels in use. The last
+//! node of every level points to a null node.
+//!
+//! Lookups and insertions only use atomic operations on the links, so they
+//! can be executed concurrently from any number of threads. Erasure and
+//! clearing require exclusive access to the skiplist.
+//!
+//! skiplist_algorithms is configured with a NodeTraits class, which encapsulates the
+//! information about the node to be manipulated. NodeTraits must support the
+//! following interface:
+//!
+//! <b>Typedefs</b>:
+//!
+//! <tt>node</tt>: The type of the node that forms the skiplist
+//!
+//! <tt>node_ptr</tt>: A raw pointer to a node
+//!
+//! <tt>const_node_ptr</tt>: A raw pointer to a const node
+//!
+//! <b>Static constants</b>:
+//!
+//! <tt>static const std::size_t max_height;</tt>
+//!
+//! <b>Static functions</b>:
+//!
+//! <tt>static node_ptr get_next(const_node_ptr n, std::size_t level);</tt>
+//!
+//! <tt>static void set_next(node_ptr n, std::size_t level, node_ptr next);</tt>
+//!
+//! <tt>static bool cas_next(node_ptr n, std::size_t level, node_ptr expected, node_ptr next);</tt>
+//!
+//! <tt>static std::size_t get_height(const_node_ptr n);</tt>
+//!
+//! <tt>static void set_height(node_ptr n, std::size_t height);</tt>
+//!
+//! <tt>static bool cas_height(node_ptr n, std::size_t expected, std::size_t height);</tt>
+template<class NodeTraits>
+class skiplist_algorithms
+{
+   public:
+   typedef typename NodeTraits::node            node;
+   typedef typename NodeTraits::node_ptr        node_ptr;
+   typedef typename NodeTraits::const_node_ptr  const_node_ptr;
+   typedef NodeTraits                           node_traits;
+
+   static const std::size_t max_height = NodeTraits::max_height;
+
+   /// @cond
+   private:
+
+   //Orders nodes by key. If ByAddress is true, equivalent nodes are ordered
+   //by address so that the position of a new node is unique at every level,
+   //no matter which other equivalent nodes are being inserted concurrently.
+   template<class NodePtrCompare, bool ByAddress>
+   struct position_compare
+   {
+      position_compare(NodePtrCompare &comp)
+         :  comp_(comp)
+      {}
+
+      bool operator()(const node_ptr &a, const node_ptr &b) const
+      {
+         return comp_(a, b) ||
+            (ByAddress && !comp_(b, a) && std::less<node_ptr>()(a, b));
+      }
+
+      NodePtrCompare &comp_;
+   };
+
+   static std::size_t raise_height(const node_ptr & header, std::size_t h)
+   {
+      std::size_t top = NodeTraits::get_height(header);
+      while(top < h){
+         if(NodeTraits::cas_height(header, top, h))
+            return h;
+         top = NodeTraits::get_height(header);
+      }
+      return top;
+   }
+
+   //Fills preds and succs with the nodes between which new_node must be
+   //linked at levels [0, top)
+   template<class Compare>
+   static void priv_position
+      ( const node_ptr & header, const node_ptr & new_node, Compare comp
+      , std::size_t top, node_ptr preds[], node_ptr succs[])
+   {
+      node_ptr x = header;
+      for(std::size_t level = top; level--; ){
+         node_ptr n = NodeTraits::get_next(x, level);
+         while(n && comp(n, new_node)){
+            x = n;
+            n = NodeTraits::get_next(x, level);
+         }
+         preds[level] = x;
+         succs[level] = n;
+      }
+   }
+
+   template<class Compare>
+   static void priv_link
+      (const node_ptr & new_node, Compare comp, std::size_t h, node_ptr preds[], node_ptr succs[])
+   {
+      //Link the upper levels. The node is already reachable, so a lost race
+      //only means that new nodes were linked after the predecessor.
+      for(std::size_t level = 1; level < h; ++level){
+         node_ptr pred = preds[level];
+         node_ptr succ = succs[level];
+         NodeTraits::set_next(new_node, level, succ);
+         while(!NodeTraits::cas_next(pred, level, succ, new_node)){
+            succ = NodeTraits::get_next(pred, level);
+            while(succ && comp(succ, new_node)){
+               pred = succ;
+               succ = NodeTraits::get_next(pred, level);
+            }
+            NodeTraits::set_next(new_node, level, succ);
+         }
+      }
+   }
+
+   template<bool Unique, class NodePtrCompare>
+   static std::pair<node_ptr, bool> priv_insert
+      (const node_ptr & header, const node_ptr & new_node, NodePtrCompare &comp)
+   {
+      position_compare<NodePtrCompare, !Unique> pos_comp(comp);
+      const std::size_t h = random_height(new_node);
+      const std::size_t top = raise_height(header, h);
+      node_ptr preds[max_height];
+      node_ptr succs[max_height];
+      NodeTraits::set_height(new_node, h);
+      for(;;){
+         priv_position(header, new_node, pos_comp, top, preds, succs);
+         if(Unique && succs[0] && !comp(new_node, succs[0])){
+            init(new_node);
+            return std::pair<node_ptr, bool>(succs[0], false);
+         }
+         for(std::size_t level = 0; level < h; ++level){
+            NodeTraits::set_next(new_node, level, succs[level]);
+         }
+         //The element is inserted once it's linked in the bottom level
+         if(NodeTraits::cas_next(preds[0], 0, succs[0], new_node))
+            break;
+      }
+      priv_link(new_node, pos_comp, h, preds, succs);
+      return std::pair<node_ptr, bool>(new_node, true);
+   }
+   /// @endcond
+
+   public:
+
+   //! <b>Effects</b>: Constructs an non-used skiplist element, putting all the
+   //!   links to null and the height to zero:
+   //!  <tt>NodeTraits::get_height(this_node) == 0</tt>
+   //!
+   //! <b>Complexity</b>: Linear to NodeTraits::max_height.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void init(const node_ptr & this_node)
+   {
+      for(std::size_t level = 0; level < max_height; ++level){
+         NodeTraits::set_next(this_node, level, node_ptr());
+      }
+      NodeTraits::set_height(this_node, 0);
+   }
+
+   //! <b>Effects</b>: Returns true if "this_node" is not inserted in a skiplist.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static bool unique(const const_node_ptr & this_node)
+   {  return NodeTraits::get_height(this_node) == 0;  }
+
+   //! <b>Effects</b>: Returns true if "this_node" has the same state as
+   //!  if it was inited using "init(node_ptr)"
+   //!
+   //! <b>Complexity</b>: Linear to NodeTraits::max_height.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static bool inited(const const_node_ptr & this_node)
+   {
+      for(std::size_t level = 0; level < max_height; ++level){
+         if(NodeTraits::get_next(this_node, level))
+            return false;
+      }
+      return NodeTraits::get_height(this_node) == 0;
+   }
+
+   //! <b>Effects</b>: Initializes the header to represent an empty skiplist.
+   //!
+   //! <b>Complexity</b>: Linear to NodeTraits::max_height.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static void init_header(const node_ptr & header)
+   {
+      for(std::size_t level = 0; level < max_height; ++level){
+         NodeTraits::set_next(header, level, node_ptr());
+      }
+      NodeTraits::set_height(header, 1);
+   }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist.
+   //!
+   //! <b>Effects</b>: Returns the first node of the skiplist or a null
+   //!   pointer if the skiplist is empty.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static node_ptr begin_node(const const_node_ptr & header)
+   {  return NodeTraits::get_next(header, 0);  }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist.
+   //!
+   //! <b>Effects</b>: Returns the number of nodes of the skiplist.
+   //!
+   //! <b>Complexity</b>: Linear.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static std::size_t count(const const_node_ptr & header)
+   {
+      std::size_t result = 0;
+      for(node_ptr n = NodeTraits::get_next(header, 0); n; n = NodeTraits::get_next(n, 0)){
+         ++result;
+      }
+      return result;
+   }
+
+   //! <b>Effects</b>: Returns the height that "this_node" will have when
+   //!   inserted: 1 plus the number of consecutive successful trials with
+   //!   probability 1/4, up to NodeTraits::max_height. Trials are drawn from a
+   //!   hash of the node's address, so no shared random state is needed.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: Nothing.
+   static std::size_t random_height(const const_node_ptr & this_node)
+   {
+      //MurmurHash3 finalizer
+      boost::uint64_t k = static_cast<boost::uint64_t>(reinterpret_cast<std::size_t>(this_node));
+      k ^= k >> 33;
+      k *= 0xff51afd7ed558ccdULL;
+      k ^= k >> 33;
+      k *= 0xc4ceb9fe1a85ec53ULL;
+      k ^= k >> 33;
+      std::size_t h = 1;
+      while(h < max_height && (k & 3u) == 0){
+         ++h;
+         k >>= 2;
+      }
+      return h;
+   }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the skiplist. KeyNodePtrCompare can compare KeyType with node_ptr's.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is
+   //!   not less than "key" according to "comp" or a null pointer if that
+   //!   element does not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other searches and insertions.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr lower_bound
+      (const const_node_ptr & header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      const_node_ptr x = header;
+      node_ptr n = node_ptr();
+      for(std::size_t level = NodeTraits::get_height(header); level--; ){
+         n = NodeTraits::get_next(x, level);
+         while(n && comp(n, key)){
+            x = n;
+            n = NodeTraits::get_next(x, level);
+         }
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the skiplist. KeyNodePtrCompare can compare KeyType with node_ptr's.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is greater
+   //!   than "key" according to "comp" or a null pointer if that element does
+   //!   not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other searches and insertions.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr upper_bound
+      (const const_node_ptr & header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      const_node_ptr x = header;
+      node_ptr n = node_ptr();
+      for(std::size_t level = NodeTraits::get_height(header); level--; ){
+         n = NodeTraits::get_next(x, level);
+         while(n && !comp(key, n)){
+            x = n;
+            n = NodeTraits::get_next(x, level);
+         }
+      }
+      return n;
+   }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist.
+   //!   KeyNodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the skiplist. KeyNodePtrCompare can compare KeyType with node_ptr's.
+   //!
+   //! <b>Effects</b>: Returns a node_ptr to the first element that is equivalent
+   //!   to "key" according to "comp" or a null pointer if that element does
+   //!   not exist.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other searches and insertions.
+   template<class KeyType, class KeyNodePtrCompare>
+   static node_ptr find
+      (const const_node_ptr & header, const KeyType &key, KeyNodePtrCompare comp)
+   {
+      node_ptr n = lower_bound(header, key, comp);
+      return (n && !comp(key, n)) ? n : node_ptr();
+   }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist and
+   //!   "new_node" must be a node initialized with "init".
+   //!   NodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the skiplist. NodePtrCompare compares two node_ptrs.
+   //!
+   //! <b>Effects</b>: Inserts new_node in the skiplist if no equivalent node
+   //!   is already present. Returns a pair containing new_node and true if
+   //!   the insertion succeeded, or the equivalent node and false otherwise.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other searches and insertions.
+   //!   If two equivalent nodes are inserted concurrently only one succeeds.
+   template<class NodePtrCompare>
+   static std::pair<node_ptr, bool> insert_unique
+      (const node_ptr & header, const node_ptr & new_node, NodePtrCompare comp)
+   {  return priv_insert<true>(header, new_node, comp);  }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist and
+   //!   "new_node" must be a node initialized with "init".
+   //!   NodePtrCompare is a function object that induces a strict weak
+   //!   ordering compatible with the strict weak ordering used to create the
+   //!   the skiplist. NodePtrCompare compares two node_ptrs.
+   //!
+   //! <b>Effects</b>: Inserts new_node in the skiplist. The relative order
+   //!   of equivalent nodes is unspecified.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other searches and insertions.
+   template<class NodePtrCompare>
+   static node_ptr insert_equal
+      (const node_ptr & header, const node_ptr & new_node, NodePtrCompare comp)
+   {  return priv_insert<false>(header, new_node, comp).first;  }
+
+   //! <b>Requires</b>: "header" must be the header of a skiplist and "z" must
+   //!   be a node of that skiplist.
+   //!   NodePtrCompare is the function object used to insert the nodes.
+   //!
+   //! <b>Effects</b>: Unlinks "z" from the skiplist. "z" is left with its
+   //!   links unchanged.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average plus linear to the number
+   //!   of nodes equivalent to "z".
+   //!
+   //! <b>Throws</b>: If "comp" throws.
+   //!
+   //! <b>Note</b>: Requires exclusive access to the skiplist.
+   template<class NodePtrCompare>
+   static void erase(const node_ptr & header, const node_ptr & z, NodePtrCompare comp)
+   {
+      const std::size_t h = NodeTraits::get_height(z);
+      node_ptr x = header;
+      for(std::size_t level = NodeTraits::get_height(header); level--; ){
+         node_ptr n = NodeTraits::get_next(x, level);
+         while(n && n != z && comp(n, z)){
+            x = n;
+            n = NodeTraits::get_next(x, level);
+         }
+         if(level < h){
+            //Skip equivalent nodes preceding z
+            while(n != z){
+               BOOST_INTRUSIVE_INVARIANT_ASSERT(n);
+               x = n;
+               n = NodeTraits::get_next(x, level);
+            }
+            NodeTraits::set_next(x, level, NodeTraits::get_next(z, level));
+         }
+      }
+   }
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SKIPLIST_ALGORITHMS_HPP
@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SKIPLIST_SET_HPP
+#define BOOST_INTRUSIVE_SKIPLIST_SET_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/skiplist.hpp>
+#include <boost/static_assert.hpp>
+#include <utility>   //std::pair
+
+namespace boost {
+namespace intrusive {
+
+//! The class template skiplist_set is an intrusive container that mimics most
+//! of the interface of std::set as described in the C++ standard, built on
+//! a skiplist that supports concurrent searches and insertions.
+//! See \c skiplist for the concurrency guarantees.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<>, \c size_type<> and
+//! \c compare<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1, class O2, class O3, class O4>
+#endif
+class skiplist_set
+   :  public make_skiplist<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type
+{
+   /// @cond
+   typedef typename make_skiplist
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type   Base;
+   typedef typename Base::real_value_traits  real_value_traits;
+   //Assert if passed value traits are compatible with the type
+   BOOST_STATIC_ASSERT((detail::is_same<typename real_value_traits::value_type, T>::value));
+   /// @endcond
+
+   public:
+   typedef typename Base::value_compare      value_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::reference          reference;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   //! <b>Effects</b>: Constructs an empty skiplist_set.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If the copy constructor of the value_compare object throws.
+   explicit skiplist_set( const value_compare &cmp = value_compare()
+                        , const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!
+   //! <b>Effects</b>: Constructs an empty skiplist_set and inserts elements from
+   //!   [b, e).
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the copy constructor/operator() of the value_compare object throws.
+   template<class Iterator>
+   skiplist_set( Iterator b, Iterator e
+               , const value_compare &cmp = value_compare()
+               , const value_traits &v_traits = value_traits())
+      :  Base(true, b, e, cmp, v_traits)
+   {}
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Tries to insert value into the skiplist_set.
+   //!
+   //! <b>Returns</b>: If the value is not already present inserts it and
+   //!   returns a pair containing the iterator to the new value and true.
+   //!   Otherwise returns an iterator to the equivalent value and false.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other insertions and searches.
+   std::pair<iterator, bool> insert(reference value)
+   {  return this->Base::insert_unique(value);  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Tries to insert each element of a range into the skiplist_set.
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Basic guarantee.
+   template<class Iterator>
+   void insert(Iterator b, Iterator e)
+   {  this->Base::insert_unique(b, e);  }
+};
+
+//! The class template skiplist_multiset is an intrusive container that mimics most
+//! of the interface of std::multiset as described in the C++ standard, built on
+//! a skiplist that supports concurrent searches and insertions.
+//! See \c skiplist for the concurrency guarantees. Unlike std::multiset,
+//! the relative order of equivalent elements is unspecified.
+//!
+//! The template parameter \c T is the type to be managed by the container.
+//! The user can specify additional options and if no options are provided
+//! default options are used.
+//!
+//! The container supports the following options:
+//! \c base_hook<>/member_hook<>/value_traits<>,
+//! \c constant_time_size<>, \c size_type<> and
+//! \c compare<>.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class T, class ...Options>
+#else
+template<class T, class O1, class O2, class O3, class O4>
+#endif
+class skiplist_multiset
+   :  public make_skiplist<T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type
+{
+   /// @cond
+   typedef typename make_skiplist
+      <T,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type   Base;
+   typedef typename Base::real_value_traits  real_value_traits;
+   //Assert if passed value traits are compatible with the type
+   BOOST_STATIC_ASSERT((detail::is_same<typename real_value_traits::value_type, T>::value));
+   /// @endcond
+
+   public:
+   typedef typename Base::value_compare      value_compare;
+   typedef typename Base::value_traits       value_traits;
+   typedef typename Base::reference          reference;
+   typedef typename Base::iterator           iterator;
+   typedef typename Base::const_iterator     const_iterator;
+
+   //! <b>Effects</b>: Constructs an empty skiplist_multiset.
+   //!
+   //! <b>Complexity</b>: Constant.
+   //!
+   //! <b>Throws</b>: If the copy constructor of the value_compare object throws.
+   explicit skiplist_multiset( const value_compare &cmp = value_compare()
+                             , const value_traits &v_traits = value_traits())
+      :  Base(cmp, v_traits)
+   {}
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue of type value_type.
+   //!
+   //! <b>Effects</b>: Constructs an empty skiplist_multiset and inserts elements from
+   //!   [b, e).
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the copy constructor/operator() of the value_compare object throws.
+   template<class Iterator>
+   skiplist_multiset( Iterator b, Iterator e
+                    , const value_compare &cmp = value_compare()
+                    , const value_traits &v_traits = value_traits())
+      :  Base(false, b, e, cmp, v_traits)
+   {}
+
+   //! <b>Requires</b>: value must be an lvalue
+   //!
+   //! <b>Effects</b>: Inserts value into the skiplist_multiset.
+   //!
+   //! <b>Returns</b>: An iterator that points to the position where the new
+   //!   element was inserted.
+   //!
+   //! <b>Complexity</b>: Logarithmic on average.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Strong guarantee.
+   //!
+   //! <b>Note</b>: Can be called concurrently with other insertions and searches.
+   iterator insert(reference value)
+   {  return this->Base::insert_equal(value);  }
+
+   //! <b>Requires</b>: Dereferencing iterator must yield an lvalue
+   //!   of type value_type.
+   //!
+   //! <b>Effects</b>: Inserts each element of a range into the skiplist_multiset.
+   //!
+   //! <b>Complexity</b>: N log N on average, where N is the distance between b and e.
+   //!
+   //! <b>Throws</b>: If the internal value_compare ordering function throws. Basic guarantee.
+   template<class Iterator>
+   void insert(Iterator b, Iterator e)
+   {  this->Base::insert_equal(b, e);  }
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SKIPLIST_SET_HPP
@@ -0,0 +1,255 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTRUSIVE_SKIPLIST_SET_HOOK_HPP
+#define BOOST_INTRUSIVE_SKIPLIST_SET_HOOK_HPP
+
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/intrusive_fwd.hpp>
+#include <boost/intrusive/detail/utilities.hpp>
+#include <boost/intrusive/detail/skiplist_node.hpp>
+#include <boost/intrusive/skiplist_algorithms.hpp>
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/detail/generic_hook.hpp>
+#include <boost/static_assert.hpp>
+
+namespace boost {
+namespace intrusive {
+
+/// @cond
+template<class VoidPointer, std::size_t MaxHeight>
+struct get_skiplist_set_node_algo
+{
+   typedef skiplist_algorithms<skiplist_node_traits<VoidPointer, MaxHeight> > type;
+};
+/// @endcond
+
+//! Helper metafunction to define a \c skiplist_set_base_hook that yields to the same
+//! type when the same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = none, class O2 = none, class O3 = none, class O4 = none>
+#endif
+struct make_skiplist_set_base_hook
+{
+   /// @cond
+   typedef typename pack_options
+      < hook_defaults,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+
+   //Skiplists can't be unlinked without accessing the container
+   BOOST_STATIC_ASSERT(((int)packed_options::link_mode != (int)auto_unlink));
+
+   typedef detail::generic_hook
+   < get_skiplist_set_node_algo<typename packed_options::void_pointer
+                               ,packed_options::max_height>
+   , typename packed_options::tag
+   , packed_options::link_mode
+   , detail::SkiplistSetBaseHook
+   > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//! Derive a class from skiplist_set_base_hook in order to store objects in
+//! in a skiplist_set/skiplist_multiset. skiplist_set_base_hook holds the data
+//! necessary to maintain the skiplist and provides an appropriate
+//! value_traits class for skiplist_set/skiplist_multiset.
+//!
+//! The hook admits the following options: \c tag<>, \c void_pointer<>,
+//! \c link_mode<> and \c max_height<>.
+//!
+//! \c tag<> defines a tag to identify the node.
+//! The same tag value can be used in different classes, but if a class is
+//! derived from more than one \c skiplist_set_base_hook, then each
+//! \c skiplist_set_base_hook needs its unique tag.
+//!
+//! \c void_pointer<> is the pointer type that will be used internally in the hook
+//! and the the container configured to use this hook. Links are atomic
+//! so only raw pointers are supported.
+//!
+//! \c link_mode<> will specify the linking mode of the hook (\c normal_link
+//! or \c safe_link). \c auto_unlink is not supported.
+//!
+//! \c max_height<> specifies the number of links stored in the hook, which
+//! limits the number of levels of the skiplist.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1, class O2, class O3, class O4>
+#endif
+class skiplist_set_base_hook
+   :  public make_skiplist_set_base_hook<
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3, O4
+         #else
+         Options...
+         #endif
+      >::type
+{
+   #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+   public:
+   //! <b>Effects</b>: If link_mode is \c safe_link
+   //!   initializes the node to an unlinked state.
+   //!
+   //! <b>Throws</b>: Nothing.
+   skiplist_set_base_hook();
+
+   //! <b>Effects</b>: If link_mode is \c safe_link
+   //!   initializes the node to an unlinked state. The argument is ignored.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Rationale</b>: Providing a copy-constructor
+   //!   makes classes using the hook STL-compliant without forcing the
+   //!   user to do some additional work.
+   skiplist_set_base_hook(const skiplist_set_base_hook& );
+
+   //! <b>Effects</b>: Empty function. The argument is ignored.
+   //!
+   //! <b>Throws</b>: Nothing.
+   //!
+   //! <b>Rationale</b>: Providing an assignment operator
+   //!   makes classes using the hook STL-compliant without forcing the
+   //!   user to do some additional work.
+   skiplist_set_base_hook& operator=(const skiplist_set_base_hook& );
+
+   //! <b>Effects</b>: If link_mode is \c normal_link, the destructor does
+   //!   nothing (ie. no code is generated). If link_mode is \c safe_link and the
+   //!   object is stored in a skiplist an assertion is raised.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~skiplist_set_base_hook();
+
+   //! <b>Precondition</b>: link_mode must be \c safe_link.
+   //!
+   //! <b>Returns</b>: true, if the node belongs to a container, false
+   //!   otherwise. This function can be used to test whether \c skiplist_set::iterator_to
+   //!   will return a valid iterator.
+   //!
+   //! <b>Complexity</b>: Constant
+   bool is_linked() const;
+   #endif
+};
+
+//! Helper metafunction to define a \c skiplist_set_member_hook that yields to the same
+//! type when the same options (either explicitly or implicitly) are used.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1 = none, class O2 = none, class O3 = none, class O4 = none>
+#endif
+struct make_skiplist_set_member_hook
+{
+   /// @cond
+   typedef typename pack_options
+      < hook_defaults,
+      #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+      O1, O2, O3, O4
+      #else
+      Options...
+      #endif
+      >::type packed_options;
+
+   //Skiplists can't be unlinked without accessing the container
+   BOOST_STATIC_ASSERT(((int)packed_options::link_mode != (int)auto_unlink));
+
+   typedef detail::generic_hook
+   < get_skiplist_set_node_algo<typename packed_options::void_pointer
+                               ,packed_options::max_height>
+   , member_tag
+   , packed_options::link_mode
+   , detail::NoBaseHook
+   > implementation_defined;
+   /// @endcond
+   typedef implementation_defined type;
+};
+
+//! Put a public data member skiplist_set_member_hook in order to store objects of this class in
+//! a skiplist_set/skiplist_multiset. skiplist_set_member_hook holds the data
+//! necessary for maintaining the skiplist and provides an appropriate
+//! value_traits class for skiplist_set/skiplist_multiset.
+//!
+//! The hook admits the following options: \c void_pointer<>,
+//! \c link_mode<> and \c max_height<>.
+//!
+//! \c void_pointer<> is the pointer type that will be used internally in the hook
+//! and the the container configured to use this hook. Links are atomic
+//! so only raw pointers are supported.
+//!
+//! \c link_mode<> will specify the linking mode of the hook (\c normal_link
+//! or \c safe_link). \c auto_unlink is not supported.
+//!
+//! \c max_height<> specifies the number of links stored in the hook, which
+//! limits the number of levels of the skiplist.
+#if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED) || defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+template<class ...Options>
+#else
+template<class O1, class O2, class O3, class O4>
+#endif
+class skiplist_set_member_hook
+   :  public make_skiplist_set_member_hook<
+         #if !defined(BOOST_INTRUSIVE_VARIADIC_TEMPLATES)
+         O1, O2, O3, O4
+         #else
+         Options...
+         #endif
+      >::type
+{
+   #if defined(BOOST_INTRUSIVE_DOXYGEN_INVOKED)
+   public:
+   //! <b>Effects</b>: If link_mode is \c safe_link
+   //!   initializes the node to an unlinked state.
+   //!
+   //! <b>Throws</b>: Nothing.
+   skiplist_set_member_hook();
+
+   //! <b>Effects</b>: If link_mode is \c safe_link
+   //!   initializes the node to an unlinked state. The argument is ignored.
+   //!
+   //! <b>Throws</b>: Nothing.
+   skiplist_set_member_hook(const skiplist_set_member_hook& );
+
+   //! <b>Effects</b>: Empty function. The argument is ignored.
+   //!
+   //! <b>Throws</b>: Nothing.
+   skiplist_set_member_hook& operator=(const skiplist_set_member_hook& );
+
+   //! <b>Effects</b>: If link_mode is \c normal_link, the destructor does
+   //!   nothing (ie. no code is generated). If link_mode is \c safe_link and the
+   //!   object is stored in a skiplist an assertion is raised.
+   //!
+   //! <b>Throws</b>: Nothing.
+   ~skiplist_set_member_hook();
+
+   //! <b>Precondition</b>: link_mode must be \c safe_link.
+   //!
+   //! <b>Returns</b>: true, if the node belongs to a container, false
+   //!   otherwise.
+   //!
+   //! <b>Complexity</b>: Constant
+   bool is_linked() const;
+   #endif
+};
+
+} //namespace intrusive
+} //namespace boost
+
+#include <boost/intrusive/detail/config_end.hpp>
+
+#endif //BOOST_INTRUSIVE_SKIPLIST_SET_HOOK_HPP
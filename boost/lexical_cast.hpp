@@ -40,6 +40,7 @@
 #include <boost/type_traits/is_pointer.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/detail/lcast_precision.hpp>
+#include <boost/detail/lcast_float.hpp>
 #include <boost/detail/workaround.hpp>
 
 
@@ -549,7 +550,18 @@ namespace boost {
 #endif
             > result_type;
 
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+            // float and double are written by lcast_put_float for any Char
+            BOOST_STATIC_CONSTANT(bool, value = (
+                boost::type_traits::ice_or<
+                    result_type::value,
+                    boost::is_same<Float, float>::value,
+                    boost::is_same<Float, double>::value
+                >::value
+            ));
+#else
             BOOST_STATIC_CONSTANT(bool, value = (result_type::value) );
+#endif
         };
     }
     
@@ -1162,32 +1174,6 @@ namespace boost {
 #  pragma warning(push) 
 #  pragma warning(disable:4244) 
 #endif 
-        template <class T>
-        struct mantissa_holder_type
-        {
-            /* Can not be used with this type */
-        };
-
-        template <>
-        struct mantissa_holder_type<float>
-        {
-            typedef unsigned int type;
-            typedef double       wide_result_t;
-        };
-
-        template <>
-        struct mantissa_holder_type<double>
-        {
-#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
-            typedef long double  wide_result_t;
-#if defined(BOOST_HAS_LONG_LONG)
-            typedef boost::ulong_long_type type;
-#elif defined(BOOST_HAS_MS_INT64)
-            typedef unsigned __int64 type;
-#endif
-#endif
-        };
-
         template<class Traits, class T, class CharT>
         inline bool lcast_ret_float(T& value, const CharT* begin, const CharT* end)
         {
@@ -1221,8 +1207,6 @@ namespace boost {
             if (parse_inf_nan(begin, end, value)) return true;
 
             typedef typename Traits::int_type int_type;
-            typedef BOOST_DEDUCED_TYPENAME mantissa_holder_type<T>::type mantissa_type;
-            typedef BOOST_DEDUCED_TYPENAME mantissa_holder_type<T>::wide_result_t wide_result_t;
             int_type const zero = Traits::to_int_type(czero);
             if (begin == end) return false;
 
@@ -1239,9 +1223,7 @@ namespace boost {
 
             bool found_decimal = false;
             bool found_number_before_exp = false;
-            int pow_of_10 = 0;
-            mantissa_type mantissa=0;
-            bool is_mantissa_full = false;
+            lcast_decimal decimal;
 
             char length_since_last_delim = 0;
 
@@ -1250,43 +1232,15 @@ namespace boost {
                 if (found_decimal) {
                     /* We allow no thousand_separators after decimal point */
 
-                    mantissa_type tmp_mantissa = mantissa * 10u;
                     if (Traits::eq(*begin, lowercase_e) || Traits::eq(*begin, capital_e)) break;
                     if ( *begin < czero || *begin >= czero + 10 ) return false;
-                    if (    is_mantissa_full
-                            || tmp_mantissa / 10u != mantissa
-                            || (std::numeric_limits<mantissa_type>::max)()-(*begin - zero) < tmp_mantissa
-                            ) {
-                        is_mantissa_full = true;
-                        ++ begin;
-                        continue;
-                    }
-
-                    -- pow_of_10;
-                    mantissa = tmp_mantissa;
-                    mantissa += *begin - zero;
+                    decimal.push_fraction_digit(static_cast<unsigned>(*begin - zero));
 
                     found_number_before_exp = true;
                 } else {
 
                     if (*begin >= czero && *begin < czero + 10) {
-
-                        /* Checking for mantissa overflow. If overflow will
-                         * occur, them we only increase multiplyer
-                         */
-                        mantissa_type tmp_mantissa = mantissa * 10u;
-                        if(     !is_mantissa_full
-                                && tmp_mantissa / 10u == mantissa
-                                && (std::numeric_limits<mantissa_type>::max)()-(*begin - zero) >= tmp_mantissa
-                            )
-                        {
-                            mantissa = tmp_mantissa;
-                            mantissa += *begin - zero;
-                        } else
-                        {
-                            is_mantissa_full = true;
-                            ++ pow_of_10;
-                        }
+                        decimal.push_integer_digit(static_cast<unsigned>(*begin - zero));
 
                         found_number_before_exp = true;
                         ++ length_since_last_delim;
@@ -1389,22 +1343,20 @@ namespace boost {
                 };
 
                 if ( exp_pow_of_10 ) {
-                    /* Overflows are checked lower */
+                    /* Overflows are checked lower, and any number this far
+                     * from the point is zero or too big anyway */
+                    if (exp_pow_of_10 > 100000) exp_pow_of_10 = 100000;
                     if ( exp_has_minus ) {
-                        pow_of_10 -= exp_pow_of_10;
+                        decimal.exponent -= exp_pow_of_10;
                     } else {
-                        pow_of_10 += exp_pow_of_10;
+                        decimal.exponent += exp_pow_of_10;
                     }
                 }
             }
 
-            /* We need a more accurate algorithm... We can not use current algorithm
-             * with long doubles (and with doubles if sizeof(double)==sizeof(long double)).
-             */
-            const wide_result_t result = std::pow(static_cast<wide_result_t>(10.0), pow_of_10) * mantissa;
-            value = static_cast<T>( has_minus ? (boost::math::changesign)(result) : result);
-
-            if ( (boost::math::isinf)(value) || (boost::math::isnan)(value) ) return false;
+            /* Rounded correctly, see lcast_decimal_to_float */
+            if (!lcast_decimal_to_float(decimal, value)) return false;
+            if (has_minus) value = (boost::math::changesign)(value);
 
             return true;
         }
@@ -1568,6 +1520,23 @@ namespace boost {
                 return shl_input_streamable(val);
             }
 
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+            template <class SomeCharT>
+            static bool shl_real_type(float val, SomeCharT* begin, SomeCharT*& end)
+            {
+                if (put_inf_nan(begin, end, val)) return true;
+                end = lcast_put_float(val, begin);
+                return true;
+            }
+
+            template <class SomeCharT>
+            static bool shl_real_type(double val, SomeCharT* begin, SomeCharT*& end)
+            {
+                if (put_inf_nan(begin, end, val)) return true;
+                end = lcast_put_float(val, begin);
+                return true;
+            }
+#else
             static bool shl_real_type(float val, char* begin, char*& end)
             {   using namespace std;
                 if (put_inf_nan(begin, end, val)) return true;
@@ -1594,6 +1563,7 @@ namespace boost {
                     "%.*g", static_cast<int>(boost::detail::lcast_get_precision<double>()), val);
                 return end > begin;
             }
+#endif
 
 #ifndef __MINGW32__
             static bool shl_real_type(long double val, char* begin, char*& end)
@@ -1612,6 +1582,7 @@ namespace boost {
 
 
 #if !defined(BOOST_LCAST_NO_WCHAR_T) && !defined(BOOST_NO_SWPRINTF) && !defined(__MINGW32__)
+#ifdef BOOST_LCAST_NO_FAST_FLOAT
             static bool shl_real_type(float val, wchar_t* begin, wchar_t*& end)
             {   using namespace std;
                 if (put_inf_nan(begin, end, val)) return true;
@@ -1630,6 +1601,7 @@ namespace boost {
                                           L"%.*g", static_cast<int>(boost::detail::lcast_get_precision<double >()), val );
                 return end > begin;
             }
+#endif
 
             static bool shl_real_type(long double val, wchar_t* begin, wchar_t*& end)
             {   using namespace std;
@@ -2119,6 +2091,9 @@ namespace boost {
 
             bool operator>>(double& output)
             {
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+                return lcast_ret_float<Traits>(output,start,finish);
+#else
                 /*
                  * Some compilers implement long double as double. In that case these types have
                  * same size, same precision, same max and min values... And it means,
@@ -2136,6 +2111,7 @@ namespace boost {
                 >::type tag = 0;
 
                 return float_types_converter_internal(output, tag);
+#endif
             }
 
             bool operator>>(long double& output)
@@ -0,0 +1,62 @@
+/* Copyright 2003-2013 Joaquin M Lopez Munoz.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/multi_index for library home page.
+ */
+
+#ifndef BOOST_MULTI_INDEX_BULK_LOAD_HPP
+#define BOOST_MULTI_INDEX_BULK_LOAD_HPP
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1200)
+#pragma once
+#endif
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+
+namespace boost{
+
+namespace multi_index{
+
+namespace detail{
+
+/* During bulk loading, indices whose preparation is costly (sorting the
+ * nodes in the case of ordered indices) register a bulk_load_task.
+ * Tasks are mutually independent and only read the values of the staged
+ * elements, so a bulk_load_t policy is free to run them concurrently.
+ */
+
+struct bulk_load_task
+{
+  virtual ~bulk_load_task(){}
+  virtual void run()=0;
+};
+
+} /* namespace multi_index::detail */
+
+/* bulk_load_t selects the bulk-load constructor of multi_index_container
+ * and determines how the preparation tasks of the indices are executed.
+ * The base class runs them sequentially in the calling thread; see
+ * boost/multi_index/parallel_bulk_load.hpp for a multithreaded version.
+ */
+
+struct bulk_load_t
+{
+  virtual ~bulk_load_t(){}
+
+  virtual void run(
+    detail::bulk_load_task* const* first,
+    detail::bulk_load_task* const* last)const
+  {
+    for(;first!=last;++first)(*first)->run();
+  }
+};
+
+const bulk_load_t bulk_load=bulk_load_t();
+
+} /* namespace multi_index */
+
+} /* namespace boost */
+
+#endif
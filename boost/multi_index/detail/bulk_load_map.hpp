@@ -0,0 +1,151 @@
+/* Copyright 2003-2013 Joaquin M Lopez Munoz.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/multi_index for library home page.
+ */
+
+#ifndef BOOST_MULTI_INDEX_DETAIL_BULK_LOAD_MAP_HPP
+#define BOOST_MULTI_INDEX_DETAIL_BULK_LOAD_MAP_HPP
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1200)
+#pragma once
+#endif
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <algorithm>
+#include <boost/detail/allocator_utilities.hpp>
+#include <boost/detail/no_exceptions_support.hpp>
+#include <boost/multi_index/bulk_load.hpp>
+#include <boost/multi_index/detail/auto_space.hpp>
+#include <boost/multi_index/detail/prevent_eti.hpp>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost{
+
+namespace multi_index{
+
+namespace detail{
+
+/* bulk_load_map is used as an auxiliary structure by the bulk-load
+ * constructor of multi_index_container. Elements are first staged into
+ * freshly allocated nodes, in input order; indices are then handed the
+ * whole sequence of nodes at once through the bulk_prepare_/bulk_link_
+ * backbone functions. As with copy_map, staged nodes are destroyed
+ * on destruction unless release() has been called.
+ */
+
+template <typename Node,typename Allocator>
+class bulk_load_map:private noncopyable
+{
+public:
+  typedef Node* const* const_iterator;
+
+  explicit bulk_load_map(const Allocator& al):
+    al_(al),capacity_(0),spc(al_,0),n(0),cursor(0),released(false)
+  {}
+
+  ~bulk_load_map()
+  {
+    for(std::size_t i=0;i<tasks.size();++i)delete tasks[i];
+    if(!released){
+      for(std::size_t i=0;i<n;++i){
+        boost::detail::allocator::destroy(&spc.data()[i]->value());
+        deallocate(spc.data()[i]);
+      }
+    }
+  }
+
+  const_iterator begin()const{return &*spc.data();}
+  const_iterator end()const{return &*spc.data()+n;}
+  std::size_t    size()const{return n;}
+  bool           empty()const{return n==0;}
+
+  template<typename Value>
+  void stage(const Value& v)
+  {
+    if(n==capacity_)grow();
+    Node* x=&*al_.allocate(1);
+    BOOST_TRY{
+      boost::detail::allocator::construct(&x->value(),v);
+    }
+    BOOST_CATCH(...){
+      deallocate(x);
+      BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+    spc.data()[n++]=x;
+  }
+
+  /* ownership of t is transferred to the map */
+
+  void add_task(bulk_load_task* t)
+  {
+    BOOST_TRY{
+      tasks.push_back(t);
+    }
+    BOOST_CATCH(...){
+      delete t;
+      BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+  }
+
+  void run_tasks(const bulk_load_t& bl)const
+  {
+    if(!tasks.empty())bl.run(&tasks[0],&tasks[0]+tasks.size());
+  }
+
+  /* tasks are retrieved in the same order they were added */
+
+  bulk_load_task* next_task()
+  {
+    return tasks[cursor++];
+  }
+
+  void release()
+  {
+    released=true;
+  }
+
+private:
+  typedef typename prevent_eti<
+    Allocator,
+    typename boost::detail::allocator::rebind_to<
+      Allocator,Node>::type
+  >::type                                         allocator_type;
+  typedef typename allocator_type::pointer        allocator_pointer;
+
+  allocator_type                                  al_;
+  std::size_t                                     capacity_;
+  auto_space<Node*,Allocator>                     spc;
+  std::size_t                                     n;
+  std::vector<bulk_load_task*>                    tasks;
+  std::size_t                                     cursor;
+  bool                                            released;
+
+  void grow()
+  {
+    std::size_t                 c=capacity_?2*capacity_:64;
+    auto_space<Node*,Allocator> spc1(al_,c);
+    if(n)std::copy(&*spc.data(),&*spc.data()+n,&*spc1.data());
+    spc.swap(spc1);
+    capacity_=c;
+  }
+
+  void deallocate(Node* node)
+  {
+    al_.deallocate(static_cast<allocator_pointer>(node),1);
+  }
+};
+
+} /* namespace multi_index::detail */
+
+} /* namespace multi_index */
+
+} /* namespace boost */
+
+#endif
@@ -17,6 +17,7 @@
 #include <boost/call_traits.hpp>
 #include <boost/detail/workaround.hpp>
 #include <boost/mpl/vector.hpp>
+#include <boost/multi_index/detail/bulk_load_map.hpp>
 #include <boost/multi_index/detail/copy_map.hpp>
 #include <boost/multi_index/detail/node_type.hpp>
 #include <boost/multi_index_container_fwd.hpp>
@@ -62,6 +63,9 @@ protected:
   typedef copy_map<
     final_node_type,
     final_allocator_type>                     copy_map_type;
+  typedef bulk_load_map<
+    final_node_type,
+    final_allocator_type>                     bulk_load_map_type;
 
 #if !defined(BOOST_MULTI_INDEX_DISABLE_SERIALIZATION)
   typedef index_saver<
@@ -83,6 +87,10 @@ protected:
     const index_base<Value,IndexSpecifierList,Allocator>&,const copy_map_type&)
   {}
 
+  void bulk_prepare_(bulk_load_map_type&){}
+
+  bool bulk_link_(bulk_load_map_type&){return true;}
+
   node_type* insert_(value_param_type v,node_type* x)
   {
     boost::detail::allocator::construct(&x->value(),v);
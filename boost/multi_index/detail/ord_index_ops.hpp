@@ -41,6 +41,11 @@
 #endif
 
 #include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <algorithm>
+#include <boost/multi_index/bulk_load.hpp>
+#include <boost/multi_index/detail/auto_space.hpp>
+#include <boost/multi_index/detail/ord_index_node.hpp>
+#include <cstddef>
 #include <utility>
 
 namespace boost{
@@ -138,6 +143,110 @@ inline std::pair<Node*,Node*> ordered_index_equal_range(
   return std::pair<Node*,Node*>(y,y);
 }
 
+/* Bulk loading of ordered indices: ordered_index_bulk_task sorts a copy of
+ * the staged nodes by key and, for unique indices, checks that no two of
+ * them are equivalent. Sorting is stable, so equivalent elements keep their
+ * input order, as happens with element-by-element insertion.
+ */
+
+template<typename Node,typename KeyFromValue,typename Compare>
+struct ordered_index_node_compare
+{
+  ordered_index_node_compare(const KeyFromValue& key_,const Compare& comp_):
+    key(key_),comp(comp_)
+  {}
+
+  bool operator()(const Node* x,const Node* y)const
+  {
+    return comp(key(x->value()),key(y->value()));
+  }
+
+  const KeyFromValue& key;
+  const Compare&      comp;
+};
+
+template<
+  typename Node,typename KeyFromValue,typename Compare,typename Allocator
+>
+class ordered_index_bulk_task:public bulk_load_task
+{
+public:
+  ordered_index_bulk_task(
+    Node* const* first,Node* const* last,
+    const KeyFromValue& key,const Compare& comp,bool unique,
+    const Allocator& al):
+    n(static_cast<std::size_t>(last-first)),spc(al,n),
+    cmp(key,comp),unique_(unique),ok(true)
+  {
+    std::copy(first,last,begin());
+  }
+
+  virtual void run()
+  {
+    std::stable_sort(begin(),end(),cmp);
+    if(unique_){
+      for(Node** it=begin(),**it_end=end();it!=it_end;++it){
+        if(it!=begin()&&!cmp(*(it-1),*it)){
+          ok=false;
+          break;
+        }
+      }
+    }
+  }
+
+  Node** begin()const{return &*spc.data();}
+  Node** end()const{return &*spc.data()+n;}
+  std::size_t size()const{return n;}
+  bool        succeeded()const{return ok;}
+
+private:
+  std::size_t                                           n;
+  auto_space<Node*,Allocator>                           spc;
+  ordered_index_node_compare<Node,KeyFromValue,Compare> cmp;
+  bool                                                  unique_;
+  bool                                                  ok;
+};
+
+/* ordered_index_build links the sorted sequence [first,first+n) into
+ * a perfectly balanced tree in linear time, with no comparisons or
+ * rotations. Splitting at the midpoint leaves every null link at depth
+ * floor(log2(n+1)) or one more, so painting black all the nodes above
+ * the first incomplete level and red those in it yields a valid red-black
+ * tree. The root of the tree is returned.
+ */
+
+template<typename Node,typename FinalNode>
+typename Node::impl_pointer ordered_index_build(
+  FinalNode* const* first,std::size_t n,typename Node::impl_pointer parent,
+  std::size_t depth,std::size_t red_depth)
+{
+  typedef typename Node::impl_pointer impl_pointer;
+
+  if(n==0)return impl_pointer(0);
+
+  std::size_t m=n/2;
+  Node*       x=static_cast<Node*>(first[m]);
+  x->parent()=parent;
+  x->color()=depth<red_depth?black:red;
+  x->left()=ordered_index_build<Node>(
+    first,m,x->impl(),depth+1,red_depth);
+  x->right()=ordered_index_build<Node>(
+    first+m+1,n-m-1,x->impl(),depth+1,red_depth);
+  return x->impl();
+}
+
+template<typename Node,typename FinalNode>
+void ordered_index_build(FinalNode* const* first,std::size_t n,Node* header)
+{
+  std::size_t red_depth=0;
+  while((std::size_t(2)<<red_depth)-1<=n)++red_depth;
+
+  header->parent()=ordered_index_build<Node>(
+    first,n,header->impl(),0,red_depth);
+  header->left()=static_cast<Node*>(first[0])->impl();
+  header->right()=static_cast<Node*>(first[n-1])->impl();
+}
+
 } /* namespace multi_index::detail */
 
 } /* namespace multi_index */
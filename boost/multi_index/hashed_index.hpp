@@ -168,6 +168,7 @@ protected:
     typename super::const_iterator_type_list,
     const_iterator>::type                     const_iterator_type_list;
   typedef typename super::copy_map_type       copy_map_type;
+  typedef typename super::bulk_load_map_type  bulk_load_map_type;
 
 #if !defined(BOOST_MULTI_INDEX_DISABLE_SERIALIZATION)
   typedef typename super::index_saver_type    index_saver_type;
@@ -690,6 +691,21 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     super::copy_(x,map);
   }
 
+  bool bulk_link_(bulk_load_map_type& map)
+  {
+    typedef typename bulk_load_map_type::const_iterator map_iterator;
+    reserve(map.size());
+    for(map_iterator it=map.begin(),it_end=map.end();it!=it_end;++it){
+      node_type*        x=static_cast<node_type*>(*it);
+      std::size_t       buc=find_bucket(x->value());
+      node_impl_pointer pos=buckets.at(buc);
+      if(!link_point(x->value(),pos,Category()))return false;
+      link(x,pos);
+      if(first_bucket>buc)first_bucket=buc;
+    }
+    return super::bulk_link_(map);
+  }
+
   node_type* insert_(value_param_type v,node_type* x)
   {
     reserve(size()+1);
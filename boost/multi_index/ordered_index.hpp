@@ -195,6 +195,7 @@ protected:
     typename super::const_iterator_type_list,
     const_iterator>::type                            const_iterator_type_list;
   typedef typename super::copy_map_type              copy_map_type;
+  typedef typename super::bulk_load_map_type         bulk_load_map_type;
 
 #if !defined(BOOST_MULTI_INDEX_DISABLE_SERIALIZATION)
   typedef typename super::index_saver_type           index_saver_type;
@@ -216,6 +217,9 @@ private:
     value_type>::param_type                          value_param_type;
   typedef typename call_traits<
     key_type>::param_type                            key_param_type;
+  typedef ordered_index_bulk_task<
+    final_node_type,KeyFromValue,Compare,
+    allocator_type>                                  bulk_task_type;
 
 public:
 
@@ -623,6 +627,22 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     super::copy_(x,map);
   }
 
+  void bulk_prepare_(bulk_load_map_type& map)
+  {
+    map.add_task(new bulk_task_type(
+      map.begin(),map.end(),key,comp_,
+      is_same<Category,ordered_unique_tag>::value,get_allocator()));
+    super::bulk_prepare_(map);
+  }
+
+  bool bulk_link_(bulk_load_map_type& map)
+  {
+    bulk_task_type* t=static_cast<bulk_task_type*>(map.next_task());
+    if(!t->succeeded())return false;
+    ordered_index_build(t->begin(),t->size(),header());
+    return super::bulk_link_(map);
+  }
+
   node_type* insert_(value_param_type v,node_type* x)
   {
     link_info inf;
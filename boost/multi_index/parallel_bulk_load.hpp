@@ -0,0 +1,111 @@
+/* Copyright 2003-2013 Joaquin M Lopez Munoz.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/multi_index for library home page.
+ */
+
+#ifndef BOOST_MULTI_INDEX_PARALLEL_BULK_LOAD_HPP
+#define BOOST_MULTI_INDEX_PARALLEL_BULK_LOAD_HPP
+
+#if defined(_MSC_VER)&&(_MSC_VER>=1200)
+#pragma once
+#endif
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <boost/exception_ptr.hpp>
+#include <boost/multi_index/bulk_load.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost{
+
+namespace multi_index{
+
+namespace detail{
+
+struct parallel_bulk_load_worker
+{
+  parallel_bulk_load_worker(
+    bulk_load_task* const* first_,std::size_t n_,
+    std::size_t start_,std::size_t stride_,exception_ptr& ep_):
+    first(first_),n(n_),start(start_),stride(stride_),ep(ep_)
+  {}
+
+  void operator()()const
+  {
+    try{
+      for(std::size_t i=start;i<n;i+=stride)first[i]->run();
+    }
+    catch(...){
+      ep=current_exception();
+    }
+  }
+
+  bulk_load_task* const* first;
+  std::size_t            n;
+  std::size_t            start;
+  std::size_t            stride;
+  exception_ptr&         ep;
+};
+
+} /* namespace multi_index::detail */
+
+/* parallel_bulk_load_t runs the preparation tasks of the indices (one per
+ * ordered index) on up to max_threads threads, the calling thread included;
+ * max_threads==0 means boost::thread::hardware_concurrency(). Key extractors
+ * and comparison predicates are then invoked concurrently from different
+ * threads, though always through const references.
+ * Using this header requires linking with Boost.Thread.
+ */
+
+struct parallel_bulk_load_t:bulk_load_t
+{
+  explicit parallel_bulk_load_t(std::size_t max_threads_=0):
+    max_threads(max_threads_)
+  {}
+
+  virtual void run(
+    detail::bulk_load_task* const* first,
+    detail::bulk_load_task* const* last)const
+  {
+    std::size_t n=static_cast<std::size_t>(last-first);
+    std::size_t t=max_threads?max_threads:thread::hardware_concurrency();
+    if(t>n)t=n;
+    if(t<=1){
+      bulk_load_t::run(first,last);
+      return;
+    }
+
+    std::vector<exception_ptr> eps(t);
+    thread_group               threads;
+    try{
+      for(std::size_t i=1;i<t;++i){
+        threads.create_thread(
+          detail::parallel_bulk_load_worker(first,n,i,t,eps[i]));
+      }
+    }
+    catch(...){
+      threads.join_all();
+      throw;
+    }
+    detail::parallel_bulk_load_worker(first,n,0,t,eps[0])();
+    threads.join_all();
+
+    for(std::size_t i=0;i<t;++i){
+      if(eps[i])rethrow_exception(eps[i]);
+    }
+  }
+
+  std::size_t max_threads;
+};
+
+const parallel_bulk_load_t parallel_bulk_load=parallel_bulk_load_t();
+
+} /* namespace multi_index */
+
+} /* namespace boost */
+
+#endif
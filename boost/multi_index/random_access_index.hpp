@@ -155,6 +155,7 @@ protected:
     typename super::const_iterator_type_list,
     const_iterator>::type                     const_iterator_type_list;
   typedef typename super::copy_map_type       copy_map_type;
+  typedef typename super::bulk_load_map_type  bulk_load_map_type;
 
 #if !defined(BOOST_MULTI_INDEX_DISABLE_SERIALIZATION)
   typedef typename super::index_saver_type    index_saver_type;
@@ -671,6 +672,16 @@ BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
     super::copy_(x,map);
   }
 
+  bool bulk_link_(bulk_load_map_type& map)
+  {
+    typedef typename bulk_load_map_type::const_iterator map_iterator;
+    ptrs.reserve(map.size());
+    for(map_iterator it=map.begin(),it_end=map.end();it!=it_end;++it){
+      ptrs.push_back(static_cast<node_type*>(*it)->impl());
+    }
+    return super::bulk_link_(map);
+  }
+
   node_type* insert_(value_param_type v,node_type* x)
   {
     ptrs.room_for_one();
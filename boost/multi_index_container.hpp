@@ -28,6 +28,7 @@
 #include <boost/mpl/size.hpp>
 #include <boost/mpl/deref.hpp>
 #include <boost/multi_index_container_fwd.hpp>
+#include <boost/multi_index/bulk_load.hpp>
 #include <boost/multi_index/detail/access_specifier.hpp>
 #include <boost/multi_index/detail/adl_swap.hpp>
 #include <boost/multi_index/detail/base_type.hpp>
@@ -242,6 +243,77 @@ public:
     BOOST_CATCH_END
   }
 
+  /* Bulk-load constructor: elements are staged in input order and then
+   * handed to all indices at once. Ordered indices sort their nodes once
+   * (these sorts being run as dictated by bl) and build a balanced tree in
+   * linear time. If some element would be rejected by a unique index, the
+   * staged elements are inserted one by one instead, so the resulting
+   * container is always the same as with the range constructor.
+   */
+
+  template<typename InputIterator>
+  multi_index_container(
+    const bulk_load_t& bl,InputIterator first,InputIterator last,
+
+#if BOOST_WORKAROUND(__IBMCPP__,<=600)
+    /* VisualAge seems to have an ETI issue with the default values
+     * for arguments args_list and al.
+     */
+
+    const ctor_args_list& args_list=
+      typename mpl::identity<multi_index_container>::type::
+        ctor_args_list(),
+    const allocator_type& al=
+      typename mpl::identity<multi_index_container>::type::
+        allocator_type()):
+#else
+    const ctor_args_list& args_list=ctor_args_list(),
+    const allocator_type& al=allocator_type()):
+#endif
+
+    bfm_allocator(al),
+    super(args_list,bfm_allocator::member),
+    node_count(0)
+  {
+    BOOST_MULTI_INDEX_CHECK_INVARIANT;
+    bulk_load_map_type map(bfm_allocator::member);
+    for(;first!=last;++first)map.stage(*first);
+    if(map.empty())return;
+
+    bool linked=false;
+    BOOST_TRY{
+      super::bulk_prepare_(map);
+      map.run_tasks(bl);
+      linked=super::bulk_link_(map);
+    }
+    BOOST_CATCH(...){
+      super::clear_();
+      BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+
+    if(linked){
+      map.release();
+      node_count=map.size();
+      return;
+    }
+
+    super::clear_();
+    BOOST_TRY{
+      iterator hint=super::end();
+      typedef typename bulk_load_map_type::const_iterator map_iterator;
+      for(map_iterator it=map.begin(),it_end=map.end();it!=it_end;++it){
+        hint=super::make_iterator(
+          insert_((*it)->value(),hint.get_node()).first);
+      }
+    }
+    BOOST_CATCH(...){
+      clear_();
+      BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+  }
+
   multi_index_container(
     const multi_index_container<Value,IndexSpecifierList,Allocator>& x):
     bfm_allocator(x.bfm_allocator::member),
@@ -448,7 +520,8 @@ public:
 #endif
 
 BOOST_MULTI_INDEX_PROTECTED_IF_MEMBER_TEMPLATE_FRIENDS:
-  typedef typename super::copy_map_type copy_map_type;
+  typedef typename super::copy_map_type      copy_map_type;
+  typedef typename super::bulk_load_map_type bulk_load_map_type;
 
   node_type* header()const
   {
@@ -1,8 +1,8 @@
 // ----------------------------------------------------------------------------
 // Copyright (C) 2002-2006 Marcin Kalicinski
 //
-// Distributed under the Boost Software License, Version 1.0. 
-// (See accompanying file LICENSE_1_0.txt or copy at 
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //
 // For more information, see www.boost.org
@@ -10,321 +10,598 @@
 #ifndef BOOST_PROPERTY_TREE_DETAIL_JSON_PARSER_READ_HPP_INCLUDED
 #define BOOST_PROPERTY_TREE_DETAIL_JSON_PARSER_READ_HPP_INCLUDED
 
-//#define BOOST_SPIRIT_DEBUG
-
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/detail/ptree_utils.hpp>
+#include <boost/property_tree/flat_ptree.hpp>
 #include <boost/property_tree/detail/json_parser_error.hpp>
-#include <boost/spirit/include/classic.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/limits.hpp>
 #include <string>
-#include <locale>
 #include <istream>
 #include <vector>
+#include <set>
 #include <algorithm>
 
 namespace boost { namespace property_tree { namespace json_parser
 {
 
     ///////////////////////////////////////////////////////////////////////
-    // Json parser context
-        
-    template<class Ptree>
-    struct context
+    // Json parser
+    //
+    // Reads JSON from a stream buffer one character at a time, and reports
+    // what it finds to a handler, which must provide:
+    //
+    //   bool begin_object();             // false skips the object
+    //   void end_object();
+    //   bool begin_array();              // false skips the array
+    //   void end_array();
+    //   bool member(const Str &name);    // false skips the member's value
+    //   void string_value(const Str &s);
+    //   void number_value(const Str &s); // the number as written
+    //   void boolean_value(bool b);
+    //   void null_value();
+    //
+    // Skipped values are still checked for errors, but nothing inside them
+    // is reported.  As well as standard JSON, the parser accepts // and
+    // /* */ comments, and adjacent strings, which are concatenated.
+
+    template<class Ch, class Handler>
+    class parser
     {
-
-        typedef typename Ptree::key_type::value_type Ch;
+    public:
         typedef std::basic_string<Ch> Str;
-        typedef typename std::vector<Ch>::iterator It;
-        
-        Str string;
-        Str name;
-        Ptree root;
-        std::vector<Ptree *> stack;
-
-        struct a_object_s
-        {
-            context &c;
-            a_object_s(context &c): c(c) { }
-            void operator()(Ch) const
+
+        parser(std::basic_streambuf<Ch> &buf, Handler &handler,
+               const std::string &filename):
+            m_buf(buf), m_handler(handler), m_filename(filename), m_line(1)
+        {
+        }
+
+        void parse()
+        {
+            skip_ws();
+            if (is('{'))
+                parse_object(true);
+            else if (is('['))
+                parse_array(true);
+            else
+                fail("expected object or array");
+            skip_ws();
+            if (!at_end())
+                fail("expected end of input");
+        }
+
+    private:
+        typedef std::char_traits<Ch> Tr;
+        typedef typename Tr::int_type int_type;
+
+        void fail(const char *message)
+        {
+            BOOST_PROPERTY_TREE_THROW(json_parser_error(message, m_filename, m_line));
+        }
+
+        bool at_end()
+        {
+            return Tr::eq_int_type(m_buf.sgetc(), Tr::eof());
+        }
+        bool is(char c)
+        {
+            return Tr::eq_int_type(m_buf.sgetc(), Tr::to_int_type(Ch(c)));
+        }
+        // The current character, or 0 at the end of the input:
+        Ch peek()
+        {
+            int_type c = m_buf.sgetc();
+            return Tr::eq_int_type(c, Tr::eof()) ? Ch(0) : Tr::to_char_type(c);
+        }
+        Ch next()
+        {
+            Ch c = Tr::to_char_type(m_buf.sbumpc());
+            if (c == Ch('\n'))
+                ++m_line;
+            return c;
+        }
+        bool consume(char c)
+        {
+            if (!is(c))
+                return false;
+            next();
+            return true;
+        }
+
+        static bool is_space(Ch c)
+        {
+            return c == Ch(' ') || c == Ch('\t') || c == Ch('\n') ||
+                   c == Ch('\r') || c == Ch('\f') || c == Ch('\v');
+        }
+        static bool is_digit(Ch c)
+        {
+            return c >= Ch('0') && c <= Ch('9');
+        }
+
+        // Skips white space and comments
+        void skip_ws()
+        {
+            for (;;)
             {
-                if (c.stack.empty())
-                    c.stack.push_back(&c.root);
-                else
+                if (at_end())
+                    return;
+                Ch c = peek();
+                if (is_space(c))
+                    next();
+                else if (c == Ch('/'))
                 {
-                    Ptree *parent = c.stack.back();
-                    Ptree *child = &parent->push_back(std::make_pair(c.name, Ptree()))->second;
-                    c.stack.push_back(child);
-                    c.name.clear();
+                    next();
+                    if (consume('/'))
+                    {
+                        while (!at_end() && next() != Ch('\n'))
+                            ;
+                    }
+                    else if (consume('*'))
+                    {
+                        for (;;)
+                        {
+                            if (at_end())
+                                fail("unterminated comment");
+                            if (next() == Ch('*') && is('/'))
+                                break;
+                        }
+                        next();
+                    }
+                    else
+                        fail("syntax error");
                 }
+                else
+                    return;
             }
-        };
-        
-        struct a_object_e
+        }
+
+        void parse_value(bool emit)
         {
-            context &c;
-            a_object_e(context &c): c(c) { }
-            void operator()(Ch) const
+            switch (peek())
             {
-                BOOST_ASSERT(c.stack.size() >= 1);
-                c.stack.pop_back();
+                case Ch('"'):
+                    parse_strings(emit);
+                    if (emit)
+                        m_handler.string_value(m_string);
+                    break;
+                case Ch('{'):
+                    parse_object(emit);
+                    break;
+                case Ch('['):
+                    parse_array(emit);
+                    break;
+                case Ch('t'):
+                    parse_literal("true");
+                    if (emit)
+                        m_handler.boolean_value(true);
+                    break;
+                case Ch('f'):
+                    parse_literal("false");
+                    if (emit)
+                        m_handler.boolean_value(false);
+                    break;
+                case Ch('n'):
+                    parse_literal("null");
+                    if (emit)
+                        m_handler.null_value();
+                    break;
+                default:
+                    if (!is('-') && !is_digit(peek()))
+                        fail("expected value");
+                    parse_number();
+                    if (emit)
+                        m_handler.number_value(m_string);
+                    break;
             }
-        };
+        }
 
-        struct a_name
+        void parse_object(bool emit)
         {
-            context &c;
-            a_name(context &c): c(c) { }
-            void operator()(It, It) const
+            next();
+            bool inner = emit && m_handler.begin_object();
+            skip_ws();
+            if (!consume('}'))
             {
-                c.name.swap(c.string);
-                c.string.clear();
+                for (;;)
+                {
+                    skip_ws();
+                    if (!is('"'))
+                        fail("expected object name");
+                    parse_strings(inner);
+                    if (!consume(':'))
+                        fail("expected ':'");
+                    bool keep = inner && m_handler.member(m_string);
+                    skip_ws();
+                    parse_value(keep);
+                    skip_ws();
+                    if (consume('}'))
+                        break;
+                    if (!consume(','))
+                        fail("expected ',' or '}'");
+                }
             }
-        };
+            if (inner)
+                m_handler.end_object();
+        }
 
-        struct a_string_val
+        void parse_array(bool emit)
         {
-            context &c;
-            a_string_val(context &c): c(c) { }
-            void operator()(It, It) const
+            next();
+            bool inner = emit && m_handler.begin_array();
+            skip_ws();
+            if (!consume(']'))
             {
-                BOOST_ASSERT(c.stack.size() >= 1);
-                c.stack.back()->push_back(std::make_pair(c.name, Ptree(c.string)));
-                c.name.clear();
-                c.string.clear();
+                for (;;)
+                {
+                    skip_ws();
+                    parse_value(inner);
+                    skip_ws();
+                    if (consume(']'))
+                        break;
+                    if (!consume(','))
+                        fail("expected ',' or ']'");
+                }
             }
-        };
+            if (inner)
+                m_handler.end_array();
+        }
+
+        // Reads one or more adjacent strings into m_string, and skips the
+        // white space after them
+        void parse_strings(bool emit)
+        {
+            m_string.clear();
+            do
+            {
+                parse_string(emit);
+                skip_ws();
+            } while (is('"'));
+        }
 
-        struct a_literal_val
+        void parse_string(bool emit)
         {
-            context &c;
-            a_literal_val(context &c): c(c) { }
-            void operator()(It b, It e) const
+            next();
+            for (;;)
             {
-                BOOST_ASSERT(c.stack.size() >= 1);
-                c.stack.back()->push_back(std::make_pair(c.name,
-                    Ptree(Str(b, e))));
-                c.name.clear();
-                c.string.clear();
+                if (at_end())
+                    fail("unterminated string");
+                Ch c = next();
+                if (c == Ch('"'))
+                    return;
+                if (c == Ch('\\'))
+                {
+                    if (at_end())
+                        fail("invalid escape sequence");
+                    c = next();
+                    switch (c)
+                    {
+                        case Ch('"'): case Ch('\\'): case Ch('/'): break;
+                        case Ch('b'): c = Ch('\b'); break;
+                        case Ch('f'): c = Ch('\f'); break;
+                        case Ch('n'): c = Ch('\n'); break;
+                        case Ch('r'): c = Ch('\r'); break;
+                        case Ch('t'): c = Ch('\t'); break;
+                        case Ch('u'): c = parse_unicode(); break;
+                        default: fail("invalid escape sequence");
+                    }
+                }
+                if (emit)
+                    m_string += c;
             }
-        };
+        }
 
-        struct a_char
+        Ch parse_unicode()
         {
-            context &c;
-            a_char(context &c): c(c) { }
-            void operator()(It b, It e) const
+            unsigned long u = 0;
+            for (int i = 0; i < 4; ++i)
             {
-                c.string += *b;
+                Ch c = peek();
+                if (is_digit(c))
+                    u = u * 16 + (c - Ch('0'));
+                else if (c >= Ch('a') && c <= Ch('f'))
+                    u = u * 16 + (c - Ch('a') + 10);
+                else if (c >= Ch('A') && c <= Ch('F'))
+                    u = u * 16 + (c - Ch('A') + 10);
+                else
+                    fail("invalid escape sequence");
+                next();
             }
-        };
+            // Code points the character type can't hold are clamped
+            u = (std::min)(u, static_cast<unsigned long>((std::numeric_limits<Ch>::max)()));
+            return Ch(u);
+        }
 
-        struct a_escape
+        // Reads a number, as written, into m_string
+        void parse_number()
         {
-            context &c;
-            a_escape(context &c): c(c) { }
-            void operator()(Ch ch) const
+            m_string.clear();
+            if (is('-'))
+                m_string += next();
+            if (is('0'))
+                m_string += next();
+            else
+                digits();
+            if (is('.'))
             {
-                switch (ch)
-                {
-                    case Ch('\"'): c.string += Ch('\"'); break;
-                    case Ch('\\'): c.string += Ch('\\'); break;
-                    case Ch('/'): c.string += Ch('/'); break;
-                    case Ch('b'): c.string += Ch('\b'); break;
-                    case Ch('f'): c.string += Ch('\f'); break;
-                    case Ch('n'): c.string += Ch('\n'); break;
-                    case Ch('r'): c.string += Ch('\r'); break;
-                    case Ch('t'): c.string += Ch('\t'); break;
-                    default: BOOST_ASSERT(0);
-                }
+                m_string += next();
+                digits();
+            }
+            if (is('e') || is('E'))
+            {
+                m_string += next();
+                if (is('+') || is('-'))
+                    m_string += next();
+                digits();
             }
-        };
+        }
+
+        void digits()
+        {
+            if (!is_digit(peek()))
+                fail("invalid number");
+            do
+                m_string += next();
+            while (is_digit(peek()));
+        }
 
-        struct a_unicode
+        void parse_literal(const char *s)
         {
-            context &c;
-            a_unicode(context &c): c(c) { }
-            void operator()(unsigned long u) const
+            for (; *s; ++s)
             {
-                u = (std::min)(u, static_cast<unsigned long>((std::numeric_limits<Ch>::max)()));
-                c.string += Ch(u);
+                if (!consume(*s))
+                    fail("expected value");
             }
-        };
+        }
 
+        std::basic_streambuf<Ch> &m_buf;
+        Handler &m_handler;
+        std::string m_filename;
+        unsigned long m_line;
+        Str m_string;
     };
 
     ///////////////////////////////////////////////////////////////////////
-    // Json grammar
+    // Handler which builds a property tree
 
-    template<class Ptree>
-    struct json_grammar :
-        public boost::spirit::classic::grammar<json_grammar<Ptree> >
+    struct keep_all
+    {
+        template<class Str>
+        bool operator()(const Str &) const
+        {
+            return true;
+        }
+    };
+
+    template<class Ptree, class Predicate = keep_all>
+    class ptree_builder
     {
-        
-        typedef context<Ptree> Context;
+    public:
         typedef typename Ptree::key_type::value_type Ch;
+        typedef std::basic_string<Ch> Str;
 
-        mutable Context c;
-        
-        template<class Scanner>
-        struct definition
+        explicit ptree_builder(Ptree &root, Predicate keep = Predicate()):
+            m_root(root), m_keep(keep), m_name(0),
+            m_blank(typename Ptree::key_type(), Ptree())
+        {
+        }
+
+        bool begin_object()
+        {
+            if (m_stack.empty())
+                m_stack.push_back(&m_root);
+            else
+                m_stack.push_back(&add()->second);
+            return true;
+        }
+        void end_object()
         {
-            
-            boost::spirit::classic::rule<Scanner>
-                root, object, member, array, item, value, string, number;
-            boost::spirit::classic::rule<
-                typename boost::spirit::classic::lexeme_scanner<Scanner>::type>
-                character, escape;
+            BOOST_ASSERT(!m_stack.empty());
+            m_stack.pop_back();
+            end_value();
+        }
+        bool begin_array()
+        {
+            return begin_object();
+        }
+        void end_array()
+        {
+            end_object();
+        }
+        bool member(const Str &name)
+        {
+            typename std::set<typename Ptree::key_type>::iterator it = m_keys.find(name);
+            if (it == m_keys.end())
+                it = m_keys.insert(typename Ptree::key_type(name)).first;
+            m_name = &*it;
+            if (is_same<Predicate, keep_all>::value)
+                return true;
+            m_lengths.push_back(std::make_pair(m_path.size(), m_stack.size()));
+            if (m_lengths.size() > 1)
+                m_path += Ch('.');
+            m_path += name;
+            if (m_keep(m_path))
+                return true;
+            end_value();
+            return false;
+        }
+        void string_value(const Str &s)
+        {
+            add()->second.data() = s;
+            end_value();
+        }
+        void number_value(const Str &s)
+        {
+            string_value(s);
+        }
+        void boolean_value(bool b)
+        {
+            string_value(detail::widen<Ch>(b ? "true" : "false"));
+        }
+        void null_value()
+        {
+            string_value(detail::widen<Ch>("null"));
+        }
 
-            definition(const json_grammar &self)
+    private:
+        // Adds a child with the name of the current member (or no name, in
+        // an array) to the innermost object or array
+        typename Ptree::iterator add()
+        {
+            BOOST_ASSERT(!m_stack.empty());
+            typename Ptree::iterator result = m_name ?
+                m_stack.back()->push_back(typename Ptree::value_type(*m_name, m_blank.second)) :
+                m_stack.back()->push_back(m_blank);
+            m_name = 0;
+            return result;
+        }
+        // Forgets the name of a member once its value has been read
+        void end_value()
+        {
+            m_name = 0;
+            if (!is_same<Predicate, keep_all>::value && !m_lengths.empty() &&
+                m_lengths.back().second == m_stack.size())
             {
+                m_path.resize(m_lengths.back().first);
+                m_lengths.pop_back();
+            }
+        }
 
-                using namespace boost::spirit::classic;
-                // There's a boost::assertion too, so another explicit using
-                // here:
-                using boost::spirit::classic::assertion;
-
-                // Assertions
-                assertion<std::string> expect_root("expected object or array");
-                assertion<std::string> expect_eoi("expected end of input");
-                assertion<std::string> expect_objclose("expected ',' or '}'");
-                assertion<std::string> expect_arrclose("expected ',' or ']'");
-                assertion<std::string> expect_name("expected object name");
-                assertion<std::string> expect_colon("expected ':'");
-                assertion<std::string> expect_value("expected value");
-                assertion<std::string> expect_escape("invalid escape sequence");
-
-                // JSON grammar rules
-                root 
-                    =   expect_root(object | array) 
-                        >> expect_eoi(end_p)
-                        ;
-                
-                object 
-                    =   ch_p('{')[typename Context::a_object_s(self.c)]
-                        >> (ch_p('}')[typename Context::a_object_e(self.c)] 
-                           | (list_p(member, ch_p(','))
-                              >> expect_objclose(ch_p('}')[typename Context::a_object_e(self.c)])
-                             )
-                           )
-                        ;
-                
-                member 
-                    =   expect_name(string[typename Context::a_name(self.c)]) 
-                        >> expect_colon(ch_p(':')) 
-                        >> expect_value(value)
-                        ;
-                
-                array 
-                    =   ch_p('[')[typename Context::a_object_s(self.c)]
-                        >> (ch_p(']')[typename Context::a_object_e(self.c)] 
-                            | (list_p(item, ch_p(','))
-                               >> expect_arrclose(ch_p(']')[typename Context::a_object_e(self.c)])
-                              )
-                           )
-                    ;
-
-                item 
-                    =   expect_value(value)
-                        ;
-
-                value 
-                    =   string[typename Context::a_string_val(self.c)] 
-                        | (number | str_p("true") | "false" | "null")[typename Context::a_literal_val(self.c)]
-                        | object 
-                        | array
-                        ;
-                
-                number 
-                    =   !ch_p("-") >>
-                        (ch_p("0") | (range_p(Ch('1'), Ch('9')) >> *digit_p)) >>
-                        !(ch_p(".") >> +digit_p) >>
-                        !(chset_p(detail::widen<Ch>("eE").c_str()) >>
-                          !chset_p(detail::widen<Ch>("-+").c_str()) >>
-                          +digit_p)
-                        ;
-
-                string
-                    =   +(lexeme_d[confix_p('\"', *character, '\"')])
-                        ;
-
-                character
-                    =   (anychar_p - "\\" - "\"")
-                            [typename Context::a_char(self.c)]
-                    |   ch_p("\\") >> expect_escape(escape)
-                    ;
-
-                escape
-                    =   chset_p(detail::widen<Ch>("\"\\/bfnrt").c_str())
-                            [typename Context::a_escape(self.c)]
-                    |   'u' >> uint_parser<unsigned long, 16, 4, 4>()
-                            [typename Context::a_unicode(self.c)]
-                    ;
-
-                // Debug
-                BOOST_SPIRIT_DEBUG_RULE(root);
-                BOOST_SPIRIT_DEBUG_RULE(object);
-                BOOST_SPIRIT_DEBUG_RULE(member);
-                BOOST_SPIRIT_DEBUG_RULE(array);
-                BOOST_SPIRIT_DEBUG_RULE(item);
-                BOOST_SPIRIT_DEBUG_RULE(value);
-                BOOST_SPIRIT_DEBUG_RULE(string);
-                BOOST_SPIRIT_DEBUG_RULE(number);
-                BOOST_SPIRIT_DEBUG_RULE(escape);
-                BOOST_SPIRIT_DEBUG_RULE(character);
+        Ptree &m_root;
+        Predicate m_keep;
+        std::vector<Ptree *> m_stack;
+        // Each name is stored once, and children copy it from here, so that
+        // with reference counted strings they all share the same characters
+        std::set<typename Ptree::key_type> m_keys;
+        const typename Ptree::key_type *m_name;
+        const typename Ptree::value_type m_blank;
+        // The path of the current member (array elements add nothing to
+        // it), and for it and each member enclosing it, the length of the
+        // path and the depth of the stack before it; used only to decide
+        // what to keep
+        Str m_path;
+        std::vector<std::pair<typename Str::size_type, std::size_t> > m_lengths;
+    };
 
-            }
+    ///////////////////////////////////////////////////////////////////////
+    // Handler which builds a flat property tree
 
-            const boost::spirit::classic::rule<Scanner> &start() const
-            {
-                return root;
-            }
+    template<class Ch>
+    class flat_ptree_builder
+    {
+    public:
+        typedef std::basic_string<Ch> Str;
 
-        };
+        flat_ptree_builder() : m_depth(0), m_named(false)
+        {
+        }
 
+        bool begin_object()
+        {
+            if (m_depth++ != 0)
+                open();
+            return true;
+        }
+        void end_object()
+        {
+            if (--m_depth != 0)
+                m_builder.close();
+        }
+        bool begin_array()
+        {
+            return begin_object();
+        }
+        void end_array()
+        {
+            end_object();
+        }
+        bool member(const Str &name)
+        {
+            m_name = name;
+            m_named = true;
+            return true;
+        }
+        void string_value(const Str &s)
+        {
+            open();
+            m_builder.data(s);
+            m_builder.close();
+        }
+        void number_value(const Str &s)
+        {
+            string_value(s);
+        }
+        void boolean_value(bool b)
+        {
+            string_value(detail::widen<Ch>(b ? "true" : "false"));
+        }
+        void null_value()
+        {
+            string_value(detail::widen<Ch>("null"));
+        }
+
+        void finish(basic_flat_ptree<Ch> &pt)
+        {
+            m_builder.finish(pt);
+        }
+
+    private:
+        // Opens a child with the name of the current member, or no name
+        // in an array
+        void open()
+        {
+            m_builder.open(m_named ? m_name : Str());
+            m_named = false;
+        }
+
+        typename basic_flat_ptree<Ch>::builder m_builder;
+        std::size_t m_depth;
+        Str m_name;
+        bool m_named;
     };
 
-    template<class It, class Ch>
-    unsigned long count_lines(It begin, It end)
+    template<class Ch, class Handler>
+    void parse_json_internal(std::basic_istream<Ch> &stream,
+                             Handler &handler,
+                             const std::string &filename)
     {
-        return static_cast<unsigned long>(std::count(begin, end, Ch('\n')) + 1);
+        if (!stream.good() || !stream.rdbuf())
+            BOOST_PROPERTY_TREE_THROW(json_parser_error("read error", filename, 0));
+        parser<Ch, Handler> p(*stream.rdbuf(), handler, filename);
+        p.parse();
     }
 
-    template<class Ptree>
+    template<class Ptree, class Predicate>
     void read_json_internal(std::basic_istream<typename Ptree::key_type::value_type> &stream,
                             Ptree &pt,
-                            const std::string &filename)
+                            const std::string &filename,
+                            Predicate keep)
     {
-
-        using namespace boost::spirit::classic;
-        typedef typename Ptree::key_type::value_type Ch;
-        typedef typename std::vector<Ch>::iterator It;
-
-        // Load data into vector
-        std::vector<Ch> v(std::istreambuf_iterator<Ch>(stream.rdbuf()),
-                          std::istreambuf_iterator<Ch>());
-        if (!stream.good())
-            BOOST_PROPERTY_TREE_THROW(json_parser_error("read error", filename, 0));
-        
-        // Prepare grammar
-        json_grammar<Ptree> g;
-
-        // Parse
-        try
-        {
-            parse_info<It> pi = parse(v.begin(), v.end(), g, 
-                                      space_p | comment_p("//") | comment_p("/*", "*/"));
-            if (!pi.hit || !pi.full)
-                BOOST_PROPERTY_TREE_THROW((parser_error<std::string, It>(v.begin(), "syntax error")));
-        }
-        catch (parser_error<std::string, It> &e)
+        // Build into a local tree, so that pt is unchanged on error
+        Ptree local;
         {
-            BOOST_PROPERTY_TREE_THROW(json_parser_error(e.descriptor, filename, count_lines<It, Ch>(v.begin(), e.where)));
+            ptree_builder<Ptree, Predicate> builder(local, keep);
+            parse_json_internal(stream, builder, filename);
         }
+        pt.swap(local);
+    }
 
-        // Swap grammar context root and pt
-        pt.swap(g.c.root);
+    template<class Ptree>
+    void read_json_internal(std::basic_istream<typename Ptree::key_type::value_type> &stream,
+                            Ptree &pt,
+                            const std::string &filename)
+    {
+        read_json_internal(stream, pt, filename, keep_all());
+    }
 
+    template<class Ch>
+    void read_json_internal(std::basic_istream<Ch> &stream,
+                            basic_flat_ptree<Ch> &pt,
+                            const std::string &filename)
+    {
+        flat_ptree_builder<Ch> builder;
+        parse_json_internal(stream, builder, filename);
+        builder.finish(pt);
     }
 
 } } }
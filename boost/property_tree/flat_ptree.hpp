@@ -0,0 +1,486 @@
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Sebastian Redl
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see www.boost.org
+// ----------------------------------------------------------------------------
+
+#ifndef BOOST_PROPERTY_TREE_FLAT_PTREE_HPP_INCLUDED
+#define BOOST_PROPERTY_TREE_FLAT_PTREE_HPP_INCLUDED
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/utility/string_ref.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/optional.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <typeinfo>
+
+namespace boost { namespace property_tree
+{
+
+    /**
+     * A read-only property tree whose nodes are stored together in one
+     * array, and whose keys and data are stored together in one character
+     * buffer, each key only once.
+     *
+     * A basic_flat_ptree is a handle to one node of such a tree: copying it,
+     * getting a child or iterating over children is cheap, and all handles
+     * to a tree share it. The children of a node are stored next to each
+     * other, in the order in which they were added. Looking a child up by
+     * key searches them in turn, so finds the first child with that key,
+     * like basic_ptree does.
+     *
+     * Trees are built with read_json, or from a basic_ptree with
+     * std::basic_string<Ch> keys and data, or with a builder.
+     */
+    template<class Ch>
+    class basic_flat_ptree
+    {
+    public:
+        // Basic types
+        typedef Ch                                          char_type;
+        typedef std::basic_string<Ch>                       string_type;
+        typedef basic_string_ref<Ch, std::char_traits<Ch> >  string_ref_type;
+        typedef std::size_t                                 size_type;
+        typedef basic_flat_ptree<Ch>                        self_type;
+        typedef string_path<string_type,
+                            id_translator<string_type> >    path_type;
+        typedef std::pair<string_ref_type, self_type>       value_type;
+        class const_iterator;
+        class builder;
+
+    private:
+        struct node
+        {
+            size_type key, key_size;        // in text
+            size_type data, data_size;      // in text
+            size_type children, child_count;  // in nodes
+        };
+        struct storage
+        {
+            std::vector<node> nodes;        // the root is the last
+            std::vector<Ch> text;
+        };
+
+    public:
+        /** Creates an empty tree. */
+        basic_flat_ptree() : m_node(0)
+        {
+            builder().finish(*this);
+        }
+
+        /** Creates a copy of a property tree. */
+        template<class C>
+        explicit basic_flat_ptree(
+            const basic_ptree<string_type, string_type, C> &pt)
+            : m_node(0)
+        {
+            builder b;
+            b.data(pt.data());
+            b.add_children(pt);
+            b.finish(*this);
+        }
+
+        /** Swap with another handle. */
+        void swap(self_type &rhs)
+        {
+            m_storage.swap(rhs.m_storage);
+            std::swap(m_node, rhs.m_node);
+        }
+
+        // Container view functions
+
+        /** The number of direct children of this node. */
+        size_type size() const
+        {
+            return get_node().child_count;
+        }
+
+        /** Whether there are any direct children. */
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /** An iterator to the first child, in order. */
+        const_iterator begin() const
+        {
+            return const_iterator(m_storage, get_node().children);
+        }
+
+        /** An iterator to one past the last child, in order. */
+        const_iterator end() const
+        {
+            const node &n = get_node();
+            return const_iterator(m_storage, n.children + n.child_count);
+        }
+
+        /** The first child with the given key, or end(). */
+        const_iterator find(const string_type &key) const
+        {
+            const node &n = get_node();
+            size_type i = n.children, e = n.children + n.child_count;
+            for (; i != e; ++i)
+            {
+                if (key_of(i) == string_ref_type(key))
+                    break;
+            }
+            return const_iterator(m_storage, i);
+        }
+
+        /** The number of children with the given key. */
+        size_type count(const string_type &key) const
+        {
+            const node &n = get_node();
+            size_type result = 0;
+            for (size_type i = n.children; i != n.children + n.child_count; ++i)
+            {
+                if (key_of(i) == string_ref_type(key))
+                    ++result;
+            }
+            return result;
+        }
+
+        // Property tree view functions
+
+        /** The data of this node, which is valid as long as any handle to
+         *  the tree exists. */
+        string_ref_type data() const
+        {
+            const node &n = get_node();
+            return string_ref_type(text() + n.data, n.data_size);
+        }
+
+        /** Get the child at the given path, or throw @c ptree_bad_path. */
+        self_type get_child(const path_type &path) const
+        {
+            if (optional<self_type> n = get_child_optional(path))
+                return *n;
+            BOOST_PROPERTY_TREE_THROW(ptree_bad_path("No such node", path));
+        }
+
+        /** Get the child at the given path, or return @p default_value. */
+        self_type get_child(const path_type &path,
+                            const self_type &default_value) const
+        {
+            if (optional<self_type> n = get_child_optional(path))
+                return *n;
+            return default_value;
+        }
+
+        /** Get the child at the given path, or return boost::null. */
+        optional<self_type> get_child_optional(const path_type &path) const
+        {
+            path_type p(path);
+            self_type n(*this);
+            while (!p.empty())
+            {
+                const_iterator i = n.find(p.reduce());
+                if (i == n.end())
+                    return optional<self_type>();
+                n.m_node = i.m_index;
+            }
+            return n;
+        }
+
+        /** Take the data of this node and convert it to a @p Type, using
+         *  the given translator, or return boost::null. */
+        template<class Type, class Translator>
+        optional<Type> get_value_optional(Translator tr) const
+        {
+            string_ref_type d = data();
+            return tr.get_value(string_type(d.begin(), d.end()));
+        }
+
+        /** Take the data of this node and convert it to a @p Type using
+         *  the default translator, or return boost::null. */
+        template<class Type>
+        optional<Type> get_value_optional() const
+        {
+            return get_value_optional<Type>(
+                typename translator_between<string_type, Type>::type());
+        }
+
+        /** Take the data of this node and convert it to a @p Type, or throw
+         *  @c ptree_bad_data. */
+        template<class Type>
+        Type get_value() const
+        {
+            if (optional<Type> o = get_value_optional<Type>())
+                return *o;
+            string_ref_type d = data();
+            BOOST_PROPERTY_TREE_THROW(ptree_bad_data(
+                std::string("conversion of data to type \"") +
+                typeid(Type).name() + "\" failed",
+                string_type(d.begin(), d.end())));
+        }
+
+        /** Take the data of this node and convert it to a @p Type, or
+         *  return @p default_value. */
+        template<class Type>
+        Type get_value(const Type &default_value) const
+        {
+            return get_value_optional<Type>().get_value_or(default_value);
+        }
+
+        /** Make get_value do the right thing for string literals. */
+        string_type get_value(const Ch *default_value) const
+        {
+            return get_value<string_type>(string_type(default_value));
+        }
+
+        /** Shorthand for get_child(path).get_value\<Type\>(). */
+        template<class Type>
+        Type get(const path_type &path) const
+        {
+            return get_child(path).BOOST_NESTED_TEMPLATE get_value<Type>();
+        }
+
+        /** Shorthand for get_optional\<Type\>(path) with a default. */
+        template<class Type>
+        Type get(const path_type &path, const Type &default_value) const
+        {
+            return get_optional<Type>(path).get_value_or(default_value);
+        }
+
+        /** Make get do the right thing for string literals. */
+        string_type get(const path_type &path, const Ch *default_value) const
+        {
+            return get<string_type>(path, string_type(default_value));
+        }
+
+        /** Get the data at the given path converted to a @p Type, or
+         *  return boost::null if there is no such node or the data can't
+         *  be converted. */
+        template<class Type>
+        optional<Type> get_optional(const path_type &path) const
+        {
+            if (optional<self_type> n = get_child_optional(path))
+                return n->BOOST_NESTED_TEMPLATE get_value_optional<Type>();
+            return optional<Type>();
+        }
+
+        /** Compares the contents of two trees, child order included. */
+        bool operator==(const self_type &rhs) const
+        {
+            if (data() != rhs.data() || size() != rhs.size())
+                return false;
+            for (const_iterator i = begin(), j = rhs.begin(); i != end(); ++i, ++j)
+            {
+                if (i->first != j->first || i->second != j->second)
+                    return false;
+            }
+            return true;
+        }
+
+        bool operator!=(const self_type &rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        basic_flat_ptree(const shared_ptr<const storage> &s, size_type n)
+            : m_storage(s), m_node(n)
+        {
+        }
+
+        const node &get_node() const
+        {
+            return m_storage->nodes[m_node];
+        }
+        const Ch *text() const
+        {
+            return m_storage->text.empty() ? 0 : &m_storage->text[0];
+        }
+        string_ref_type key_of(size_type i) const
+        {
+            const node &n = m_storage->nodes[i];
+            return string_ref_type(text() + n.key, n.key_size);
+        }
+
+        shared_ptr<const storage> m_storage;
+        size_type m_node;
+    };
+
+    /**
+     * Iterates over the children of a node, giving each one's key and a
+     * handle to it.
+     */
+    template<class Ch>
+    class basic_flat_ptree<Ch>::const_iterator
+        : public iterator_facade<const_iterator, const value_type,
+                                 random_access_traversal_tag, value_type>
+    {
+    public:
+        const_iterator() : m_index(0) { }
+
+    private:
+        friend class basic_flat_ptree<Ch>;
+        friend class boost::iterator_core_access;
+
+        const_iterator(const shared_ptr<const storage> &s, size_type i)
+            : m_storage(s), m_index(i)
+        {
+        }
+
+        value_type dereference() const
+        {
+            self_type child(m_storage, m_index);
+            return value_type(child.key_of(m_index), child);
+        }
+        bool equal(const const_iterator &rhs) const
+        {
+            return m_index == rhs.m_index;
+        }
+        void increment() { ++m_index; }
+        void decrement() { --m_index; }
+        void advance(std::ptrdiff_t n) { m_index += n; }
+        std::ptrdiff_t distance_to(const const_iterator &rhs) const
+        {
+            return static_cast<std::ptrdiff_t>(rhs.m_index) -
+                   static_cast<std::ptrdiff_t>(m_index);
+        }
+
+        shared_ptr<const storage> m_storage;
+        size_type m_index;
+    };
+
+    /**
+     * Builds a basic_flat_ptree one node at a time, in document order:
+     * each child is opened, given its data and children, and closed
+     * before its next sibling is opened. The root is open from the start.
+     */
+    template<class Ch>
+    class basic_flat_ptree<Ch>::builder
+    {
+    public:
+        builder() : m_storage(make_shared<storage>())
+        {
+            m_pending.push_back(blank());
+            m_starts.push_back(1);
+        }
+
+        /** Adds a child to the open node, and opens it. */
+        void open(const string_type &key)
+        {
+            typename std::map<string_type, size_type>::iterator i =
+                m_keys.find(key);
+            if (i == m_keys.end())
+                i = m_keys.insert(std::make_pair(key, append(key.data(), key.size()))).first;
+            node n = blank();
+            n.key = i->second;
+            n.key_size = key.size();
+            m_pending.push_back(n);
+            m_starts.push_back(m_pending.size());
+        }
+
+        /** Sets the data of the open node. */
+        void data(const Ch *s, size_type size)
+        {
+            node &n = m_pending[m_starts.back() - 1];
+            n.data = append(s, size);
+            n.data_size = size;
+        }
+
+        void data(const string_type &s)
+        {
+            data(s.data(), s.size());
+        }
+
+        /** Closes the open node, which can't be the root. */
+        void close()
+        {
+            BOOST_ASSERT(m_starts.size() > 1);
+            close_node();
+        }
+
+        /** Adds copies of the children of a property tree to the open
+         *  node. */
+        template<class C>
+        void add_children(const basic_ptree<string_type, string_type, C> &pt)
+        {
+            typedef typename basic_ptree<string_type, string_type, C>::const_iterator It;
+            for (It i = pt.begin(); i != pt.end(); ++i)
+            {
+                open(i->first);
+                data(i->second.data());
+                add_children(i->second);
+                close();
+            }
+        }
+
+        /** Closes any open nodes, and makes @p pt a handle to the root of
+         *  the tree. The builder can't be used again. */
+        void finish(self_type &pt)
+        {
+            while (m_starts.size() > 1)
+                close_node();
+            close_node();
+            storage &s = *m_storage;
+            // Release the memory used for growing the arrays
+            std::vector<node>(s.nodes).swap(s.nodes);
+            std::vector<Ch>(s.text).swap(s.text);
+            pt.m_storage = m_storage;
+            pt.m_node = s.nodes.size() - 1;
+        }
+
+    private:
+        static node blank()
+        {
+            node n = { 0, 0, 0, 0, 0, 0 };
+            return n;
+        }
+
+        size_type append(const Ch *s, size_type size)
+        {
+            size_type result = m_storage->text.size();
+            m_storage->text.insert(m_storage->text.end(), s, s + size);
+            return result;
+        }
+
+        // Moves the children of the open node into the tree, after which
+        // they're never moved again, then the node itself too if it's the
+        // root
+        void close_node()
+        {
+            std::vector<node> &nodes = m_storage->nodes;
+            size_type start = m_starts.back();
+            m_starts.pop_back();
+            node &n = m_pending[start - 1];
+            n.children = nodes.size();
+            n.child_count = m_pending.size() - start;
+            nodes.insert(nodes.end(), m_pending.begin() + start, m_pending.end());
+            m_pending.resize(start);
+            if (m_starts.empty())
+            {
+                nodes.push_back(n);
+                m_pending.clear();
+            }
+        }
+
+        shared_ptr<storage> m_storage;
+        // The open nodes and their children, with for each open node the
+        // index in m_pending of its first child
+        std::vector<node> m_pending;
+        std::vector<size_type> m_starts;
+        // Where each key is in the text
+        std::map<string_type, size_type> m_keys;
+    };
+
+    /** Swap two handles. */
+    template<class Ch>
+    inline void swap(basic_flat_ptree<Ch> &pt1, basic_flat_ptree<Ch> &pt2)
+    {
+        pt1.swap(pt2);
+    }
+
+} }
+
+#endif
@@ -11,6 +11,7 @@
 #define BOOST_PROPERTY_TREE_JSON_PARSER_HPP_INCLUDED
 
 #include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/flat_ptree.hpp>
 #include <boost/property_tree/detail/json_parser_read.hpp>
 #include <boost/property_tree/detail/json_parser_write.hpp>
 #include <boost/property_tree/detail/json_parser_error.hpp>
@@ -45,6 +46,73 @@ namespace boost { namespace property_tree { namespace json_parser
         read_json_internal(stream, pt, std::string());
     }
 
+    /**
+     * Read JSON from a the given stream and translate it to a property tree,
+     * leaving out the members for which @e keep returns false.
+     * @note Clears existing contents of property tree.  In case of error the
+     *       property tree unmodified.
+     * @note Skipped members are still checked for errors, but no memory is
+     *       allocated for them, so this can be used to read a small part of
+     *       a large file.
+     * @throw json_parser_error In case of error deserializing the property
+     *                          tree.
+     * @param stream Stream from which to read in the property tree.
+     * @param[out] pt The property tree to populate.
+     * @param keep Called with the path of each object member, with its
+     *             parts separated by '.', and returns whether to keep it.
+     *             Array elements add nothing to the path, so in
+     *             {"a":[{"b":1}]} the paths are "a" and "a.b".
+     */
+    template<class Ptree, class Predicate>
+    void read_json(std::basic_istream<
+                       typename Ptree::key_type::value_type
+                   > &stream,
+                   Ptree &pt,
+                   Predicate keep)
+    {
+        read_json_internal(stream, pt, std::string(), keep);
+    }
+
+    /**
+     * Read JSON from a the given stream and translate it to a flat property
+     * tree, as read_json does for a property tree.
+     * @note Reading into a flat property tree is faster, and the tree uses
+     *       less memory, but it can't be changed.
+     * @throw json_parser_error In case of error deserializing the property
+     *                          tree.
+     * @param stream Stream from which to read in the property tree.
+     * @param[out] pt The flat property tree to populate.
+     */
+    template<class Ch>
+    void read_json(std::basic_istream<Ch> &stream,
+                   basic_flat_ptree<Ch> &pt)
+    {
+        read_json_internal(stream, pt, std::string());
+    }
+
+    /**
+     * Read JSON from a the given stream, and report what is found to
+     * @e handler as it is found, without building a property tree.
+     * @note The handler is called as follows: @c begin_object() and
+     *       @c begin_array() at the start of each object or array, returning
+     *       false to skip it; @c end_object() and @c end_array() at the end
+     *       of each one not skipped; @c member(name) before the value of
+     *       each object member, returning false to skip the value; and
+     *       @c string_value(s), @c number_value(s), @c boolean_value(b) and
+     *       @c null_value() for each value.  Strings are passed as
+     *       @c std::basic_string<Ch>, and numbers as written.  The strings
+     *       passed are only valid until the handler returns.
+     * @throw json_parser_error In case of a syntax error, or if the handler
+     *                          throws it.
+     * @param stream Stream from which to read the JSON.
+     * @param handler The handler to report the contents to.
+     */
+    template<class Ch, class Handler>
+    void parse_json(std::basic_istream<Ch> &stream, Handler &handler)
+    {
+        parse_json_internal(stream, handler, std::string());
+    }
+
     /**
      * Read JSON from a the given file and translate it to a property tree.
      * @note Clears existing contents of property tree.  In case of error the
@@ -74,6 +142,28 @@ namespace boost { namespace property_tree { namespace json_parser
         read_json_internal(stream, pt, filename);
     }
 
+    /**
+     * Read JSON from a the given file and translate it to a flat property
+     * tree, as read_json does for a property tree.
+     * @throw json_parser_error In case of error deserializing the property
+     *                          tree.
+     * @param filename Name of file from which to read in the property tree.
+     * @param[out] pt The flat property tree to populate.
+     * @param loc The locale to use when reading in the file contents.
+     */
+    template<class Ch>
+    void read_json(const std::string &filename,
+                   basic_flat_ptree<Ch> &pt,
+                   const std::locale &loc = std::locale())
+    {
+        std::basic_ifstream<Ch> stream(filename.c_str());
+        if (!stream)
+            BOOST_PROPERTY_TREE_THROW(json_parser_error(
+                "cannot open file", filename, 0));
+        stream.imbue(loc);
+        read_json_internal(stream, pt, filename);
+    }
+
     /**
      * Translates the property tree to JSON and writes it the given output
      * stream.
@@ -132,6 +222,7 @@ namespace boost { namespace property_tree { namespace json_parser
 namespace boost { namespace property_tree
 {
     using json_parser::read_json;
+    using json_parser::parse_json;
     using json_parser::write_json;
     using json_parser::json_parser_error;
 } }
@@ -83,6 +83,8 @@ namespace boost { namespace property_tree
     class ptree_bad_data;
     class ptree_bad_path;
 
+    template <class Ch> class basic_flat_ptree;
+
     // Typedefs
 
     /** Implements a path using a std::string as the key. */
@@ -102,6 +104,9 @@ namespace boost { namespace property_tree
                         detail::less_nocase<std::string> >
         iptree;
 
+    /** A read-only property tree with std::string for key and data. */
+    typedef basic_flat_ptree<char> flat_ptree;
+
 #ifndef BOOST_NO_STD_WSTRING
     /** Implements a path using a std::wstring as the key. */
     typedef string_path<std::wstring, id_translator<std::wstring> > wpath;
@@ -121,6 +126,12 @@ namespace boost { namespace property_tree
     typedef basic_ptree<std::wstring, std::wstring,
                         detail::less_nocase<std::wstring> >
         wiptree;
+
+    /**
+     * A read-only property tree with std::wstring for key and data.
+     * @note The type only exists if the platform supports @c wchar_t.
+     */
+    typedef basic_flat_ptree<wchar_t> wflat_ptree;
 #endif
 
     // Free functions
@@ -281,6 +281,10 @@
 #  define BOOST_REGEX_MAX_STATE_COUNT 100000000
 #endif
 
+#ifndef BOOST_REGEX_MAX_DFA_STATES
+#  define BOOST_REGEX_MAX_DFA_STATES 512
+#endif
+
 
 /*****************************************************************************
  *
@@ -377,6 +381,10 @@ BOOST_REGEX_DECL void BOOST_REGEX_CALL reset_stack_guard_page();
 #  ifndef BOOST_REGEX_MAX_CACHE_BLOCKS
 #     define BOOST_REGEX_MAX_CACHE_BLOCKS 16
 #  endif
+#  if defined(BOOST_HAS_THREADS) && defined(BOOST_HAS_PTHREADS) && (BOOST_REGEX_MAX_CACHE_BLOCKS > 0) \
+      && !defined(BOOST_REGEX_NO_THREAD_BLOCK_CACHE) && !defined(BOOST_REGEX_THREAD_BLOCK_CACHE)
+#     define BOOST_REGEX_THREAD_BLOCK_CACHE
+#  endif
 #endif
 
 
@@ -392,7 +400,23 @@ namespace boost{ namespace re_detail{
 BOOST_REGEX_DECL void* BOOST_REGEX_CALL get_mem_block();
 BOOST_REGEX_DECL void BOOST_REGEX_CALL put_mem_block(void*);
 
-}} /* namespaces */
+} /* namespace re_detail */
+
+/*
+ * How many of the memory blocks used by the non-recursive matcher came
+ * from the block cache, and how many had to be allocated.  The counts are
+ * for the calling thread when BOOST_REGEX_THREAD_BLOCK_CACHE is defined,
+ * otherwise for the whole program, and are zero if the cache is disabled.
+ */
+struct regex_block_cache_statistics
+{
+   unsigned long hits;
+   unsigned long misses;
+};
+
+BOOST_REGEX_DECL regex_block_cache_statistics BOOST_REGEX_CALL get_regex_block_cache_statistics();
+
+} /* namespace boost */
 #endif
 
 /*****************************************************************************
@@ -81,11 +81,25 @@
 // if you don't want boost.regex to cache memory.
 // #define BOOST_REGEX_MAX_CACHE_BLOCKS 16
 
+// define this if you want all threads to share one cache of memory
+// blocks, protected by a mutex, rather than each thread having its own
+// cache of up to BOOST_REGEX_MAX_CACHE_BLOCKS blocks (only pthreads
+// platforms have per-thread caches).
+// #define BOOST_REGEX_NO_THREAD_BLOCK_CACHE
+
 // define this if you want to be able to access extended capture
 // information in your sub_match's (caution this will slow things
 // down quite a bit).
 // #define BOOST_REGEX_MATCH_EXTRA
 
+// define this if you don't want regex_search to use a lazily built DFA
+// for expressions without backreferences.
+// #define BOOST_REGEX_NO_LAZY_DFA
+
+// define this if you want to set the maximum number of states the lazy
+// DFA caches for each expression: each takes about 4k of memory.
+// #define BOOST_REGEX_MAX_DFA_STATES 512
+
 // define this if you want to enable support for Unicode via ICU.
 // #define BOOST_HAS_ICU
 
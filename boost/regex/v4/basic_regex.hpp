@@ -21,6 +21,7 @@
 
 #include <boost/type_traits/is_same.hpp>
 #include <boost/functional/hash.hpp>
+#include <boost/detail/atomic_count.hpp>
 
 #ifdef BOOST_MSVC
 #pragma warning(push)
@@ -49,6 +50,8 @@ namespace re_detail{
 //
 template <class charT, class traits>
 class basic_regex_parser;
+template <class charT, class traits>
+class lazy_dfa;
 
 template <class I>
 void bubble_down_one(I first, I last)
@@ -164,9 +167,9 @@ struct regex_data : public named_subexpressions
 
    regex_data(const ::boost::shared_ptr<
       ::boost::regex_traits_wrapper<traits> >& t) 
-      : m_ptraits(t), m_expression(0), m_expression_len(0) {}
+      : m_ptraits(t), m_expression(0), m_expression_len(0), m_dfa_created(0) {}
    regex_data() 
-      : m_ptraits(new ::boost::regex_traits_wrapper<traits>()), m_expression(0), m_expression_len(0) {}
+      : m_ptraits(new ::boost::regex_traits_wrapper<traits>()), m_expression(0), m_expression_len(0), m_dfa_created(0) {}
 
    ::boost::shared_ptr<
       ::boost::regex_traits_wrapper<traits>
@@ -186,6 +189,14 @@ struct regex_data : public named_subexpressions
       std::pair<
       std::size_t, std::size_t> > m_subs;                 // Position of sub-expressions within the *string*.
    bool                        m_has_recursions;          // whether we have recursive expressions;
+   bool                        m_can_use_dfa;             // whether searches can use the lazy DFA
+   const charT*                m_literal;                 // a string which every match contains, or null
+   std::size_t                 m_literal_length;          // the length of m_literal
+   bool                        m_literal_leading;         // whether every match starts with m_literal
+   unsigned char               m_literal_shift[1 << CHAR_BIT]; // Horspool skip table for m_literal
+   mutable ::boost::shared_ptr<
+      lazy_dfa<charT, traits> > m_dfa;                    // the lazy DFA, created on first use
+   mutable ::boost::detail::atomic_count m_dfa_created;   // non-zero once m_dfa has been set
 };
 //
 // class basic_regex_implementation
@@ -262,6 +262,8 @@ private:
    void set_bad_repeat(re_syntax_base* pt);
    syntax_element_type get_repeat_type(re_syntax_base* state);
    void probe_leading_repeat(re_syntax_base* state);
+   bool can_use_lazy_dfa(re_syntax_base* state);
+   void probe_literal(re_syntax_base* state);
 };
 
 template <class charT, class traits>
@@ -715,6 +717,10 @@ void basic_regex_creator<charT, traits>::finalize(const charT* p1, const charT*
    m_pdata->m_restart_type = get_restart_type(m_pdata->m_first_state);
    // optimise a leading repeat if there is one:
    probe_leading_repeat(m_pdata->m_first_state);
+   // see whether searches can use the lazy DFA:
+   m_pdata->m_can_use_dfa = !m_has_backrefs && !m_has_recursions && can_use_lazy_dfa(m_pdata->m_first_state);
+   // find a literal string which searches can skip to:
+   probe_literal(m_pdata->m_first_state);
 }
 
 template <class charT, class traits>
@@ -1544,6 +1550,155 @@ void basic_regex_creator<charT, traits>::probe_leading_repeat(re_syntax_base* st
    }while(state);
 }
 
+template <class charT, class traits>
+bool basic_regex_creator<charT, traits>::can_use_lazy_dfa(re_syntax_base* state)
+{
+   typedef typename traits::char_class_type m_type;
+   //
+   // The lazy DFA can only simulate states which look at no more than
+   // one character at a time, and which don't change case sensitivity
+   // part way through the expression.  We also limit the size of the
+   // machine and of counted repeats, so that each DFA state stays small:
+   //
+   static const std::size_t max_states = 2000;
+   static const std::size_t max_repeats = 1000;
+   bool l_icase = (m_pdata->m_flags & regbase::icase) != 0;
+   std::size_t count = 0;
+   while(state)
+   {
+      if(++count > max_states)
+         return false;
+      switch(state->type)
+      {
+      case syntax_element_startmark:
+      case syntax_element_endmark:
+         if((static_cast<re_brace*>(state)->index < 0) || (static_cast<re_brace*>(state)->icase != l_icase))
+            return false;
+         break;
+      case syntax_element_literal:
+      case syntax_element_wild:
+      case syntax_element_set:
+      case syntax_element_jump:
+      case syntax_element_alt:
+      case syntax_element_match:
+      case syntax_element_start_line:
+      case syntax_element_end_line:
+      case syntax_element_word_boundary:
+      case syntax_element_within_word:
+      case syntax_element_word_start:
+      case syntax_element_word_end:
+      case syntax_element_buffer_start:
+      case syntax_element_buffer_end:
+         break;
+      case syntax_element_long_set:
+         if(static_cast<re_set_long<m_type>*>(state)->singleton == 0)
+            return false;
+         break;
+      case syntax_element_rep:
+      case syntax_element_dot_rep:
+      case syntax_element_char_rep:
+      case syntax_element_short_set_rep:
+      case syntax_element_long_set_rep:
+         {
+            re_repeat* rep = static_cast<re_repeat*>(state);
+            std::size_t limit = (rep->max == (std::numeric_limits<std::size_t>::max)()) ? rep->min : rep->max;
+            if(limit > max_repeats)
+               return false;
+            // a failed search restarts after a leading non-greedy repeat,
+            // rather than at the next character, keep those results:
+            if(rep->leading && !rep->greedy)
+               return false;
+         }
+         break;
+      default:
+         return false;
+      }
+      state = state->next.p;
+   }
+   return true;
+}
+
+template <class charT, class traits>
+void basic_regex_creator<charT, traits>::probe_literal(re_syntax_base* state)
+{
+   //
+   // Look for a literal string which every match contains, by following
+   // the states which every match passes through: searches can then skip
+   // straight to the places where the literal occurs.  A literal which
+   // starts the match is preferred, otherwise we take the longest:
+   //
+   m_pdata->m_literal = 0;
+   m_pdata->m_literal_length = 0;
+   m_pdata->m_literal_leading = false;
+   if(m_pdata->m_flags & regbase::icase)
+      return;
+   bool leading = true;
+   while(state)
+   {
+      switch(state->type)
+      {
+      case syntax_element_startmark:
+      case syntax_element_endmark:
+         if((static_cast<re_brace*>(state)->index < 0) || static_cast<re_brace*>(state)->icase)
+            state = 0;
+         else
+            state = state->next.p;
+         break;
+      case syntax_element_start_line:
+      case syntax_element_end_line:
+      case syntax_element_word_boundary:
+      case syntax_element_within_word:
+      case syntax_element_word_start:
+      case syntax_element_word_end:
+      case syntax_element_buffer_start:
+      case syntax_element_buffer_end:
+         state = state->next.p;
+         break;
+      case syntax_element_literal:
+         {
+            std::size_t len = static_cast<re_literal*>(state)->length;
+            if(leading || (!m_pdata->m_literal_leading && (len > m_pdata->m_literal_length)))
+            {
+               m_pdata->m_literal = reinterpret_cast<const charT*>(static_cast<re_literal*>(state) + 1);
+               m_pdata->m_literal_length = len;
+               m_pdata->m_literal_leading = leading;
+            }
+         }
+         // fall through:
+      case syntax_element_wild:
+      case syntax_element_set:
+      case syntax_element_long_set:
+         leading = false;
+         state = state->next.p;
+         break;
+      case syntax_element_rep:
+      case syntax_element_dot_rep:
+      case syntax_element_char_rep:
+      case syntax_element_short_set_rep:
+      case syntax_element_long_set_rep:
+         // the repeat may match nothing, carry on after it:
+         leading = false;
+         state = static_cast<re_repeat*>(state)->alt.p;
+         break;
+      default:
+         state = 0;
+      }
+   }
+   if(m_pdata->m_literal == 0)
+      return;
+   //
+   // fill in the skip table, characters are hashed on their low byte,
+   // and each entry is the smallest shift of any character which maps to it:
+   //
+   std::size_t len = m_pdata->m_literal_length;
+   std::memset(m_pdata->m_literal_shift, static_cast<int>((std::min)(len, static_cast<std::size_t>(UCHAR_MAX))), sizeof(m_pdata->m_literal_shift));
+   for(std::size_t i = 0; i + 1 < len; ++i)
+   {
+      m_pdata->m_literal_shift[static_cast<unsigned char>(m_pdata->m_literal[i])]
+         = static_cast<unsigned char>((std::min)(len - 1 - i, static_cast<std::size_t>(UCHAR_MAX)));
+   }
+}
+
 
 } // namespace re_detail
 
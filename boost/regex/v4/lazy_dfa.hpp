@@ -0,0 +1,991 @@
+/*
+ *
+ * Copyright (c) 2013
+ * John Maddock
+ *
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+ /*
+  *   LOCATION:    see http://www.boost.org for most recent version.
+  *   FILE         lazy_dfa.hpp
+  *   VERSION      see <boost/version.hpp>
+  *   DESCRIPTION: Lazily constructed DFA used by regex_search for
+  *                expressions without backreferences.
+  */
+
+#ifndef BOOST_REGEX_V4_LAZY_DFA_HPP
+#define BOOST_REGEX_V4_LAZY_DFA_HPP
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <boost/shared_ptr.hpp>
+#include <boost/detail/atomic_count.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/regex/pending/static_mutex.hpp>
+#endif
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4103)
+#endif
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+#ifdef BOOST_MSVC
+#  pragma warning(push)
+#  pragma warning(disable: 4127 4800)
+#endif
+
+namespace boost{
+namespace re_detail{
+
+//
+// class lazy_dfa:
+// Searches for the leftmost match of an expression using perl's rules
+// for choosing between alternatives, but in a single forward pass over
+// the text.
+//
+// Each state of the DFA is the ordered list of threads that are still
+// alive in the state machine of the expression, highest priority first.
+// A thread records where it is in the machine, the iteration counts of
+// the repeats it is inside, and which of the possible start positions of
+// the match it belongs to (its "group").  Transitions are only computed
+// when they are first needed, and the number of states kept is bounded
+// by BOOST_REGEX_MAX_DFA_STATES; when that is exceeded the cache is
+// thrown away and rebuilt as required.  Characters which no state can
+// tell apart share a column of the transition tables.
+//
+// Only expressions accepted by basic_regex_creator::can_use_lazy_dfa
+// may be used.
+//
+// For a basic_regex_set the expression is the alternation of the patterns
+// in the set, each inside a marked sub-expression.  Then a thread's group
+// is the pattern it belongs to, and search_set finds every pattern which
+// matches rather than the leftmost match.
+//
+template <class charT, class traits>
+class lazy_dfa
+{
+   typedef typename traits::char_class_type char_class_type;
+
+   // the kinds of character which can precede a position:
+   enum
+   {
+      ctx_word = 1,
+      ctx_separator = 2,
+      ctx_cr = 4,
+      ctx_start = 8,      // there is no previous character
+      ctx_buffer_start = 16
+   };
+
+   struct dfa_state;
+   struct transition
+   {
+      dfa_state* next;   // the state we move to, null if not yet computed
+      int match;         // group of the match ending before the character, or -1, for a set
+                         // the offset in m_maps of the patterns which matched, or -1
+      int map;           // offset in m_maps of the group mapping, or -1 if unchanged
+   };
+   struct dfa_state
+   {
+      // key[0] is the context, key[1] is non-zero if we have a match,
+      // then come the threads, each m_width ints long.
+      std::vector<int> key;
+      int groups;
+      bool dead;
+      bool end_known;
+      int end_match;
+      std::vector<transition> table;    // indexed by character class
+      std::map<charT, transition> others;
+      dfa_state() : groups(0), dead(false), end_known(false), end_match(-1) {}
+   };
+   typedef std::map<std::vector<int>, dfa_state*> index_type;
+
+public:
+   explicit lazy_dfa(const regex_data<charT, traits>& d, const std::vector<int>* patterns = 0);
+
+   //
+   // Searches [first, last) for the leftmost match, at_start is true if
+   // first is the start of the text, in which case the character before it
+   // is only looked at with match_prev_avail.  Returns false if there is no match.
+   // If any is true we stop at the first match found.
+   //
+   template <class BidiIterator>
+   bool search(BidiIterator first, BidiIterator last, bool at_start, match_flag_type f, bool any, BidiIterator& match_first, BidiIterator& match_last);
+   //
+   // Searches [first, last) for each of the patterns of a set, and sets
+   // found[i] for every pattern i which matches:
+   //
+   template <class BidiIterator>
+   void search_set(BidiIterator first, BidiIterator last, match_flag_type f, std::vector<bool>& found);
+
+   ::boost::detail::atomic_count m_users;   // the number of threads trying to search with this object
+
+private:
+   lazy_dfa(const lazy_dfa&);
+   lazy_dfa& operator=(const lazy_dfa&);
+
+   int context(charT c)const
+   {
+      int result = 0;
+      if(m_traits.isctype(c, m_word_mask))
+         result |= ctx_word;
+      if(is_separator(c))
+         result |= ctx_separator;
+      if(c == static_cast<charT>('\r'))
+         result |= ctx_cr;
+      return result;
+   }
+   static int table_index(charT c)
+   {
+      unsigned char u = static_cast<unsigned char>(c);
+      return (static_cast<charT>(u) == c) ? u : -1;
+   }
+   void set_flags(match_flag_type f);
+   void flush();
+   void make_classes();
+   template <class BidiIterator>
+   BidiIterator skip(BidiIterator position, BidiIterator last, dfa_state*& s);
+   int matched_set();
+   dfa_state* intern(const std::vector<int>& key);
+   dfa_state* start_state(int ctx);
+   const transition& next(dfa_state*& s, charT c);
+   int end_match(dfa_state* s);
+
+   void closure(const std::vector<int>& key, int groups);
+   void visit(int idx, int off, int group, int from_back);
+   void visit_repeat(int idx, int group, int from_back);
+   void visit_single_repeat(int idx, int off, int group);
+   void add_thread(int idx, int off, int group);
+   bool matches(const re_syntax_base* ps, int off, charT c)const;
+   bool can_take(const re_alt* alt, unsigned char mask)const;
+   bool check_assertion(syntax_element_type t)const;
+
+   const regex_data<charT, traits>&                  m_data;
+   const ::boost::regex_traits_wrapper<traits>&      m_traits;
+   bool                                              m_icase;
+   char_class_type                                   m_word_mask;
+   bool                                              m_can_skip;     // whether we can use the start map to skip ahead
+   bool                                              m_line_start;   // whether every match starts at the start of a line
+   match_flag_type                                   m_flags;        // the match flags the states were built for
+   unsigned char                                     m_any_mask;     // mask for matching '.'
+
+   // the state machine of the expression, indexed in storage order:
+   std::vector<const re_syntax_base*>                m_states;
+   std::vector<int>                                  m_next;
+   std::vector<int>                                  m_alt;
+   std::vector<int>                                  m_slot;         // counter used by each general repeat, or -1
+   std::vector<std::size_t>                          m_limit;        // value at which each repeat's count stops changing
+   int                                               m_width;        // size of a thread
+   unsigned char                                     m_class[1u << CHAR_BIT]; // the class of each narrow character
+   std::size_t                                       m_classes;      // the number of classes
+   std::size_t                                       m_max_states;   // the size of the cache
+
+   // the cache of DFA states:
+   std::deque<dfa_state>                             m_cache;
+   index_type                                        m_index;
+   std::vector<int>                                  m_maps;         // group mappings, and the lists of patterns matched
+
+   // for a set, the pattern started by each marked sub-expression, or -1:
+   std::vector<int>                                  m_patterns;
+   std::size_t                                       m_pattern_count;
+
+   // scratch space used while computing a transition:
+   std::set<std::vector<int> >                       m_visited;
+   std::vector<int>                                  m_record;
+   std::vector<int>                                  m_counters;
+   std::vector<int>                                  m_path;         // general repeats entered without consuming a character
+   std::vector<int>                                  m_threads;
+   int                                               m_match;
+   std::vector<int>                                  m_matched;      // the patterns of a set which matched
+   bool                                              m_cut;
+   int                                               m_prev;
+   bool                                              m_at_end;
+   charT                                             m_char;
+};
+
+template <class charT, class traits>
+lazy_dfa<charT, traits>::lazy_dfa(const regex_data<charT, traits>& d, const std::vector<int>* patterns)
+   : m_users(0), m_data(d), m_traits(*d.m_ptraits),
+     m_icase((d.m_flags & regbase::icase) != 0), m_word_mask(d.m_word_mask),
+     m_can_skip(d.m_can_be_null == 0), m_line_start(d.m_restart_type == regbase::restart_line), m_flags(match_default),
+     m_any_mask(static_cast<unsigned char>(test_newline)), m_width(0), m_classes(0),
+     m_max_states(BOOST_REGEX_MAX_DFA_STATES), m_pattern_count(0),
+     m_match(-1), m_cut(false), m_prev(0), m_at_end(false), m_char(0)
+{
+   if(patterns)
+   {
+      m_patterns = *patterns;
+      m_pattern_count = m_patterns.size() - std::count(m_patterns.begin(), m_patterns.end(), -1);
+      // each state holds the progress of many patterns, so we need more of them:
+      m_max_states *= (std::max)(std::size_t(1), (std::min)(m_pattern_count, std::size_t(16)));
+   }
+   // number the states:
+   std::map<const re_syntax_base*, int> numbers;
+   for(const re_syntax_base* state = d.m_first_state; state; state = state->next.p)
+   {
+      numbers[state] = static_cast<int>(m_states.size());
+      m_states.push_back(state);
+   }
+   int repeats = 0;
+   for(std::size_t i = 0; i < m_states.size(); ++i)
+   {
+      const re_syntax_base* state = m_states[i];
+      m_next.push_back(state->next.p ? numbers[state->next.p] : -1);
+      m_alt.push_back(-1);
+      m_slot.push_back(-1);
+      m_limit.push_back(0);
+      switch(state->type)
+      {
+      case syntax_element_rep:
+         m_slot.back() = repeats++;
+         // fall through:
+      case syntax_element_dot_rep:
+      case syntax_element_char_rep:
+      case syntax_element_short_set_rep:
+      case syntax_element_long_set_rep:
+         {
+            const re_repeat* rep = static_cast<const re_repeat*>(state);
+            m_limit.back() = (rep->max == (std::numeric_limits<std::size_t>::max)()) ? rep->min : rep->max;
+         }
+         // fall through:
+      case syntax_element_jump:
+      case syntax_element_alt:
+         m_alt.back() = numbers[static_cast<const re_jump*>(state)->alt.p];
+         break;
+      default:
+         break;
+      }
+   }
+   m_width = repeats + 3;
+   make_classes();
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::make_classes()
+{
+   //
+   // Two characters are in the same class if every state, and every
+   // test made on the character before a position, treats them alike:
+   //
+   std::map<std::vector<bool>, unsigned char> classes;
+   std::vector<bool> signature;
+   for(unsigned u = 0; u < (1u << CHAR_BIT); ++u)
+   {
+      charT c = static_cast<charT>(u);
+      signature.assign(1, c == static_cast<charT>(0));
+      signature.push_back(c == static_cast<charT>('\n'));
+      signature.push_back(m_traits.isctype(c, m_word_mask));
+      signature.push_back(is_separator(c));
+      signature.push_back(c == static_cast<charT>('\r'));
+      for(std::size_t i = 0; i < m_states.size(); ++i)
+      {
+         const re_syntax_base* ps = m_states[i];
+         switch(ps->type)
+         {
+         case syntax_element_literal:
+            for(unsigned off = 0; off < static_cast<const re_literal*>(ps)->length; ++off)
+               signature.push_back(matches(ps, off, c));
+            break;
+         case syntax_element_wild:
+         case syntax_element_set:
+         case syntax_element_long_set:
+            signature.push_back(matches(ps, 0, c));
+            break;
+         case syntax_element_alt:
+         case syntax_element_rep:
+         case syntax_element_dot_rep:
+         case syntax_element_char_rep:
+         case syntax_element_short_set_rep:
+         case syntax_element_long_set_rep:
+            signature.push_back(can_start(c, static_cast<const re_alt*>(ps)->_map, static_cast<unsigned char>(mask_take)));
+            signature.push_back(can_start(c, static_cast<const re_alt*>(ps)->_map, static_cast<unsigned char>(mask_skip)));
+            break;
+         default:
+            break;
+         }
+      }
+      typename std::map<std::vector<bool>, unsigned char>::const_iterator pos = classes.find(signature);
+      if(pos == classes.end())
+         pos = classes.insert(std::make_pair(signature, static_cast<unsigned char>(classes.size()))).first;
+      m_class[u] = pos->second;
+   }
+   m_classes = classes.size();
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::set_flags(match_flag_type f)
+{
+   static const match_flag_type relevant =
+      match_not_bol | match_not_eol | match_not_bob | match_not_eob
+      | match_not_bow | match_not_eow | match_not_dot_newline
+      | match_not_dot_null | match_single_line;
+   f = static_cast<match_flag_type>(f & relevant);
+   if(f != m_flags)
+   {
+      // the states we have were built for different flags:
+      flush();
+      m_flags = f;
+      m_any_mask = static_cast<unsigned char>((f & match_not_dot_newline) ? test_not_newline : test_newline);
+   }
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::flush()
+{
+   m_index.clear();
+   m_cache.clear();
+   m_maps.clear();
+}
+
+template <class charT, class traits>
+typename lazy_dfa<charT, traits>::dfa_state* lazy_dfa<charT, traits>::intern(const std::vector<int>& key)
+{
+   typename index_type::iterator pos = m_index.find(key);
+   if(pos != m_index.end())
+      return pos->second;
+   m_cache.push_back(dfa_state());
+   dfa_state* s = &m_cache.back();
+   transition t = { 0, -1, -1 };
+   s->table.assign(m_classes, t);
+   s->key = key;
+   // groups are numbered in order of first appearance:
+   for(std::size_t i = 2; i < key.size(); i += m_width)
+      s->groups = (std::max)(s->groups, key[i + m_width - 1] + 1);
+   s->dead = key[1] && (key.size() == 2);
+   m_index.insert(std::make_pair(key, s));
+   return s;
+}
+
+template <class charT, class traits>
+typename lazy_dfa<charT, traits>::dfa_state* lazy_dfa<charT, traits>::start_state(int ctx)
+{
+   if(m_cache.size() >= m_max_states)
+      flush();
+   m_record.assign(2, 0);
+   m_record[0] = ctx;
+   return intern(m_record);
+}
+
+template <class charT, class traits>
+const typename lazy_dfa<charT, traits>::transition& lazy_dfa<charT, traits>::next(dfa_state*& s, charT c)
+{
+   int i = table_index(c);
+   if(i >= 0)
+   {
+      i = m_class[i];
+      if(s->table[i].next)
+         return s->table[i];
+   }
+   else
+   {
+      typename std::map<charT, transition>::const_iterator pos = s->others.find(c);
+      if(pos != s->others.end())
+         return pos->second;
+   }
+   //
+   // Work out which threads survive c, and in which order:
+   //
+   m_at_end = false;
+   m_char = c;
+   closure(s->key, s->groups);
+   transition t = { 0, m_match, -1 };
+   std::vector<int> key(2);
+   key[0] = context(c);
+   key[1] = (m_patterns.empty() && (s->key[1] || (m_match >= 0))) ? 1 : 0;
+   std::vector<int> groups;
+   std::set<std::vector<int> > seen;
+   for(std::size_t pos = 0; pos < m_threads.size(); pos += m_width)
+   {
+      // a thread which duplicates one with higher priority can never win:
+      std::vector<int> record(m_threads.begin() + pos, m_threads.begin() + pos + m_width - 1);
+      if(!seen.insert(record).second)
+         continue;
+      int g = m_threads[pos + m_width - 1];
+      if(!m_patterns.empty())
+      {
+         // the group is the pattern, which doesn't depend on where we are:
+         key.insert(key.end(), record.begin(), record.end());
+         key.push_back(g);
+         continue;
+      }
+      std::vector<int>::iterator j = std::find(groups.begin(), groups.end(), g);
+      key.insert(key.end(), record.begin(), record.end());
+      key.push_back(static_cast<int>(j - groups.begin()));
+      if(j == groups.end())
+         groups.push_back(g);
+   }
+   bool identity = true;
+   for(std::size_t j = 0; j < groups.size(); ++j)
+   {
+      if(groups[j] == s->groups)
+         groups[j] = -1;   // starts at the current position
+      if(groups[j] != static_cast<int>(j))
+         identity = false;
+   }
+   if(m_cache.size() >= m_max_states)
+   {
+      // the cache is full, start again with just the current state:
+      std::vector<int> current(s->key);
+      flush();
+      s = intern(current);
+   }
+   t.next = intern(key);
+   if(!m_patterns.empty())
+      t.match = matched_set();
+   if(!identity)
+   {
+      t.map = static_cast<int>(m_maps.size());
+      m_maps.insert(m_maps.end(), groups.begin(), groups.end());
+   }
+   if(i >= 0)
+      return s->table[i] = t;
+   return s->others[c] = t;
+}
+
+template <class charT, class traits>
+int lazy_dfa<charT, traits>::end_match(dfa_state* s)
+{
+   if(!s->end_known)
+   {
+      m_at_end = true;
+      closure(s->key, s->groups);
+      s->end_match = m_patterns.empty() ? m_match : matched_set();
+      s->end_known = true;
+   }
+   return s->end_match;
+}
+
+template <class charT, class traits>
+int lazy_dfa<charT, traits>::matched_set()
+{
+   // records the patterns of a set which matched in m_maps, as a
+   // list which ends with -1:
+   if(m_matched.empty())
+      return -1;
+   std::sort(m_matched.begin(), m_matched.end());
+   int result = static_cast<int>(m_maps.size());
+   m_maps.insert(m_maps.end(), m_matched.begin(), m_matched.end());
+   m_maps.push_back(-1);
+   return result;
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::closure(const std::vector<int>& key, int groups)
+{
+   //
+   // Follows each thread in priority order through the states which don't
+   // consume a character, and then over m_char, leaving the surviving
+   // threads in m_threads.  A new thread, starting at the current position,
+   // comes last unless we already have a match:
+   //
+   m_visited.clear();
+   m_threads.clear();
+   m_match = -1;
+   m_matched.clear();
+   m_cut = false;
+   m_prev = key[0];
+   for(std::size_t pos = 2; (pos < key.size()) && !m_cut; pos += m_width)
+   {
+      m_counters.assign(key.begin() + pos + 2, key.begin() + pos + m_width - 1);
+      m_path.clear();
+      visit(key[pos], key[pos + 1], key[pos + m_width - 1], 0);
+   }
+   if(!key[1] && !m_cut)
+   {
+      m_counters.assign(m_width - 3, 0);
+      m_path.clear();
+      visit(0, 0, groups, 0);
+   }
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::visit(int idx, int off, int group, int from_back)
+{
+   if(m_cut)
+      return;
+   // each position in the machine is followed once, by the thread with the
+   // highest priority, the repeats entered without consuming anything
+   // are part of the position as they decide when a repeat stops:
+   m_record.assign(1, idx);
+   m_record.push_back(off);
+   m_record.insert(m_record.end(), m_counters.begin(), m_counters.end());
+   m_record.push_back(from_back);
+   m_record.insert(m_record.end(), m_path.begin(), m_path.end());
+   if(!m_patterns.empty())
+      m_record.push_back(group);   // the patterns of a set share the states after them
+   if(!m_visited.insert(m_record).second)
+      return;
+
+   const re_syntax_base* ps = m_states[idx];
+   switch(ps->type)
+   {
+   case syntax_element_startmark:
+      if(!m_patterns.empty())
+      {
+         // the start of one of the patterns of a set:
+         int index = static_cast<const re_brace*>(ps)->index;
+         if((index > 0) && (index < static_cast<int>(m_patterns.size())) && (m_patterns[index] >= 0))
+            group = m_patterns[index];
+      }
+      visit(m_next[idx], 0, group, 0);
+      break;
+   case syntax_element_endmark:
+      visit(m_next[idx], 0, group, 0);
+      break;
+   case syntax_element_literal:
+      if(!m_at_end && matches(ps, off, m_char))
+      {
+         if(off + 1 < static_cast<int>(static_cast<const re_literal*>(ps)->length))
+            add_thread(idx, off + 1, group);
+         else
+            add_thread(m_next[idx], 0, group);
+      }
+      break;
+   case syntax_element_wild:
+   case syntax_element_set:
+   case syntax_element_long_set:
+      if(!m_at_end && matches(ps, off, m_char))
+         add_thread(m_next[idx], 0, group);
+      break;
+   case syntax_element_jump:
+      {
+         int target = m_alt[idx];
+         if((target < idx) && (m_slot[target] >= 0))
+         {
+            // the end of an iteration of a repeat, note whether the
+            // iteration was empty:
+            bool empty = std::find(m_path.begin(), m_path.end(), target) != m_path.end();
+            visit(target, 0, group, empty ? 2 : 1);
+         }
+         else
+            visit(target, 0, group, 0);
+      }
+      break;
+   case syntax_element_alt:
+      if(can_take(static_cast<const re_alt*>(ps), mask_take))
+         visit(m_next[idx], 0, group, 0);
+      if(can_take(static_cast<const re_alt*>(ps), mask_skip))
+         visit(m_alt[idx], 0, group, 0);
+      break;
+   case syntax_element_rep:
+      visit_repeat(idx, group, from_back);
+      break;
+   case syntax_element_dot_rep:
+   case syntax_element_char_rep:
+   case syntax_element_short_set_rep:
+   case syntax_element_long_set_rep:
+      visit_single_repeat(idx, off, group);
+      break;
+   case syntax_element_match:
+      if(!m_patterns.empty())
+      {
+         // in a set all the patterns which match are wanted:
+         if(std::find(m_matched.begin(), m_matched.end(), group) == m_matched.end())
+            m_matched.push_back(group);
+         break;
+      }
+      // everything with a lower priority than this thread is discarded:
+      m_match = group;
+      m_cut = true;
+      break;
+   default:
+      if(check_assertion(ps->type))
+         visit(m_next[idx], 0, group, 0);
+      break;
+   }
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::visit_repeat(int idx, int group, int from_back)
+{
+   //
+   // This follows perl_matcher::match_rep: the count is reset when we
+   // enter the repeat, and an empty iteration sets it to the maximum:
+   //
+   const re_repeat* rep = static_cast<const re_repeat*>(m_states[idx]);
+   int slot = m_slot[idx];
+   int saved = m_counters[slot];
+   std::size_t count = (from_back == 2) ? rep->max : from_back ? static_cast<std::size_t>(saved) : 0;
+   bool take_first = can_take(rep, mask_take);
+   bool take_second = can_take(rep, mask_skip);
+   bool exit_first = (count >= rep->min) && ((count >= rep->max) || !rep->greedy);
+   for(int pass = 0; pass < 2; ++pass)
+   {
+      if((pass == 0) == exit_first)
+      {
+         if((count >= rep->min) && take_second)
+         {
+            m_counters[slot] = 0;
+            visit(m_alt[idx], 0, group, 0);
+         }
+      }
+      else if((count < rep->max) && take_first)
+      {
+         m_counters[slot] = static_cast<int>((std::min)(count + 1, m_limit[idx]));
+         m_path.push_back(idx);
+         visit(m_next[idx], 0, group, 0);
+         m_path.pop_back();
+      }
+      m_counters[slot] = saved;
+   }
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::visit_single_repeat(int idx, int off, int group)
+{
+   const re_repeat* rep = static_cast<const re_repeat*>(m_states[idx]);
+   std::size_t count = static_cast<std::size_t>(off);
+   bool take = (count < rep->max) && !m_at_end && matches(rep->next.p, 0, m_char);
+   //
+   // Like perl_matcher::match_*_repeat, a greedy repeat leaves without
+   // looking at the next character once it can take no more, but it
+   // only backs off to where the rest of the expression can start:
+   //
+   bool skip = (count >= rep->min) && ((rep->greedy && !take) || can_take(rep, mask_skip));
+   bool exit_first = (count >= rep->min) && ((count >= rep->max) || !rep->greedy);
+   for(int pass = 0; pass < 2; ++pass)
+   {
+      if((pass == 0) == exit_first)
+      {
+         if(skip)
+            visit(m_alt[idx], 0, group, 0);
+      }
+      else if(take && !m_cut)
+         add_thread(idx, static_cast<int>((std::min)(count + 1, m_limit[idx])), group);
+   }
+}
+
+template <class charT, class traits>
+void lazy_dfa<charT, traits>::add_thread(int idx, int off, int group)
+{
+   m_threads.push_back(idx);
+   m_threads.push_back(off);
+   m_threads.insert(m_threads.end(), m_counters.begin(), m_counters.end());
+   m_threads.push_back(group);
+}
+
+template <class charT, class traits>
+bool lazy_dfa<charT, traits>::matches(const re_syntax_base* ps, int off, charT c)const
+{
+   switch(ps->type)
+   {
+   case syntax_element_literal:
+      return m_traits.translate(c, m_icase) == reinterpret_cast<const charT*>(static_cast<const re_literal*>(ps) + 1)[off];
+   case syntax_element_wild:
+      if(is_separator(c) && ((m_any_mask & static_cast<const re_dot*>(ps)->mask) == 0))
+         return false;
+      if((c == static_cast<charT>(0)) && (m_flags & match_not_dot_null))
+         return false;
+      return true;
+   case syntax_element_set:
+      return static_cast<const re_set*>(ps)->_map[static_cast<unsigned char>(m_traits.translate(c, m_icase))] != 0;
+   case syntax_element_long_set:
+      {
+         const charT* p = &c;
+         return re_is_set_member(p, p + 1, static_cast<const re_set_long<char_class_type>*>(ps), m_data, m_icase) != p;
+      }
+   default:
+      return false;
+   }
+}
+
+template <class charT, class traits>
+inline bool lazy_dfa<charT, traits>::can_take(const re_alt* alt, unsigned char mask)const
+{
+   // the same test as perl_matcher::match_alt, so that we agree with
+   // it over which branches can be taken:
+   return m_at_end ? (alt->can_be_null & mask) != 0 : can_start(m_char, alt->_map, mask);
+}
+
+template <class charT, class traits>
+bool lazy_dfa<charT, traits>::check_assertion(syntax_element_type t)const
+{
+   //
+   // These follow the corresponding perl_matcher::match_* members, given
+   // the kind of character before the current position (m_prev) and the
+   // character after it (m_char, unless m_at_end):
+   //
+   bool at_start = (m_prev & ctx_start) != 0;
+   bool prev_word = (m_prev & ctx_word) != 0;
+   bool next_word = !m_at_end && m_traits.isctype(m_char, m_word_mask);
+   switch(t)
+   {
+   case syntax_element_start_line:
+      if(at_start)
+         return (m_flags & match_not_bol) == 0;
+      if((m_flags & match_single_line) && ((m_prev & ctx_buffer_start) == 0))
+         return false;
+      if((m_prev & ctx_separator) == 0)
+         return false;
+      return m_at_end || !((m_prev & ctx_cr) && (m_char == static_cast<charT>('\n')));
+   case syntax_element_end_line:
+      if(m_at_end)
+         return (m_flags & match_not_eol) == 0;
+      if((m_flags & match_single_line) || !is_separator(m_char))
+         return false;
+      return at_start || !((m_prev & ctx_cr) && (m_char == static_cast<charT>('\n')));
+   case syntax_element_word_boundary:
+      {
+         bool b = m_at_end ? ((m_flags & match_not_eow) != 0) : next_word;
+         if(at_start)
+            b ^= ((m_flags & match_not_bow) != 0);
+         else
+            b ^= prev_word;
+         return b;
+      }
+   case syntax_element_within_word:
+      return !m_at_end && !at_start && (prev_word == next_word);
+   case syntax_element_word_start:
+      if(!next_word)
+         return false;
+      return at_start ? ((m_flags & match_not_bow) == 0) : !prev_word;
+   case syntax_element_word_end:
+      if(at_start || !prev_word)
+         return false;
+      return m_at_end ? ((m_flags & match_not_eow) == 0) : !next_word;
+   case syntax_element_buffer_start:
+      return (m_prev & (ctx_start | ctx_buffer_start)) && ((m_flags & match_not_bob) == 0);
+   case syntax_element_buffer_end:
+      return m_at_end && ((m_flags & match_not_eob) == 0);
+   default:
+      return false;
+   }
+}
+
+template <class charT, class traits>
+template <class BidiIterator>
+BidiIterator lazy_dfa<charT, traits>::skip(BidiIterator position, BidiIterator last, dfa_state*& s)
+{
+   //
+   // Nothing is in progress, skip characters that can't start a match:
+   //
+   BidiIterator p(position);
+   if(m_data.m_literal_leading)
+      p = find_literal(p, last, m_data.m_literal, m_data.m_literal_length, m_data.m_literal_shift);
+   else if(m_line_start)
+   {
+      if((s->key[0] & (ctx_separator | ctx_start | ctx_buffer_start)) == 0)
+      {
+         while((p != last) && !is_separator(*p))
+            ++p;
+         if(p != last)
+            ++p;
+      }
+   }
+   else if(m_can_skip)
+   {
+      while((p != last) && !can_start(*p, m_data.m_startmap, static_cast<unsigned char>(mask_any)))
+         ++p;
+   }
+   if(p != position)
+   {
+      position = p;
+      --p;
+      s = start_state(context(*p));
+   }
+   return position;
+}
+
+template <class charT, class traits>
+template <class BidiIterator>
+bool lazy_dfa<charT, traits>::search(BidiIterator first, BidiIterator last, bool at_start, match_flag_type f, bool any, BidiIterator& match_first, BidiIterator& match_last)
+{
+   set_flags(f);
+   BidiIterator position(first);
+   dfa_state* s;
+   if(at_start && ((f & match_prev_avail) == 0))
+      s = start_state(ctx_start);
+   else
+   {
+      BidiIterator t(position);
+      --t;
+      s = start_state(context(*t) | (at_start ? ctx_buffer_start : 0));
+   }
+   // where each group of threads started:
+   std::vector<BidiIterator> starts, temp;
+   bool result = false;
+   while(true)
+   {
+      if((s->groups == 0) && !s->key[1])
+         position = skip(position, last, s);
+      if(position == last)
+      {
+         int m = end_match(s);
+         if(m >= 0)
+         {
+            match_first = (m == s->groups) ? position : starts[m];
+            match_last = position;
+            result = true;
+         }
+         return result;
+      }
+      const transition& t = next(s, *position);
+      if(t.match >= 0)
+      {
+         match_first = (t.match == s->groups) ? position : starts[t.match];
+         match_last = position;
+         result = true;
+         if(any)
+            return true;
+      }
+      if(t.map < 0)
+         starts.resize(t.next->groups, position);
+      else
+      {
+         temp.resize(t.next->groups, position);
+         for(int i = 0; i < t.next->groups; ++i)
+         {
+            int g = m_maps[t.map + i];
+            temp[i] = (g < 0) ? position : starts[g];
+         }
+         starts.swap(temp);
+      }
+      s = t.next;
+      ++position;
+      if(s->dead)
+         return result;
+   }
+}
+
+template <class charT, class traits>
+template <class BidiIterator>
+void lazy_dfa<charT, traits>::search_set(BidiIterator first, BidiIterator last, match_flag_type f, std::vector<bool>& found)
+{
+   //
+   // Like search, but nothing is discarded when a pattern matches, and we
+   // carry on until every pattern has matched or we run out of text:
+   //
+   set_flags(f);
+   BidiIterator position(first);
+   dfa_state* s;
+   if((f & match_prev_avail) == 0)
+      s = start_state(ctx_start);
+   else
+   {
+      BidiIterator t(position);
+      --t;
+      s = start_state(context(*t) | ctx_buffer_start);
+   }
+   std::size_t remaining = m_pattern_count;
+   while(remaining)
+   {
+      if(s->groups == 0)
+         position = skip(position, last, s);
+      int m;
+      if(position == last)
+         m = end_match(s);
+      else
+      {
+         const transition& t = next(s, *position);
+         m = t.match;
+         s = t.next;
+      }
+      if(m >= 0)
+      {
+         for(; m_maps[m] >= 0; ++m)
+         {
+            if(!found[m_maps[m]])
+            {
+               found[m_maps[m]] = true;
+               --remaining;
+            }
+         }
+      }
+      if(position == last)
+         break;
+      ++position;
+   }
+}
+
+//
+// class scoped_lazy_dfa:
+// Gives one thread at a time the lazy DFA stored in an expression.  If
+// another thread is already using it, a temporary one is created.  Only
+// creating the shared DFA takes a lock: after that a thread claims it by
+// being the one to increment its count of users from zero.
+//
+template <class charT, class traits>
+class scoped_lazy_dfa
+{
+public:
+   explicit scoped_lazy_dfa(const regex_data<charT, traits>& d, const std::vector<int>* patterns = 0)
+      : m_shared(false)
+   {
+      if(d.m_dfa_created == 0)
+      {
+#ifdef BOOST_HAS_THREADS
+         static_mutex::scoped_lock l(get_mutex());
+#endif
+         if(!d.m_dfa)
+         {
+            d.m_dfa.reset(new lazy_dfa<charT, traits>(d, patterns));
+            ++d.m_dfa_created;
+         }
+      }
+      // d.m_dfa never changes once set, so can be read without the lock:
+      if(++d.m_dfa->m_users == 1)
+      {
+         m_dfa = d.m_dfa;
+         m_shared = true;
+      }
+      else
+      {
+         --d.m_dfa->m_users;
+         m_dfa.reset(new lazy_dfa<charT, traits>(d, patterns));
+      }
+   }
+   ~scoped_lazy_dfa()
+   {
+      if(m_shared)
+         --m_dfa->m_users;
+   }
+   lazy_dfa<charT, traits>* operator->()const
+   {
+      return m_dfa.get();
+   }
+private:
+#ifdef BOOST_HAS_THREADS
+   static static_mutex& get_mutex()
+   {
+      static static_mutex mut = BOOST_STATIC_MUTEX_INIT;
+      return mut;
+   }
+#endif
+   scoped_lazy_dfa(const scoped_lazy_dfa&);
+   scoped_lazy_dfa& operator=(const scoped_lazy_dfa&);
+
+   ::boost::shared_ptr<lazy_dfa<charT, traits> > m_dfa;
+   bool m_shared;
+};
+
+} // namespace re_detail
+} // namespace boost
+
+#ifdef BOOST_MSVC
+#  pragma warning(pop)
+#endif
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4103)
+#endif
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+#endif
@@ -19,7 +19,9 @@
 #define BOOST_REGEX_V4_MEM_BLOCK_CACHE_HPP
 
 #include <new>
-#ifdef BOOST_HAS_THREADS
+#ifdef BOOST_REGEX_THREAD_BLOCK_CACHE
+#include <pthread.h>
+#elif defined(BOOST_HAS_THREADS)
 #include <boost/regex/pending/static_mutex.hpp>
 #endif
 
@@ -35,16 +37,18 @@ struct mem_block_node
    mem_block_node* next;
 };
 
-struct mem_block_cache
+//
+// A list of free blocks, which does no locking of its own:
+//
+struct mem_block_list
 {
-   // this member has to be statically initialsed:
+   // these members have to be statically initialised:
    mem_block_node* next;
    unsigned cached_blocks;
-#ifdef BOOST_HAS_THREADS
-   boost::static_mutex mut;
-#endif
+   unsigned long hits;     // calls to get() which reused a cached block
+   unsigned long misses;   // calls to get() which had to allocate a new one
 
-   ~mem_block_cache()
+   void clear()
    {
       while(next)
       {
@@ -52,26 +56,23 @@ struct mem_block_cache
          next = next->next;
          ::operator delete(old);
       }
+      cached_blocks = 0;
    }
    void* get()
    {
-#ifdef BOOST_HAS_THREADS
-      boost::static_mutex::scoped_lock g(mut);
-#endif
-     if(next)
+      if(next)
       {
          mem_block_node* result = next;
          next = next->next;
          --cached_blocks;
+         ++hits;
          return result;
       }
+      ++misses;
       return ::operator new(BOOST_REGEX_BLOCKSIZE);
    }
    void put(void* p)
    {
-#ifdef BOOST_HAS_THREADS
-      boost::static_mutex::scoped_lock g(mut);
-#endif
       if(cached_blocks >= BOOST_REGEX_MAX_CACHE_BLOCKS)
       {
          ::operator delete(p);
@@ -86,6 +87,102 @@ struct mem_block_cache
    }
 };
 
+#ifdef BOOST_REGEX_THREAD_BLOCK_CACHE
+
+//
+// Each thread has its own list of blocks, found through a pthread key,
+// so getting and putting blocks takes no lock; a thread's list is freed
+// when the thread exits.  If a list can't be created for some reason,
+// blocks are allocated and freed every time:
+//
+extern "C" void free_thread_block_list(void* p);
+extern "C" void create_thread_block_key();
+
+struct mem_block_cache
+{
+   // these members have to be statically initialised:
+   pthread_once_t once;
+   bool has_key;
+   pthread_key_t key;
+
+   mem_block_list* list()
+   {
+      pthread_once(&once, &create_thread_block_key);
+      if(!has_key)
+         return 0;
+      mem_block_list* result = static_cast<mem_block_list*>(pthread_getspecific(key));
+      if(result == 0)
+      {
+         result = new (std::nothrow) mem_block_list();
+         if(result && pthread_setspecific(key, result))
+         {
+            delete result;
+            result = 0;
+         }
+      }
+      return result;
+   }
+   void* get()
+   {
+      mem_block_list* l = list();
+      return l ? l->get() : ::operator new(BOOST_REGEX_BLOCKSIZE);
+   }
+   void put(void* p)
+   {
+      mem_block_list* l = list();
+      if(l)
+         l->put(p);
+      else
+         ::operator delete(p);
+   }
+   regex_block_cache_statistics statistics()
+   {
+      mem_block_list* l = list();
+      regex_block_cache_statistics result = { l ? l->hits : 0, l ? l->misses : 0 };
+      return result;
+   }
+};
+
+#else
+
+struct mem_block_cache
+{
+   // these members have to be statically initialised:
+   mem_block_list blocks;
+#ifdef BOOST_HAS_THREADS
+   boost::static_mutex mut;
+#endif
+
+   ~mem_block_cache()
+   {
+      blocks.clear();
+   }
+   void* get()
+   {
+#ifdef BOOST_HAS_THREADS
+      boost::static_mutex::scoped_lock g(mut);
+#endif
+      return blocks.get();
+   }
+   void put(void* p)
+   {
+#ifdef BOOST_HAS_THREADS
+      boost::static_mutex::scoped_lock g(mut);
+#endif
+      blocks.put(p);
+   }
+   regex_block_cache_statistics statistics()
+   {
+#ifdef BOOST_HAS_THREADS
+      boost::static_mutex::scoped_lock g(mut);
+#endif
+      regex_block_cache_statistics result = { blocks.hits, blocks.misses };
+      return result;
+   }
+};
+
+#endif
+
 extern mem_block_cache block_cache;
 
 }
@@ -13,6 +13,8 @@
 #define BOOST_REGEX_MATCHER_HPP
 
 #include <boost/regex/v4/iterator_category.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/bool.hpp>
 
 #ifdef BOOST_MSVC
 #pragma warning(push)
@@ -76,6 +78,76 @@ inline bool can_start(unsigned int c, const unsigned char* map, unsigned char ma
 }
 #endif
 
+//
+// Iterators into contiguous narrow character storage, which we can
+// search with memchr:
+//
+template <class I>
+struct is_contiguous_char_iterator
+   : public mpl::bool_<
+      ::boost::is_same<I, const char*>::value || ::boost::is_same<I, char*>::value
+      || ::boost::is_same<I, std::string::const_iterator>::value || ::boost::is_same<I, std::string::iterator>::value>
+{};
+
+//
+// function find_char:
+// returns the first occurance of c in [first, last), or last:
+//
+template <class BidiIterator, class charT>
+inline BidiIterator find_char(BidiIterator first, BidiIterator last, charT c, const mpl::false_&)
+{
+   while((first != last) && (*first != c))
+      ++first;
+   return first;
+}
+template <class BidiIterator, class charT>
+inline BidiIterator find_char(BidiIterator first, BidiIterator last, charT c, const mpl::true_&)
+{
+   // memchr is usually much faster than a loop:
+   if(first == last)
+      return last;
+   const char* p = &*first;
+   const void* r = std::memchr(p, static_cast<unsigned char>(c), last - first);
+   return r ? first + (static_cast<const char*>(r) - p) : last;
+}
+
+//
+// function find_literal:
+// returns the first position in [first, last) at which the string
+// [p, p + len) occurs, or last if there is none.  shift is the
+// Horspool skip table created by basic_regex_creator::probe_literal.
+//
+template <class BidiIterator, class charT>
+BidiIterator find_literal(BidiIterator first, BidiIterator last, const charT* p, std::size_t len, const unsigned char* shift)
+{
+   typedef is_contiguous_char_iterator<BidiIterator> contiguous;
+   if(!contiguous::value && ::boost::is_random_access_iterator<BidiIterator>::value && (len > 3))
+   {
+      std::ptrdiff_t avail = ::boost::re_detail::distance(first, last);
+      while(avail >= static_cast<std::ptrdiff_t>(len))
+      {
+         BidiIterator t(first);
+         std::advance(t, len - 1);
+         if((*t == p[len - 1]) && std::equal(p, p + len - 1, first))
+            return first;
+         std::size_t s = shift[static_cast<unsigned char>(*t)];
+         std::advance(first, s);
+         avail -= s;
+      }
+      return last;
+   }
+   while((first = find_char(first, last, *p, contiguous())) != last)
+   {
+      BidiIterator t(first);
+      const charT* q = p;
+      while((++q != p + len) && (++t != last) && (*t == *q)){}
+      if(q == p + len)
+         return first;
+      ++first;
+   }
+   return last;
+}
+
 
 //
 // Unfortunately Rogue Waves standard library appears to have a bug
@@ -387,6 +459,9 @@ private:
 
    bool find_imp();
    bool match_imp();
+#ifndef BOOST_REGEX_NO_LAZY_DFA
+   bool find_lazy_dfa(bool& found);
+#endif
 #ifdef BOOST_REGEX_HAS_MS_STACK_GUARD
    typedef bool (perl_matcher::*protected_proc_type)();
    bool protected_call(protected_proc_type);
@@ -572,6 +647,10 @@ private:
 #  pragma warning(pop)
 #endif
 
+//
+// the lazy DFA used by find_imp:
+//
+#include <boost/regex/v4/lazy_dfa.hpp>
 //
 // include the implementation of perl_matcher:
 //
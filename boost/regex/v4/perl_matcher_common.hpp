@@ -292,6 +292,17 @@ bool perl_matcher<BidiIterator, Allocator, traits>::find_imp()
    }
 
    verify_options(re.flags(), m_match_flags);
+   // if there's a literal string which every match contains, and it's
+   // not in the text, then there can't be a match:
+   if(re.get_data().m_literal && !re.get_data().m_literal_leading && ((m_match_flags & match_partial) == 0)
+      && (find_literal(position, last, re.get_data().m_literal, re.get_data().m_literal_length, re.get_data().m_literal_shift) == last))
+      return false;
+#ifndef BOOST_REGEX_NO_LAZY_DFA
+   // see if the lazy DFA can settle this search in linear time:
+   bool found;
+   if(find_lazy_dfa(found))
+      return found;
+#endif
    // find out what kind of expression we have:
    unsigned type = (m_match_flags & match_continuous) ? 
       static_cast<unsigned int>(regbase::restart_continue) 
@@ -314,6 +325,46 @@ bool perl_matcher<BidiIterator, Allocator, traits>::find_imp()
 #endif
 }
 
+#ifndef BOOST_REGEX_NO_LAZY_DFA
+template <class BidiIterator, class Allocator, class traits>
+bool perl_matcher<BidiIterator, Allocator, traits>::find_lazy_dfa(bool& found)
+{
+   //
+   // Returns true if the search has been carried out, with the result
+   // in found.  The lazy DFA finds where the match starts and ends,
+   // if we need the sub-expressions as well then they're filled in by
+   // matching again from the start of the match.  With match_any the
+   // caller only wants to know whether there is a match, so we don't:
+   //
+   static const match_flag_type unsupported =
+      match_posix | match_partial | match_not_null | regex_constants::match_not_initial_null | match_continuous | match_all;
+   if(!re.get_data().m_can_use_dfa || ((m_match_flags & match_perl) == 0) || (m_match_flags & unsupported))
+      return false;
+   BidiIterator first, second;
+   {
+      scoped_lazy_dfa<char_type, traits> dfa(re.get_data());
+      found = dfa->search(position, last, position == backstop, m_match_flags, (m_match_flags & match_any) != 0, first, second);
+   }
+   if(!found)
+      return true;
+   if(((m_presult->size() == 1) || (m_match_flags & match_any)) && ((m_match_flags & match_extra) == 0))
+   {
+      m_presult->set_first(first);
+      m_presult->set_second(second);
+      position = second;
+      m_has_found_match = true;
+      return true;
+   }
+   BidiIterator start(position);
+   position = first;
+   if(match_prefix())
+      return true;
+   // should never happen, fall back on the usual search:
+   position = start;
+   return false;
+}
+#endif
+
 template <class BidiIterator, class Allocator, class traits>
 bool perl_matcher<BidiIterator, Allocator, traits>::match_prefix()
 {
@@ -806,11 +857,19 @@ bool perl_matcher<BidiIterator, Allocator, traits>::find_restart_any()
 #pragma warning(disable:4127)
 #endif
    const unsigned char* _map = re.get_map();
+   // if every match starts with a literal string, then look for that
+   // instead, a partial match though may contain only part of it:
+   const bool use_literal = re.get_data().m_literal_leading && ((m_match_flags & match_partial) == 0);
    while(true)
    {
       // skip everything we can't match:
-      while((position != last) && !can_start(*position, _map, (unsigned char)mask_any) )
-         ++position;
+      if(use_literal)
+         position = find_literal(position, last, re.get_data().m_literal, re.get_data().m_literal_length, re.get_data().m_literal_shift);
+      else
+      {
+         while((position != last) && !can_start(*position, _map, (unsigned char)mask_any) )
+            ++position;
+      }
       if(position == last)
       {
          // run out of characters, try a null match if possible:
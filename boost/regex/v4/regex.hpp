@@ -147,6 +147,9 @@ typedef match_results<std::wstring::const_iterator> wsmatch;
 #ifndef BOOST_REGEX_V4_REGEX_SEARCH_HPP
 #include <boost/regex/v4/regex_search.hpp>
 #endif
+#ifndef BOOST_REGEX_V4_REGEX_SET_HPP
+#include <boost/regex/v4/regex_set.hpp>
+#endif
 #ifndef BOOST_REGEX_ITERATOR_HPP
 #include <boost/regex/v4/regex_iterator.hpp>
 #endif
@@ -0,0 +1,283 @@
+/*
+ *
+ * Copyright (c) 2013
+ * John Maddock
+ *
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+ /*
+  *   LOCATION:    see http://www.boost.org for most recent version.
+  *   FILE         regex_set.hpp
+  *   VERSION      see <boost/version.hpp>
+  *   DESCRIPTION: Declares basic_regex_set, which searches for many
+  *                expressions at once.
+  *                Note this is an internal header file included
+  *                by regex.hpp, do not include on its own.
+  */
+
+#ifndef BOOST_REGEX_V4_REGEX_SET_HPP
+#define BOOST_REGEX_V4_REGEX_SET_HPP
+
+#include <vector>
+
+namespace boost{
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4103)
+#endif
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_PREFIX
+#endif
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+//
+// class basic_regex_set:
+// A list of expressions which are searched for together: the expressions
+// which the lazy DFA can handle are compiled into a single expression,
+// one alternative for each, and found in one pass over the text.  If that
+// expression would be too big for the DFA, it's split into several.  The
+// rest are searched for one at a time.
+//
+template <class charT, class traits = regex_traits<charT> >
+class basic_regex_set
+{
+public:
+   typedef basic_regex<charT, traits>                 regex_type;
+   typedef typename regex_type::flag_type             flag_type;
+   typedef std::size_t                                size_type;
+   typedef std::basic_string<charT>                   string_type;
+
+   basic_regex_set() : m_flags(regex_constants::normal) {}
+   template <class InputIterator>
+   basic_regex_set(InputIterator first, InputIterator last, flag_type f = regex_constants::normal)
+   {
+      assign(first, last, f);
+   }
+
+   //
+   // Compiles each of the expressions in [first, last), which may be
+   // strings or null-terminated character arrays, with flags f:
+   //
+   template <class InputIterator>
+   basic_regex_set& assign(InputIterator first, InputIterator last, flag_type f = regex_constants::normal)
+   {
+      std::vector<regex_type> expressions;
+      for(; first != last; ++first)
+         expressions.push_back(regex_type(*first, f));
+      m_expressions.swap(expressions);
+      m_flags = f;
+      combine();
+      return *this;
+   }
+
+   size_type size()const
+   {
+      return m_expressions.size();
+   }
+   bool empty()const
+   {
+      return m_expressions.empty();
+   }
+   flag_type flags()const
+   {
+      return m_flags;
+   }
+   const regex_type& operator[](size_type i)const
+   {
+      BOOST_ASSERT(i < m_expressions.size());
+      return m_expressions[i];
+   }
+   void swap(basic_regex_set& that)
+   {
+      m_expressions.swap(that.m_expressions);
+      std::swap(m_flags, that.m_flags);
+      m_combined.swap(that.m_combined);
+      m_patterns.swap(that.m_patterns);
+      m_others.swap(that.m_others);
+   }
+
+   //
+   // Searches [first, last) for every expression in the set, and puts the
+   // indexes of the ones found in which, in ascending order:
+   //
+   template <class BidiIterator>
+   bool search(BidiIterator first, BidiIterator last, std::vector<size_type>& which, match_flag_type flags = match_default)const
+   {
+      which.clear();
+      std::vector<bool> found(m_expressions.size(), false);
+      std::vector<size_type> all;
+      const std::vector<size_type>* others = &m_others;
+#ifndef BOOST_REGEX_NO_LAZY_DFA
+      static const match_flag_type unsupported =
+         match_posix | match_partial | match_not_null | regex_constants::match_not_initial_null | match_continuous | match_all;
+      if((flags & unsupported) == 0)
+      {
+         for(size_type i = 0; i < m_combined.size(); ++i)
+         {
+            re_detail::scoped_lazy_dfa<charT, traits> dfa(m_combined[i].get_data(), &m_patterns[i]);
+            dfa->search_set(first, last, flags, found);
+         }
+      }
+      else
+#endif
+      {
+         for(size_type i = 0; i < m_expressions.size(); ++i)
+            all.push_back(i);
+         others = &all;
+      }
+      for(size_type i = 0; i < others->size(); ++i)
+      {
+         // an expression which failed to compile, with no_except, never matches:
+         size_type j = (*others)[i];
+         found[j] = !m_expressions[j].empty() && regex_search(first, last, m_expressions[j], flags);
+      }
+      for(size_type i = 0; i < found.size(); ++i)
+      {
+         if(found[i])
+            which.push_back(i);
+      }
+      return !which.empty();
+   }
+
+private:
+   void combine();
+   void combine(const size_type* first, const size_type* last);
+
+   std::vector<regex_type>        m_expressions;   // each expression compiled on its own
+   flag_type                      m_flags;         // the flags the expressions were compiled with
+   std::vector<regex_type>        m_combined;      // the expressions searched for by the lazy DFA
+   std::vector<std::vector<int> > m_patterns;      // the expression started by each marked sub-expression of m_combined[i], or -1
+   std::vector<size_type>         m_others;        // the expressions searched for one at a time
+};
+
+template <class charT, class traits>
+void basic_regex_set<charT, traits>::combine()
+{
+   m_combined.clear();
+   m_patterns.clear();
+   m_others.clear();
+#ifndef BOOST_REGEX_NO_LAZY_DFA
+   if((m_flags & (regbase::main_option_type | regbase::no_perl_ex)) == 0)
+   {
+      std::vector<size_type> candidates;
+      for(size_type i = 0; i < m_expressions.size(); ++i)
+      {
+         const regex_type& e = m_expressions[i];
+         if(!e.empty() && e.get_data().m_can_use_dfa)
+            candidates.push_back(i);
+         else
+            m_others.push_back(i);
+      }
+      if(!candidates.empty())
+         combine(&candidates[0], &candidates[0] + candidates.size());
+      return;
+   }
+#endif
+   for(size_type i = 0; i < m_expressions.size(); ++i)
+      m_others.push_back(i);
+}
+
+template <class charT, class traits>
+void basic_regex_set<charT, traits>::combine(const size_type* first, const size_type* last)
+{
+   //
+   // Each perl expression in [first, last) becomes a marked sub-expression
+   // in an alternation.  As each is known to be valid on its own, the only
+   // thing that can go wrong is an expression which swallows the text after
+   // it (an unterminated \Q or a comment in free spacing mode), which shows
+   // up in the number of marked sub-expressions.  If the result is too big
+   // for the lazy DFA we try again with each half:
+   //
+   const flag_type f = static_cast<flag_type>(m_flags & ~regbase::nosubs);
+   string_type expression;
+   std::vector<int> patterns(1, -1);
+   for(const size_type* i = first; i != last; ++i)
+   {
+      const regex_type& e = m_expressions[*i];
+      size_type marks = (m_flags & regbase::nosubs) ? regex_type(e.str(), f).mark_count() : e.mark_count();
+      if(!expression.empty())
+         expression.append(1, static_cast<charT>('|'));
+      expression.append(1, static_cast<charT>('('));
+      expression.append(e.str());
+      expression.append(1, static_cast<charT>(')'));
+      patterns.push_back(static_cast<int>(*i));
+      patterns.resize(patterns.size() + marks - 1, -1);
+   }
+   regex_type combined(expression, static_cast<flag_type>(f | regbase::no_except));
+   if(!combined.empty() && (combined.mark_count() == patterns.size()) && combined.get_data().m_can_use_dfa)
+   {
+      m_combined.push_back(combined);
+      m_patterns.push_back(patterns);
+   }
+   else if(last - first > 1)
+   {
+      const size_type* middle = first + (last - first) / 2;
+      combine(first, middle);
+      combine(middle, last);
+   }
+   else
+      m_others.push_back(*first);
+}
+
+template <class charT, class traits>
+inline void swap(basic_regex_set<charT, traits>& a, basic_regex_set<charT, traits>& b)
+{
+   a.swap(b);
+}
+
+//
+// regex_search overloads which search for a set of expressions:
+//
+template <class BidiIterator, class charT, class traits>
+inline bool regex_search(BidiIterator first, BidiIterator last,
+                  std::vector<std::size_t>& which,
+                  const basic_regex_set<charT, traits>& s,
+                  match_flag_type flags = match_default)
+{
+   return s.search(first, last, which, flags);
+}
+
+template <class charT, class traits>
+inline bool regex_search(const charT* str,
+                  std::vector<std::size_t>& which,
+                  const basic_regex_set<charT, traits>& s,
+                  match_flag_type flags = match_default)
+{
+   return s.search(str, str + traits::length(str), which, flags);
+}
+
+template <class ST, class SA, class charT, class traits>
+inline bool regex_search(const std::basic_string<charT, ST, SA>& str,
+                  std::vector<std::size_t>& which,
+                  const basic_regex_set<charT, traits>& s,
+                  match_flag_type flags = match_default)
+{
+   return s.search(str.begin(), str.end(), which, flags);
+}
+
+typedef basic_regex_set<char> regex_set;
+#ifndef BOOST_NO_WREGEX
+typedef basic_regex_set<wchar_t> wregex_set;
+#endif
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4103)
+#endif
+#ifdef BOOST_HAS_ABI_HEADERS
+#  include BOOST_ABI_SUFFIX
+#endif
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+} // namespace boost
+
+#endif  // BOOST_REGEX_V4_REGEX_SET_HPP
@@ -0,0 +1,113 @@
+#ifndef BOOST_SERIALIZATION_ARRAY_VIEW_HPP
+#define BOOST_SERIALIZATION_ARRAY_VIEW_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// array_view.hpp: a read only view of a contiguous sequence of bitwise
+// serializable elements. Saving writes the elements, loading points the
+// view at the elements in the archive buffer without copying them.
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+#include <cstddef> // std::size_t
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::size_t;
+} // namespace std
+#endif
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/wrapper.hpp>
+#include <boost/serialization/is_bitwise_serializable.hpp>
+
+namespace boost {
+namespace serialization {
+
+// Only archives which keep the whole archive in memory can load a view.
+// Such archives implement save_view and load_view; see
+// binary_memory_oarchive and binary_memory_iarchive. The loaded view
+// remains valid only as long as the archive's buffer does.
+template<class T>
+class array_view :
+    public wrapper_traits<const array_view< T > >
+{
+    BOOST_STATIC_ASSERT(is_bitwise_serializable< T >::value);
+public:
+    typedef T value_type;
+    typedef const T * const_iterator;
+
+    array_view() :
+        m_t(NULL),
+        m_element_count(0)
+    {}
+    array_view(const value_type * t, std::size_t s) :
+        m_t(t),
+        m_element_count(s)
+    {}
+
+    template<class Archive>
+    void save(Archive & ar, const unsigned int version) const {
+        ar.save_view(*this, version);
+    }
+    template<class Archive>
+    void load(Archive & ar, const unsigned int version){
+        ar.load_view(*this, version);
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+    void reset(const value_type * t, std::size_t s){
+        m_t = t;
+        m_element_count = s;
+    }
+
+    const value_type * address() const {
+        return m_t;
+    }
+    std::size_t count() const {
+        return m_element_count;
+    }
+    bool empty() const {
+        return 0 == m_element_count;
+    }
+
+    const_iterator begin() const {
+        return m_t;
+    }
+    const_iterator end() const {
+        return m_t + m_element_count;
+    }
+    const value_type & operator[](std::size_t i) const {
+        BOOST_ASSERT(i < m_element_count);
+        return m_t[i];
+    }
+
+private:
+    const value_type * m_t;
+    std::size_t m_element_count;
+};
+
+template<class T>
+inline
+#ifndef __BORLANDC__
+const
+#endif
+array_view< T > make_array_view(const T * t, std::size_t s){
+    return array_view< T >(t, s);
+}
+
+} // namespace serialization
+} // namespace boost
+
+#endif // BOOST_SERIALIZATION_ARRAY_VIEW_HPP
@@ -0,0 +1,376 @@
+#ifndef BOOST_SERIALIZATION_CHUNKED_COLLECTION_HPP
+#define BOOST_SERIALIZATION_CHUNKED_COLLECTION_HPP
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// chunked_collection.hpp: serialize a large collection as a sequence of
+// independently encoded chunks which are saved and loaded on several
+// threads.
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com .
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org for updates, documentation, and revision history.
+
+// Each chunk is written by its own binary_memory_oarchive, so it can be
+// encoded and decoded without reference to any other chunk.  The
+// enclosing archive receives
+//
+//     count           - number of elements
+//     chunk_count     - number of chunks
+//     chunk_count x { items, bytes } - index from which chunk offsets follow
+//     chunk_count x binary_object    - the encoded chunks
+//
+// Note that:
+// a) chunks are native binary archives, and hence not portable, whatever
+//    the type of the enclosing archive.
+// b) since chunks are independent, objects are tracked only within
+//    a chunk.  Elements must not share objects through pointers with
+//    each other or with the rest of the enclosing archive.
+// c) elements must be default constructible and assignable.
+// d) this header requires linking with Boost.Thread.
+
+#include <cstddef> // std::size_t
+#include <vector>
+#include <utility> // std::pair
+#include <iterator>
+#include <boost/config.hpp>
+#if defined(BOOST_NO_STDC_NAMESPACE)
+namespace std{
+    using ::size_t;
+} // namespace std
+#endif
+
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+#include <boost/archive/archive_exception.hpp>
+#include <boost/archive/basic_archive.hpp>
+#include <boost/archive/binary_memory_oarchive.hpp>
+#include <boost/archive/binary_memory_iarchive.hpp>
+
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/wrapper.hpp>
+#include <boost/serialization/binary_object.hpp>
+#include <boost/serialization/collection_size_type.hpp>
+#include <boost/serialization/throw_exception.hpp>
+
+namespace boost {
+namespace serialization {
+namespace detail {
+
+// the type in which elements of a chunk are loaded.  Keys of maps
+// can't be assigned so load them into a pair with a non-const key.
+template<class T>
+struct chunk_value {
+    typedef T type;
+};
+template<class K, class V>
+struct chunk_value<std::pair<const K, V> > {
+    typedef std::pair<K, V> type;
+};
+
+// run task(i) for each i in [0, count) on up to thread_count threads,
+// including the calling one.  The first exception thrown by a task is
+// rethrown on the calling thread once all threads have finished.
+class chunk_tasks :
+    private boost::noncopyable
+{
+    boost::mutex m_mutex;
+    std::size_t m_next;
+    const std::size_t m_count;
+    boost::optional<boost::archive::archive_exception> m_archive_exception;
+    boost::exception_ptr m_exception;
+
+    template<class Task>
+    void worker(Task task){
+        for(;;){
+            std::size_t i;
+            {
+                boost::lock_guard<boost::mutex> lock(m_mutex);
+                // stop handing out work once something has failed
+                if(m_next == m_count || m_archive_exception || m_exception)
+                    return;
+                i = m_next++;
+            }
+            try{
+                task(i);
+            }
+            // keep the type of the archive exception, which
+            // current_exception would lose
+            catch(const boost::archive::archive_exception & e){
+                boost::lock_guard<boost::mutex> lock(m_mutex);
+                if(! m_archive_exception && ! m_exception)
+                    m_archive_exception = e;
+            }
+            catch(...){
+                boost::lock_guard<boost::mutex> lock(m_mutex);
+                if(! m_archive_exception && ! m_exception)
+                    m_exception = boost::current_exception();
+            }
+        }
+    }
+public:
+    explicit chunk_tasks(std::size_t count) :
+        m_next(0),
+        m_count(count)
+    {}
+    template<class Task>
+    void run(Task task, unsigned int thread_count){
+        if(0 == thread_count)
+            thread_count = boost::thread::hardware_concurrency();
+        if(m_count < thread_count)
+            thread_count = static_cast<unsigned int>(m_count);
+        boost::thread_group threads;
+        try{
+            for(unsigned int t = 1; t < thread_count; ++t)
+                threads.create_thread(
+                    boost::bind(& chunk_tasks::worker<Task>, this, task)
+                );
+        }
+        catch(...){
+            // carry on with the threads we have
+        }
+        worker(task);
+        threads.join_all();
+        if(m_archive_exception)
+            boost::serialization::throw_exception(* m_archive_exception);
+        if(m_exception)
+            boost::rethrow_exception(m_exception);
+    }
+};
+
+// encode the elements [first, first + count) of a collection
+template<class InputIterator>
+struct chunk_encoder {
+    const std::vector<InputIterator> * m_first;
+    const std::vector<std::size_t> * m_items;
+    std::vector<std::vector<char> > * m_chunks;
+    void operator()(std::size_t i) const {
+        boost::archive::binary_memory_oarchive oa(
+            (* m_chunks)[i],
+            boost::archive::no_header
+        );
+        InputIterator it = (* m_first)[i];
+        for(std::size_t n = (* m_items)[i]; n > 0; --n)
+            oa << boost::serialization::make_nvp("item", * it++);
+    }
+};
+
+// decode a chunk into the elements [first, first + count)
+template<class OutputIterator>
+struct chunk_decoder {
+    const std::vector<OutputIterator> * m_first;
+    const std::vector<std::size_t> * m_items;
+    const std::vector<std::size_t> * m_offsets;
+    const char * m_buffer;
+    void operator()(std::size_t i) const {
+        const std::size_t offset = (* m_offsets)[i];
+        boost::archive::binary_memory_iarchive ia(
+            m_buffer + offset,
+            (* m_offsets)[i + 1] - offset,
+            boost::archive::no_header
+        );
+        OutputIterator it = (* m_first)[i];
+        for(std::size_t n = (* m_items)[i]; n > 0; --n, ++it)
+            ia >> boost::serialization::make_nvp("item", * it);
+    }
+};
+
+} // namespace detail
+
+template<class Container>
+class chunked_collection :
+    public wrapper_traits<const chunked_collection< Container > >
+{
+    typedef BOOST_DEDUCED_TYPENAME Container::value_type value_type;
+    typedef BOOST_DEDUCED_TYPENAME
+        detail::chunk_value<value_type>::type chunk_value_type;
+    typedef BOOST_DEDUCED_TYPENAME boost::is_convertible<
+        BOOST_DEDUCED_TYPENAME std::iterator_traits<
+            BOOST_DEDUCED_TYPENAME Container::iterator
+        >::iterator_category,
+        std::random_access_iterator_tag
+    >::type is_random_access;
+
+    // decode in place into a random access container
+    void load_chunks(
+        std::size_t count,
+        const std::vector<std::size_t> & items,
+        const std::vector<std::size_t> & offsets,
+        const char * buffer,
+        boost::mpl::true_
+    ){
+        typedef BOOST_DEDUCED_TYPENAME Container::iterator iterator;
+        m_c.clear();
+        m_c.resize(count);
+        std::vector<iterator> first;
+        iterator it = m_c.begin();
+        for(std::size_t i = 0; i < items.size(); ++i){
+            first.push_back(it);
+            it += items[i];
+        }
+        detail::chunk_decoder<iterator> decoder =
+            { & first, & items, & offsets, buffer };
+        detail::chunk_tasks(items.size()).run(decoder, m_thread_count);
+    }
+    // decode into temporary storage and insert the elements in order
+    void load_chunks(
+        std::size_t count,
+        const std::vector<std::size_t> & items,
+        const std::vector<std::size_t> & offsets,
+        const char * buffer,
+        boost::mpl::false_
+    ){
+        typedef BOOST_DEDUCED_TYPENAME
+            std::vector<chunk_value_type>::iterator iterator;
+        std::vector<chunk_value_type> values(count);
+        std::vector<iterator> first;
+        iterator it = values.begin();
+        for(std::size_t i = 0; i < items.size(); ++i){
+            first.push_back(it);
+            it += items[i];
+        }
+        detail::chunk_decoder<iterator> decoder =
+            { & first, & items, & offsets, buffer };
+        detail::chunk_tasks(items.size()).run(decoder, m_thread_count);
+        m_c.clear();
+        for(it = values.begin(); it != values.end(); ++it)
+            m_c.insert(m_c.end(), * it);
+    }
+
+public:
+    chunked_collection(
+        Container & c,
+        std::size_t chunk_size,
+        unsigned int thread_count
+    ) :
+        m_c(c),
+        m_chunk_size(0 == chunk_size ? 1 : chunk_size),
+        m_thread_count(thread_count)
+    {}
+
+    template<class Archive>
+    void save(Archive & ar, const unsigned int /* version */) const {
+        typedef BOOST_DEDUCED_TYPENAME Container::const_iterator iterator;
+        const std::size_t size = m_c.size();
+        const collection_size_type count(size);
+        const collection_size_type chunk_count(
+            (size + m_chunk_size - 1) / m_chunk_size
+        );
+        std::vector<iterator> first;
+        std::vector<std::size_t> items;
+        iterator it = m_c.begin();
+        for(std::size_t i = 0; i < chunk_count; ++i){
+            const std::size_t n = (i + 1 < chunk_count) ?
+                m_chunk_size : size - i * m_chunk_size;
+            first.push_back(it);
+            items.push_back(n);
+            std::advance(it, n);
+        }
+        std::vector<std::vector<char> > chunks(chunk_count);
+        detail::chunk_encoder<iterator> encoder =
+            { & first, & items, & chunks };
+        detail::chunk_tasks(chunk_count).run(encoder, m_thread_count);
+
+        ar << BOOST_SERIALIZATION_NVP(count);
+        ar << BOOST_SERIALIZATION_NVP(chunk_count);
+        for(std::size_t i = 0; i < chunk_count; ++i){
+            const collection_size_type chunk_items(items[i]);
+            const collection_size_type chunk_bytes(chunks[i].size());
+            ar << BOOST_SERIALIZATION_NVP(chunk_items);
+            ar << BOOST_SERIALIZATION_NVP(chunk_bytes);
+        }
+        for(std::size_t i = 0; i < chunk_count; ++i){
+            if(chunks[i].empty())
+                continue;
+            ar << make_nvp("chunk", make_binary_object(
+                & chunks[i][0],
+                chunks[i].size()
+            ));
+        }
+    }
+
+    template<class Archive>
+    void load(Archive & ar, const unsigned int /* version */){
+        collection_size_type count;
+        collection_size_type chunk_count;
+        ar >> BOOST_SERIALIZATION_NVP(count);
+        ar >> BOOST_SERIALIZATION_NVP(chunk_count);
+        std::vector<std::size_t> items;
+        // offsets[i] is the start of chunk i, offsets[chunk_count] the end
+        std::vector<std::size_t> offsets(1, 0);
+        std::size_t total_items = 0;
+        for(std::size_t i = 0; i < chunk_count; ++i){
+            collection_size_type chunk_items;
+            collection_size_type chunk_bytes;
+            ar >> BOOST_SERIALIZATION_NVP(chunk_items);
+            ar >> BOOST_SERIALIZATION_NVP(chunk_bytes);
+            items.push_back(chunk_items);
+            offsets.push_back(offsets.back() + chunk_bytes);
+            total_items += chunk_items;
+        }
+        if(total_items != count)
+            boost::serialization::throw_exception(
+                boost::archive::archive_exception(
+                    boost::archive::archive_exception::input_stream_error
+                )
+            );
+        std::vector<char> buffer(offsets.back());
+        for(std::size_t i = 0; i < chunk_count; ++i){
+            if(offsets[i] == offsets[i + 1])
+                continue;
+            ar >> make_nvp("chunk", make_binary_object(
+                & buffer[offsets[i]],
+                offsets[i + 1] - offsets[i]
+            ));
+        }
+        load_chunks(
+            count,
+            items,
+            offsets,
+            buffer.empty() ? NULL : & buffer[0],
+            is_random_access()
+        );
+    }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+private:
+    chunked_collection & operator=(const chunked_collection &);
+    Container & m_c;
+    const std::size_t m_chunk_size;
+    const unsigned int m_thread_count;
+};
+
+// thread_count == 0 uses one thread for each hardware thread
+template<class Container>
+inline
+#ifndef __BORLANDC__
+const
+#endif
+chunked_collection<Container> make_chunked_collection(
+    Container & c,
+    std::size_t chunk_size = 65536,
+    unsigned int thread_count = 0
+){
+    return chunked_collection<Container>(c, chunk_size, thread_count);
+}
+
+} // namespace serialization
+} // namespace boost
+
+#endif // BOOST_SERIALIZATION_CHUNKED_COLLECTION_HPP
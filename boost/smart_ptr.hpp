@@ -26,6 +26,8 @@
 # include <boost/intrusive_ptr.hpp>
 # include <boost/enable_shared_from_this.hpp>
 # include <boost/make_shared.hpp>
+# include <boost/local_shared_ptr.hpp>
+# include <boost/make_local_shared.hpp>
 #endif
 
 #endif // #ifndef BOOST_SMART_PTR_HPP_INCLUDED
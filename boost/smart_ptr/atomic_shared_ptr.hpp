@@ -0,0 +1,317 @@
+#ifndef BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
+#define BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
+
+//
+//  atomic_shared_ptr.hpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+//
+//  See http://www.boost.org/libs/smart_ptr/atomic_shared_ptr.html
+//  for documentation.
+//
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+#include <cstddef>
+
+namespace boost
+{
+
+namespace detail
+{
+
+//
+//  atomic_shared_ptr stores a pointer to an immutable holder that owns a
+//  shared_ptr, packed together with an "external" count in a single atomic
+//  word. A reader increments the external count to pin the holder, copies
+//  the shared_ptr, and gives its pin back. When a writer replaces the
+//  holder, the pins still outstanding are transferred to the holder's
+//  internal count, and the last pin to be returned deletes the holder.
+//
+
+template< class T > struct asp_holder
+{
+    explicit asp_holder( boost::shared_ptr< T > const & p ): sp( p ), internal_count( 0 )
+    {
+    }
+
+    boost::shared_ptr< T > sp;
+    boost::atomic< long > internal_count;
+};
+
+template< std::size_t PointerSize > struct asp_packing;
+
+// 32 bit pointers: the count takes the upper half of the word
+
+template<> struct asp_packing< 4 >
+{
+    static const int count_shift = 32;
+    static const boost::uint64_t pointer_mask = 0xFFFFFFFFu;
+};
+
+// 64 bit pointers: user space addresses fit in the lower 48 bits
+
+template<> struct asp_packing< 8 >
+{
+    static const int count_shift = 48;
+    static const boost::uint64_t pointer_mask = ( static_cast< boost::uint64_t >( 1 ) << 48 ) - 1;
+};
+
+template< class T > class asp_packed_word
+{
+private:
+
+    typedef asp_packing< sizeof( void* ) > packing;
+
+public:
+
+    static const boost::uint64_t count_one = static_cast< boost::uint64_t >( 1 ) << packing::count_shift;
+    static const boost::uint64_t max_count = ~packing::pointer_mask >> packing::count_shift;
+
+    static boost::uint64_t pack( asp_holder< T > * p ) BOOST_NOEXCEPT
+    {
+        boost::uint64_t v = static_cast< boost::uint64_t >( reinterpret_cast< std::size_t >( p ) );
+        BOOST_ASSERT( ( v & ~packing::pointer_mask ) == 0 );
+        return v;
+    }
+
+    static asp_holder< T > * holder( boost::uint64_t v ) BOOST_NOEXCEPT
+    {
+        return reinterpret_cast< asp_holder< T > * >( static_cast< std::size_t >( v & packing::pointer_mask ) );
+    }
+
+    static boost::uint64_t count( boost::uint64_t v ) BOOST_NOEXCEPT
+    {
+        return v >> packing::count_shift;
+    }
+};
+
+} // namespace detail
+
+template< class T > class atomic_shared_ptr
+{
+private:
+
+    typedef boost::detail::asp_holder< T > holder_type;
+    typedef boost::detail::asp_packed_word< T > word;
+
+    atomic_shared_ptr( atomic_shared_ptr const & );
+    atomic_shared_ptr & operator=( atomic_shared_ptr const & );
+
+    mutable boost::atomic< boost::uint64_t > v_;
+
+private:
+
+    static holder_type * make_holder( boost::shared_ptr< T > const & p )
+    {
+        return p.use_count() == 0 && p.get() == 0? 0: new holder_type( p );
+    }
+
+    // pins the current holder; the returned word has our pin included
+
+    boost::uint64_t acquire() const BOOST_NOEXCEPT
+    {
+        boost::uint64_t v = v_.load( boost::memory_order_relaxed );
+
+        for( unsigned k = 0; ; )
+        {
+            if( word::holder( v ) == 0 )
+            {
+                return v;
+            }
+
+            if( word::count( v ) == word::max_count )
+            {
+                // too many concurrent readers, wait for one of them to finish
+                boost::detail::yield( k++ );
+                v = v_.load( boost::memory_order_relaxed );
+                continue;
+            }
+
+            if( v_.compare_exchange_weak( v, v + word::count_one, boost::memory_order_acquire, boost::memory_order_relaxed ) )
+            {
+                return v + word::count_one;
+            }
+        }
+    }
+
+    // gives back a pin obtained by acquire()
+
+    void release( holder_type * h ) const BOOST_NOEXCEPT
+    {
+        boost::uint64_t v = v_.load( boost::memory_order_relaxed );
+
+        while( word::holder( v ) == h )
+        {
+            BOOST_ASSERT( word::count( v ) > 0 );
+
+            if( v_.compare_exchange_weak( v, v - word::count_one, boost::memory_order_release, boost::memory_order_relaxed ) )
+            {
+                return;
+            }
+        }
+
+        // h has been replaced; its pins now live in the internal count
+        if( h->internal_count.fetch_sub( 1, boost::memory_order_acq_rel ) == 1 )
+        {
+            delete h;
+        }
+    }
+
+    // disposes of a holder that has just been unlinked together with 'pins' outstanding pins
+
+    static void retire( holder_type * h, long pins ) BOOST_NOEXCEPT
+    {
+        if( h != 0 && h->internal_count.fetch_add( pins, boost::memory_order_acq_rel ) == -pins )
+        {
+            delete h;
+        }
+    }
+
+public:
+
+    atomic_shared_ptr() BOOST_NOEXCEPT: v_( 0 )
+    {
+    }
+
+    atomic_shared_ptr( boost::shared_ptr< T > const & p ): v_( word::pack( make_holder( p ) ) )
+    {
+    }
+
+    ~atomic_shared_ptr()
+    {
+        boost::uint64_t v = v_.load( boost::memory_order_relaxed );
+
+        BOOST_ASSERT( word::count( v ) == 0 );
+        retire( word::holder( v ), 0 );
+    }
+
+    atomic_shared_ptr & operator=( boost::shared_ptr< T > const & r )
+    {
+        store( r );
+        return *this;
+    }
+
+    bool is_lock_free() const BOOST_NOEXCEPT
+    {
+        return v_.is_lock_free();
+    }
+
+    // The operations are always sequentially consistent with respect to each
+    // other; the memory_order arguments are accepted for interface compatibility.
+
+    boost::shared_ptr< T > load( boost::memory_order = boost::memory_order_seq_cst ) const BOOST_NOEXCEPT
+    {
+        boost::uint64_t v = acquire();
+        holder_type * h = word::holder( v );
+
+        if( h == 0 )
+        {
+            return boost::shared_ptr< T >();
+        }
+
+        boost::shared_ptr< T > r( h->sp );
+        release( h );
+
+        return r;
+    }
+
+    operator boost::shared_ptr< T >() const BOOST_NOEXCEPT
+    {
+        return load();
+    }
+
+    void store( boost::shared_ptr< T > const & r, boost::memory_order = boost::memory_order_seq_cst )
+    {
+        boost::uint64_t v = v_.exchange( word::pack( make_holder( r ) ), boost::memory_order_acq_rel );
+        retire( word::holder( v ), static_cast< long >( word::count( v ) ) );
+    }
+
+    boost::shared_ptr< T > exchange( boost::shared_ptr< T > const & r, boost::memory_order = boost::memory_order_seq_cst )
+    {
+        boost::uint64_t v = v_.exchange( word::pack( make_holder( r ) ), boost::memory_order_acq_rel );
+        holder_type * h = word::holder( v );
+
+        if( h == 0 )
+        {
+            return boost::shared_ptr< T >();
+        }
+
+        // the pin held by v_ keeps h alive until it is retired
+        boost::shared_ptr< T > old( h->sp );
+        retire( h, static_cast< long >( word::count( v ) ) );
+
+        return old;
+    }
+
+    bool compare_exchange_strong( boost::shared_ptr< T > & expected, boost::shared_ptr< T > const & desired,
+        boost::memory_order = boost::memory_order_seq_cst, boost::memory_order = boost::memory_order_seq_cst )
+    {
+        holder_type * nh = make_holder( desired );
+        boost::uint64_t nv = word::pack( nh );
+
+        for( ;; )
+        {
+            boost::uint64_t v = acquire();
+            holder_type * h = word::holder( v );
+
+            boost::shared_ptr< T > current;
+
+            if( h != 0 )
+            {
+                current = h->sp;
+            }
+
+            if( !current._internal_equiv( expected ) )
+            {
+                if( h != 0 )
+                {
+                    release( h );
+                }
+
+                expected = current;
+                delete nh;
+
+                return false;
+            }
+
+            // replace the holder we have pinned, consuming our own pin
+            while( word::holder( v ) == h )
+            {
+                if( v_.compare_exchange_weak( v, nv, boost::memory_order_acq_rel, boost::memory_order_relaxed ) )
+                {
+                    if( h != 0 )
+                    {
+                        retire( h, static_cast< long >( word::count( v ) ) - 1 );
+                    }
+
+                    return true;
+                }
+            }
+
+            // another writer got there first; start over
+            if( h != 0 )
+            {
+                release( h );
+            }
+        }
+    }
+
+    bool compare_exchange_weak( boost::shared_ptr< T > & expected, boost::shared_ptr< T > const & desired,
+        boost::memory_order success = boost::memory_order_seq_cst, boost::memory_order failure = boost::memory_order_seq_cst )
+    {
+        return compare_exchange_strong( expected, desired, success, failure );
+    }
+};
+
+} // namespace boost
+
+#endif  // #ifndef BOOST_SMART_PTR_ATOMIC_SHARED_PTR_HPP_INCLUDED
@@ -0,0 +1,135 @@
+#ifndef BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
+#define BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+//  detail/local_counted_base.hpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+//
+//  See http://www.boost.org/libs/smart_ptr/local_shared_ptr.html
+//  for documentation.
+
+#include <boost/smart_ptr/detail/shared_count.hpp>
+#include <boost/config.hpp>
+
+namespace boost
+{
+
+namespace detail
+{
+
+//
+//  local_counted_base keeps a non-atomic count of the local_shared_ptr
+//  instances sharing ownership. All of them together hold a single
+//  reference in the ordinary, atomic, shared_count, which is released
+//  when the local count drops to zero.
+//
+
+class local_counted_base
+{
+private:
+
+    local_counted_base & operator= ( local_counted_base const & );
+
+    long local_use_count_;
+
+public:
+
+    local_counted_base() BOOST_NOEXCEPT: local_use_count_( 1 )
+    {
+    }
+
+    local_counted_base( local_counted_base const & ) BOOST_NOEXCEPT: local_use_count_( 1 )
+    {
+    }
+
+    virtual void local_cb_destroy() BOOST_NOEXCEPT = 0;
+
+    virtual boost::detail::shared_count local_cb_get_shared_count() const BOOST_NOEXCEPT = 0;
+
+    void add_ref() BOOST_NOEXCEPT
+    {
+        ++local_use_count_;
+    }
+
+    void release() BOOST_NOEXCEPT
+    {
+        if( --local_use_count_ == 0 )
+        {
+            local_cb_destroy();
+        }
+    }
+
+    long local_use_count() const BOOST_NOEXCEPT
+    {
+        return local_use_count_;
+    }
+
+protected:
+
+    virtual ~local_counted_base() // nothrow
+    {
+    }
+};
+
+// separately allocated count block, used when adopting an existing shared_count
+
+class local_counted_impl: public local_counted_base
+{
+private:
+
+    local_counted_impl( local_counted_impl const & );
+
+    boost::detail::shared_count pn_;
+
+public:
+
+    explicit local_counted_impl( boost::detail::shared_count const & pn ): pn_( pn )
+    {
+    }
+
+    virtual void local_cb_destroy() BOOST_NOEXCEPT
+    {
+        delete this;
+    }
+
+    virtual boost::detail::shared_count local_cb_get_shared_count() const BOOST_NOEXCEPT
+    {
+        return pn_;
+    }
+};
+
+// count block embedded in the deleter of a shared_count, used by make_local_shared;
+// pn_ refers back to the enclosing control block while local owners exist
+
+class local_counted_impl_em: public local_counted_base
+{
+public:
+
+    boost::detail::shared_count pn_;
+
+    virtual void local_cb_destroy() BOOST_NOEXCEPT
+    {
+        shared_count().swap( pn_ );
+    }
+
+    virtual boost::detail::shared_count local_cb_get_shared_count() const BOOST_NOEXCEPT
+    {
+        return pn_;
+    }
+};
+
+} // namespace detail
+
+} // namespace boost
+
+#endif  // #ifndef BOOST_SMART_PTR_DETAIL_LOCAL_COUNTED_BASE_HPP_INCLUDED
@@ -59,6 +59,8 @@ int const   weak_count_id = 0x298C38A4;
 
 struct sp_nothrow_tag {};
 
+struct sp_internal_constructor_tag {};
+
 template< class D > struct sp_inplace_tag
 {
 };
@@ -0,0 +1,189 @@
+#ifndef BOOST_SMART_PTR_MAKE_LOCAL_SHARED_HPP_INCLUDED
+#define BOOST_SMART_PTR_MAKE_LOCAL_SHARED_HPP_INCLUDED
+
+//  make_local_shared.hpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+//
+//  See http://www.boost.org/libs/smart_ptr/local_shared_ptr.html
+//  for documentation.
+
+#include <boost/config.hpp>
+#include <boost/smart_ptr/local_shared_ptr.hpp>
+#include <boost/smart_ptr/make_shared_object.hpp>
+#include <boost/smart_ptr/detail/local_counted_base.hpp>
+#include <boost/smart_ptr/detail/sp_forward.hpp>
+#include <new>
+
+namespace boost
+{
+
+namespace detail
+{
+
+// the deleter holds the object and the local count, so that
+// make_local_shared needs a single allocation, like make_shared
+
+template< class T > class lsp_ms_deleter: public sp_ms_deleter< T >, public local_counted_impl_em
+{
+};
+
+template< class T > struct lsp_if_not_array
+{
+    typedef boost::local_shared_ptr< T > type;
+};
+
+#if !defined( BOOST_NO_TEMPLATE_PARTIAL_SPECIALIZATION )
+
+template< class T > struct lsp_if_not_array< T[] >
+{
+};
+
+#if !defined( __BORLANDC__ ) || !BOOST_WORKAROUND( __BORLANDC__, < 0x600 )
+
+template< class T, std::size_t N > struct lsp_if_not_array< T[N] >
+{
+};
+
+#endif
+
+#endif
+
+#if !defined( BOOST_NO_FUNCTION_TEMPLATE_ORDERING )
+# define BOOST_LSP_MSD( T ) boost::detail::sp_inplace_tag< boost::detail::lsp_ms_deleter< T > >()
+#else
+# define BOOST_LSP_MSD( T ) boost::detail::lsp_ms_deleter< T >()
+#endif
+
+// owns the control block until the object has been constructed in address()
+
+template< class T > class lsp_ms_holder
+{
+private:
+
+    lsp_ms_holder( lsp_ms_holder const & );
+    lsp_ms_holder & operator=( lsp_ms_holder const & );
+
+    boost::shared_ptr< T > pt_;
+    lsp_ms_deleter< T > * pd_;
+
+public:
+
+    lsp_ms_holder(): pt_( static_cast< T* >( 0 ), BOOST_LSP_MSD( T ) )
+    {
+        pd_ = static_cast< lsp_ms_deleter< T > * >( pt_._internal_get_untyped_deleter() );
+    }
+
+    void * address() BOOST_NOEXCEPT
+    {
+        return pd_->address();
+    }
+
+    boost::local_shared_ptr< T > release() BOOST_NOEXCEPT
+    {
+        pd_->set_initialized();
+
+        T * pt2 = static_cast< T* >( pd_->address() );
+        boost::detail::sp_enable_shared_from_this( &pt_, pt2, pt2 );
+
+        // the control block keeps itself alive until the local count drops to zero
+        pd_->pn_ = pt_._internal_count();
+
+        return boost::detail::lsp_internal_construct< T >( pt2, pd_ );
+    }
+};
+
+} // namespace detail
+
+// Zero-argument versions
+//
+// Used even when variadic templates are available because of the new T() vs new T issue
+
+template< class T > typename boost::detail::lsp_if_not_array< T >::type make_local_shared()
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T();
+    return h.release();
+}
+
+template< class T > typename boost::detail::lsp_if_not_array< T >::type make_local_shared_noinit()
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T;
+    return h.release();
+}
+
+#if !defined( BOOST_NO_CXX11_VARIADIC_TEMPLATES ) && !defined( BOOST_NO_CXX11_RVALUE_REFERENCES )
+
+// Variadic templates, rvalue reference
+
+template< class T, class Arg1, class... Args > typename boost::detail::lsp_if_not_array< T >::type make_local_shared( Arg1 && arg1, Args && ... args )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( boost::detail::sp_forward<Arg1>( arg1 ), boost::detail::sp_forward<Args>( args )... );
+    return h.release();
+}
+
+#else
+
+// C++03 version
+
+template< class T, class A1 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1 );
+    return h.release();
+}
+
+template< class T, class A1, class A2 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1, A2 const & a2 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1, a2 );
+    return h.release();
+}
+
+template< class T, class A1, class A2, class A3 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1, A2 const & a2, A3 const & a3 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1, a2, a3 );
+    return h.release();
+}
+
+template< class T, class A1, class A2, class A3, class A4 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1, A2 const & a2, A3 const & a3, A4 const & a4 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1, a2, a3, a4 );
+    return h.release();
+}
+
+template< class T, class A1, class A2, class A3, class A4, class A5 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1, A2 const & a2, A3 const & a3, A4 const & a4, A5 const & a5 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1, a2, a3, a4, a5 );
+    return h.release();
+}
+
+template< class T, class A1, class A2, class A3, class A4, class A5, class A6 >
+typename boost::detail::lsp_if_not_array< T >::type make_local_shared( A1 const & a1, A2 const & a2, A3 const & a3, A4 const & a4, A5 const & a5, A6 const & a6 )
+{
+    boost::detail::lsp_ms_holder< T > h;
+    ::new( h.address() ) T( a1, a2, a3, a4, a5, a6 );
+    return h.release();
+}
+
+#endif
+
+#undef BOOST_LSP_MSD
+
+} // namespace boost
+
+#endif // #ifndef BOOST_SMART_PTR_MAKE_LOCAL_SHARED_HPP_INCLUDED
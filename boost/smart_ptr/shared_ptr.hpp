@@ -440,6 +440,11 @@ public:
     {
     }
 
+    // used by local_shared_ptr when converting to shared_ptr
+    shared_ptr( boost::detail::sp_internal_constructor_tag, element_type * px_, boost::detail::shared_count const & pn_ ) BOOST_NOEXCEPT : px( px_ ), pn( pn_ )
+    {
+    }
+
 #ifndef BOOST_NO_AUTO_PTR
 
     template<class Y>
@@ -707,6 +712,11 @@ public:
         return pn.get_untyped_deleter();
     }
 
+    boost::detail::shared_count _internal_count() const BOOST_NOEXCEPT
+    {
+        return pn;
+    }
+
     bool _internal_equiv( shared_ptr const & r ) const BOOST_NOEXCEPT
     {
         return px == r.px && pn == r.pn;
@@ -15,6 +15,8 @@
 #include <boost/limits.hpp>
 
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/spirit/home/support/char_class.hpp>
 #include <boost/spirit/home/support/unused.hpp>
 #include <boost/spirit/home/support/numeric_traits.hpp>
@@ -572,6 +574,28 @@ namespace boost { namespace spirit { namespace karma
         }                                                                     \
     /**/
 
+    namespace detail
+    {
+        // "00", "01", ... "99", for generating two decimal digits at a time
+        template <typename Dummy = void>
+        struct decimal_digit_pairs
+        {
+            static char const value[201];
+        };
+
+        template <typename Dummy>
+        char const decimal_digit_pairs<Dummy>::value[201] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        template <unsigned Radix, typename T>
+        struct use_decimal_digit_pairs
+          : mpl::bool_<Radix == 10 && is_integral<T>::value
+              && !is_same<T, bool>::value>
+        {};
+    }
+
     template <
         unsigned Radix, typename CharEncoding = unused_type
       , typename Tag = unused_type>
@@ -605,12 +629,62 @@ namespace boost { namespace spirit { namespace karma
             return true;
         }
 
+        //  Decimal integers are generated right to left into a buffer, two
+        //  digits at a time. n must not be negative.
+        template <typename OutputIterator, typename T>
+        static bool
+        call_decimal(OutputIterator& sink, T n)
+        {
+            char const* pairs = detail::decimal_digit_pairs<>::value;
+            char buffer[std::numeric_limits<T>::digits10 + 1];
+            char* const end = buffer + sizeof(buffer);
+            char* p = end;
+            while (n >= 100)
+            {
+                unsigned r = static_cast<unsigned>(n % 100) * 2;
+                n /= 100;
+                *--p = pairs[r + 1];
+                *--p = pairs[r];
+            }
+            if (n >= 10)
+            {
+                unsigned r = static_cast<unsigned>(n) * 2;
+                *--p = pairs[r + 1];
+                *--p = pairs[r];
+            }
+            else
+            {
+                *--p = char('0' + n);
+            }
+
+            for (/**/; p != end; ++p)
+            {
+                *sink = *p;
+                ++sink;
+            }
+            return true;
+        }
+
+        template <typename OutputIterator, typename T>
+        static bool
+        call(OutputIterator& sink, T n, mpl::true_)
+        {
+            return call_decimal(sink, n);
+        }
+
+        template <typename OutputIterator, typename T>
+        static bool
+        call(OutputIterator& sink, T n, mpl::false_)
+        {
+            return call(sink, n, n, 0);
+        }
+
         //  Common code for integer string representations
         template <typename OutputIterator, typename T>
         static bool
         call(OutputIterator& sink, T n)
         {
-            return call(sink, n, n, 0);
+            return call(sink, n, detail::use_decimal_digit_pairs<Radix, T>());
         }
 
     private:
@@ -640,7 +714,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -651,7 +725,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -662,7 +736,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -691,7 +765,7 @@ namespace boost { namespace spirit { namespace karma
         {
             typedef typename traits::absolute_value<T>::type type;
             type un = type(n);
-            return base_type::call(sink, un, un, 0);
+            return base_type::call(sink, un);
         }
     };
 
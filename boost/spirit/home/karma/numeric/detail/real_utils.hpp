@@ -14,6 +14,8 @@
 #include <boost/config/no_tr1/cmath.hpp>
 #include <boost/detail/workaround.hpp>
 #include <boost/limits.hpp>
+#include <boost/detail/lcast_float.hpp>
+#include <boost/mpl/bool.hpp>
 
 #include <boost/spirit/home/support/char_class.hpp>
 #include <boost/spirit/home/support/unused.hpp>
@@ -35,6 +37,22 @@ namespace boost { namespace spirit { namespace karma
     template <typename T>
     struct real_policies;
 
+    namespace detail
+    {
+        // The types for which the shortest digits reading back as the same
+        // value can be computed directly
+        template <typename T>
+        struct has_shortest_digits : mpl::false_ {};
+
+#if !defined(BOOST_LCAST_NO_FAST_FLOAT)
+        template <>
+        struct has_shortest_digits<float> : mpl::true_ {};
+
+        template <>
+        struct has_shortest_digits<double> : mpl::true_ {};
+#endif
+    }
+
     template <typename T
       , typename Policies = real_policies<T>
       , typename CharEncoding = unused_type
@@ -174,6 +192,109 @@ namespace boost { namespace spirit { namespace karma
             return r;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        //  Generate the fewest digits which read back as the same value,
+        //  in the format chosen by floatfield() and with the sign, the dot
+        //  and the exponent generated by the policies. The precision(),
+        //  trailing_zeros(), integer_part() and fraction_part() functions of
+        //  the policies are not used. Types other than float and double are
+        //  generated by call_n().
+        ///////////////////////////////////////////////////////////////////////
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p)
+        {
+            return call_shortest(sink, n, p
+              , detail::has_shortest_digits<U>());
+        }
+
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p
+          , mpl::false_)
+        {
+            return call_n(sink, n, p);
+        }
+
+#if !defined(BOOST_LCAST_NO_FAST_FLOAT)
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p
+          , mpl::true_)
+        {
+        // prepare sign and get output format
+            bool force_sign = p.force_sign(n);
+            bool sign_val = false;
+            int flags = p.floatfield(n);
+            if (traits::test_negative(n)) 
+            {
+                n = -n;
+                sign_val = true;
+            }
+
+        // get the digits and the power of ten of the first one
+            char digits[20];
+            int length = 1;
+            long dim = 0;
+            if (traits::test_zero(n))
+            {
+                digits[0] = '0';
+                sign_val = false;     // result is zero, no sign please
+            }
+            else
+            {
+                int exp = 0;
+                length = boost::detail::lcast_grisu2(n, digits, exp);
+                while (digits[length-1] == '0')
+                {
+                    --length;
+                    ++exp;
+                }
+                dim = exp + length - 1;
+            }
+
+        // the number of digits in front of the dot
+            bool scientific = 0 == (Policies::fmtflags::fixed & flags);
+            long point = scientific ? 1 : dim + 1;
+
+        // generate integer part
+            bool r = sign_inserter::call(sink, traits::test_zero(n)
+              , sign_val, force_sign);
+            if (point <= 0)
+            {
+                r = r && char_inserter<>::call(sink, '0');
+            }
+            else
+            {
+                for (long i = 0; r && i < point; ++i)
+                    r = char_inserter<>::call(sink, i < length ? digits[i] : '0');
+            }
+
+        // generate decimal point
+            unsigned prec = (point < length) ? unsigned(length - point) : 0;
+            if (point < 0)
+                prec += unsigned(-point);
+            r = r && p.dot(sink, n, prec);
+
+        // generate fractional part
+            if (prec == 0)
+            {
+                r = r && char_inserter<>::call(sink, '0');
+            }
+            else
+            {
+                for (long i = point; r && i < 0; ++i)
+                    r = char_inserter<>::call(sink, '0');
+                for (long i = (std::max)(point, 0L); r && i < length; ++i)
+                    r = char_inserter<>::call(sink, digits[i]);
+            }
+
+            if (r && scientific)
+                return p.template exponent<CharEncoding, Tag>(sink, dim);
+            return r;
+        }
+#endif
+
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
 # pragma warning(pop)
 #endif 
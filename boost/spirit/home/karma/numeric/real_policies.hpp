@@ -328,6 +328,36 @@ namespace boost { namespace spirit { namespace karma
                    string_inserter<CharEncoding, Tag>::call(sink, "inf");
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  shortest_real_policies generates the fewest digits which read back
+    //  as the same value (for float and double), instead of rounding to
+    //  the precision() digits. The digits are computed with integer
+    //  arithmetics only (using the Grisu2 algorithm), which is much faster
+    //  than the default conversion. The format is still chosen by
+    //  floatfield(), and the sign, the dot, the exponent and the
+    //  representation of NaN and Inf are still generated by the policies:
+    //
+    //      typedef 
+    //          karma::real_generator<double, shortest_real_policies<double> > 
+    //      shortest_type;
+    //
+    //      karma::generate(sink, shortest_type(), 0.1);      // 0.1
+    //      karma::generate(sink, shortest_type(), 1.0/3);    // 0.3333333333333333
+    //      karma::generate(sink, shortest_type(), 1.5e300);  // 1.5e300
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct shortest_real_policies : real_policies<T>
+    {
+        template <typename Inserter, typename OutputIterator, typename Policies>
+        static bool
+        call (OutputIterator& sink, T n, Policies const& p)
+        {
+            return Inserter::call_shortest(sink, n, p);
+        }
+    };
 }}}
 
 #endif // defined(BOOST_SPIRIT_KARMA_REAL_POLICIES_MAR_02_2007_0936AM)
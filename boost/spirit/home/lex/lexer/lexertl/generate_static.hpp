@@ -17,10 +17,15 @@
 #include <boost/spirit/home/support/detail/lexer/size_t.hpp>
 #include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
 #include <boost/spirit/home/support/detail/lexer/debug.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/static_version.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace boost { namespace spirit { namespace lex { namespace lexertl
 {
@@ -765,6 +770,12 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
                     os_ << "\n    if (";
 
+                    // a transition for any character
+                    if (iter_->token.any())
+                    {
+                        os_ << "true";
+                    }
+
                     while (ptr_ != end_)
                     {
                         curr_char_ = *ptr_++;
@@ -871,6 +882,868 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         return os_.good();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The scanner generated by generate_static_scanner() selects the
+    // transitions of a DFA state with a switch statement, which compilers
+    // turn into a jump table instead of a chain of comparisons. Keywords are
+    // not part of the DFA, they are looked up in a perfect hash after the
+    // more general rule matching them (usually the identifier) matched.
+    inline std::size_t char_value(char ch)
+    {
+        return static_cast<unsigned char>(ch);
+    }
+
+    inline std::size_t char_value(wchar_t ch)
+    {
+        return static_cast<std::size_t>(ch);
+    }
+
+    typedef std::pair<std::size_t, std::size_t> char_range;
+
+    template <typename Char>
+    inline void get_char_ranges(std::basic_string<Char> const& charset_
+      , std::vector<char_range>& ranges_)
+    {
+        std::vector<std::size_t> chars_;
+        for (std::size_t i_ = 0; i_ < charset_.size(); ++i_)
+        {
+            chars_.push_back(char_value(charset_[i_]));
+        }
+        std::sort(chars_.begin(), chars_.end());
+
+        ranges_.clear();
+        for (std::size_t i_ = 0; i_ < chars_.size(); ++i_)
+        {
+            if (!ranges_.empty() && ranges_.back().second + 1 == chars_[i_])
+                ranges_.back().second = chars_[i_];
+            else
+                ranges_.push_back(char_range(chars_[i_], chars_[i_]));
+        }
+    }
+
+    template <typename Char>
+    inline void generate_case_label(std::basic_ostream<Char>& os_
+      , std::size_t ch_)
+    {
+        if (ch_ >= 32 && ch_ < 127)
+        {
+            os_ << '\'';
+            if (ch_ == '\'' || ch_ == '\\')
+                os_ << '\\';
+            os_ << static_cast<Char>(ch_) << '\'';
+        }
+        else
+        {
+            os_ << ch_;
+        }
+    }
+
+    template <typename Char>
+    inline void generate_case_labels(std::basic_ostream<Char>& os_
+      , std::vector<std::size_t> const& chars_)
+    {
+        for (std::size_t i_ = 0; i_ < chars_.size(); ++i_)
+        {
+            os_ << ((i_ % 6) ? " " : (i_ ? "\n    " : "    ")) << "case ";
+            generate_case_label(os_, chars_[i_]);
+            os_ << ':';
+        }
+        os_ << '\n';
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The keywords of a lexer state matched by the same rule, stored in the
+    // slots of a perfect hash table.
+    template <typename Char>
+    struct keyword_table
+    {
+        keyword_table(std::size_t state, std::size_t unique_id)
+          : state(state), unique_id(unique_id), seed(0), all_chars(false) {}
+
+        std::size_t state;          // the lexer state
+        std::size_t unique_id;      // the rule matching the keywords
+        std::size_t seed;
+        bool all_chars;             // hash all characters, not the ends
+        std::vector<std::basic_string<Char> > keywords;
+        std::vector<std::size_t> ids;
+        std::vector<std::size_t> unique_ids;
+    };
+
+    // The generated code computes the same hash, restricting it to 16 bit
+    // makes it independent of the size of std::size_t. Hashing the first
+    // and the last character and the length is cheaper and distinguishes
+    // most sets of keywords, the others hash all characters.
+    template <typename Char>
+    inline std::size_t
+    keyword_hash(std::basic_string<Char> const& keyword, std::size_t seed
+      , bool all_chars)
+    {
+        std::size_t h = 0;
+        if (all_chars)
+        {
+            for (std::size_t i = 0; i < keyword.size(); ++i)
+                h = ((h ^ char_value(keyword[i])) * seed) & 0xffff;
+        }
+        else
+        {
+            h = (((char_value(keyword[0]) << 8) ^
+                char_value(keyword[keyword.size() - 1]) ^
+                (keyword.size() << 4)) * seed) & 0xffff;
+        }
+        return h;
+    }
+
+    // the slots are selected by the upper bits of the hash, which depend on
+    // all characters
+    inline std::size_t keyword_shift(std::size_t size)
+    {
+        std::size_t shift = 16;
+        for (/**/; size > 1; size /= 2)
+            --shift;
+        return shift;
+    }
+
+    // find a seed and a table size for which no two keywords share a slot,
+    // and move the keywords into their slots
+    template <typename Char>
+    bool find_keyword_hash(keyword_table<Char>& table)
+    {
+        std::size_t const count = table.keywords.size();
+        std::size_t min_size = 1;
+        while (min_size < count)
+            min_size *= 2;
+
+        for (int all_chars = 0; all_chars != 2; ++all_chars)
+        for (std::size_t size = min_size; size <= min_size * 16; size *= 2)
+        {
+            std::size_t const shift = keyword_shift(size);
+            for (std::size_t seed = 1; seed < 4096; seed += 2)
+            {
+                std::vector<std::size_t> slots(size, boost::lexer::npos);
+                std::size_t i = 0;
+                for (/**/; i < count; ++i)
+                {
+                    std::size_t const slot = keyword_hash(table.keywords[i]
+                      , seed, all_chars != 0) >> shift;
+                    if (slots[slot] != boost::lexer::npos)
+                        break;
+                    slots[slot] = i;
+                }
+                if (i != count)
+                    continue;
+
+                keyword_table<Char> result(table.state, table.unique_id);
+                result.seed = seed;
+                result.all_chars = all_chars != 0;
+                for (std::size_t slot = 0; slot < size; ++slot)
+                {
+                    if (slots[slot] == boost::lexer::npos)
+                    {
+                        result.keywords.push_back(std::basic_string<Char>());
+                        result.ids.push_back(boost::lexer::npos);
+                        result.unique_ids.push_back(boost::lexer::npos);
+                    }
+                    else
+                    {
+                        result.keywords.push_back(table.keywords[slots[slot]]);
+                        result.ids.push_back(table.ids[slots[slot]]);
+                        result.unique_ids.push_back(table.unique_ids[slots[slot]]);
+                    }
+                }
+                std::swap(table, result);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // a rule matching nothing but a word may be looked up as a keyword
+    template <typename Char>
+    bool is_keyword_literal(std::basic_string<Char> const& regex_)
+    {
+        if (regex_.empty())
+            return false;
+
+        for (std::size_t i_ = 0; i_ < regex_.size(); ++i_)
+        {
+            Char const ch_ = regex_[i_];
+            if (!((ch_ >= 'a' && ch_ <= 'z') || (ch_ >= 'A' && ch_ <= 'Z') ||
+                  (ch_ >= '0' && ch_ <= '9') || ch_ == '_'))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // run the DFA of the given lexer state over a keyword, returning the
+    // rule matching all of it
+    template <typename Char>
+    bool match_keyword(boost::lexer::basic_state_machine<Char> const& sm_
+      , std::size_t state_, std::basic_string<Char> const& keyword_
+      , std::size_t& unique_id_, std::size_t& goto_state_)
+    {
+        std::size_t const* lookup_ = &sm_.data()._lookup[state_]->front();
+        std::size_t const dfa_alphabet_ = sm_.data()._dfa_alphabet[state_];
+        std::size_t const* dfa_ = &sm_.data()._dfa[state_]->front();
+        std::size_t const* ptr_ = dfa_ + dfa_alphabet_;
+
+        for (std::size_t i_ = 0; i_ < keyword_.size(); ++i_)
+        {
+            std::size_t const next_ = ptr_[lookup_[char_value(keyword_[i_])]];
+            if (next_ == 0)
+                return false;
+            ptr_ = dfa_ + next_ * dfa_alphabet_;
+        }
+
+        if (!ptr_[boost::lexer::end_state_index])
+            return false;
+
+        unique_id_ = ptr_[boost::lexer::unique_id_index];
+        goto_state_ = ptr_[boost::lexer::state_index];
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Build the state machine for the scanner from all rules but the
+    // keywords. A keyword is left out only if the rule matching it in the
+    // remaining DFA comes after it, switches to the same lexer state, and if
+    // the keywords of that rule have a perfect hash, which guarantees the
+    // lookup gives the same tokens as the full DFA. The unique ids of the
+    // rebuilt rules are mapped back to the ones of the original rules.
+    template <typename Char>
+    void build_scanner(boost::lexer::basic_rules<Char> const& rules_
+      , boost::lexer::basic_state_machine<Char>& sm_
+      , std::vector<std::size_t>& unique_ids_
+      , std::vector<keyword_table<Char> >& keywords_)
+    {
+        typedef boost::lexer::basic_rules<Char> rules_type;
+        typedef std::basic_string<Char> string_type;
+
+        std::size_t const states_ = rules_.statemap().size();
+        std::vector<std::vector<bool> > removed_(states_);
+
+        for (std::size_t s_ = 0; s_ < states_; ++s_)
+        {
+            std::size_t const count_ = rules_.regexes()[s_].size();
+            removed_[s_].resize(count_, false);
+            if (rules_.flags() & boost::lexer::icase)
+                continue;
+
+            std::map<string_type, std::size_t> literals_;
+            for (std::size_t i_ = 0; i_ < count_; ++i_)
+            {
+                string_type const& regex_ = rules_.regexes()[s_][i_];
+                if (rules_.ids()[s_][i_] != 0 && is_keyword_literal(regex_))
+                    ++literals_[regex_];
+            }
+            for (std::size_t i_ = 0; i_ < count_; ++i_)
+            {
+                typename std::map<string_type, std::size_t>::iterator it_ =
+                    literals_.find(rules_.regexes()[s_][i_]);
+                removed_[s_][i_] = it_ != literals_.end() && it_->second == 1;
+            }
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t> > rule_index_;
+        for (;;)
+        {
+            rules_type reduced_(rules_.flags());
+            std::locale locale_(rules_.locale());
+            reduced_.imbue(locale_);
+            for (std::size_t s_ = 1; s_ < states_; ++s_)
+                reduced_.add_state(rules_.state(s_));
+            reduced_.add_macros(rules_);
+
+            rule_index_.clear();
+            bool any_removed_ = false;
+            for (std::size_t s_ = 0; s_ < states_; ++s_)
+            {
+                for (std::size_t i_ = 0; i_ < removed_[s_].size(); ++i_)
+                {
+                    if (removed_[s_][i_])
+                    {
+                        any_removed_ = true;
+                        continue;
+                    }
+
+                    Char const* state_ = rules_.state(s_);
+                    string_type const& regex_ = rules_.regexes()[s_][i_];
+                    std::size_t const id_ = rules_.ids()[s_][i_];
+                    Char const* target_ = rules_.state(rules_.states()[s_][i_]);
+                    std::size_t const uid_ = (id_ == 0) ?
+                        reduced_.add(state_, regex_, target_) :
+                        reduced_.add(state_, regex_, id_, target_);
+
+                    if (rule_index_.size() <= uid_)
+                        rule_index_.resize(uid_ + 1);
+                    rule_index_[uid_] = std::make_pair(s_, i_);
+                }
+            }
+
+            sm_.clear();
+            boost::lexer::basic_generator<Char>::build(reduced_, sm_);
+            boost::lexer::basic_generator<Char>::minimise(sm_);
+
+            keywords_.clear();
+            if (!any_removed_)
+                break;
+
+            // the DFA does not know whether a keyword starts a line
+            if (sm_.data()._seen_BOL_assertion || sm_.data()._seen_EOL_assertion)
+            {
+                for (std::size_t s_ = 0; s_ < states_; ++s_)
+                    removed_[s_].assign(removed_[s_].size(), false);
+                continue;
+            }
+
+            bool again_ = false;
+            std::map<std::pair<std::size_t, std::size_t>, std::size_t> tables_;
+            for (std::size_t s_ = 0; s_ < states_; ++s_)
+            {
+                for (std::size_t i_ = 0; i_ < removed_[s_].size(); ++i_)
+                {
+                    if (!removed_[s_][i_])
+                        continue;
+
+                    std::size_t uid_ = 0;
+                    std::size_t goto_ = 0;
+                    if (!match_keyword(sm_, s_, rules_.regexes()[s_][i_], uid_, goto_) ||
+                        rule_index_[uid_].first != s_ ||
+                        rule_index_[uid_].second < i_ ||
+                        goto_ != rules_.states()[s_][i_])
+                    {
+                        removed_[s_][i_] = false;
+                        again_ = true;
+                        continue;
+                    }
+
+                    std::size_t const rule_ = rule_index_[uid_].second;
+                    std::pair<std::size_t, std::size_t> const key_(s_,
+                        rules_.unique_ids()[s_][rule_]);
+                    if (tables_.find(key_) == tables_.end())
+                    {
+                        tables_[key_] = keywords_.size();
+                        keywords_.push_back(
+                            keyword_table<Char>(key_.first, key_.second));
+                    }
+
+                    keyword_table<Char>& table_ = keywords_[tables_[key_]];
+                    table_.keywords.push_back(rules_.regexes()[s_][i_]);
+                    table_.ids.push_back(rules_.ids()[s_][i_]);
+                    table_.unique_ids.push_back(rules_.unique_ids()[s_][i_]);
+                }
+            }
+
+            if (!again_)
+            {
+                for (std::size_t t_ = 0; t_ < keywords_.size(); ++t_)
+                {
+                    if (find_keyword_hash(keywords_[t_]))
+                        continue;
+
+                    // keep these keywords in the DFA
+                    std::size_t const s_ = keywords_[t_].state;
+                    for (std::size_t i_ = 0; i_ < removed_[s_].size(); ++i_)
+                    {
+                        if (removed_[s_][i_] && std::find(
+                                keywords_[t_].keywords.begin()
+                              , keywords_[t_].keywords.end()
+                              , rules_.regexes()[s_][i_]) !=
+                            keywords_[t_].keywords.end())
+                        {
+                            removed_[s_][i_] = false;
+                        }
+                    }
+                    again_ = true;
+                }
+            }
+
+            if (!again_)
+                break;
+        }
+
+        unique_ids_.clear();
+        for (std::size_t u_ = 0; u_ < rule_index_.size(); ++u_)
+        {
+            unique_ids_.push_back(rules_.unique_ids()
+                [rule_index_[u_].first][rule_index_[u_].second]);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    struct scanner_function_body
+    {
+        scanner_function_body(std::vector<std::size_t> const& unique_ids
+              , std::vector<keyword_table<Char> > const& keywords)
+          : unique_ids_(unique_ids), keywords_(keywords)
+        {}
+
+        bool operator()(std::basic_ostream<Char>& os_
+          , boost::lexer::basic_state_machine<Char> const& sm_) const
+        {
+            typedef typename boost::lexer::basic_state_machine<Char>::iterator
+                iterator_type;
+
+            std::size_t const lookups_ = sm_.data()._lookup->front ()->size ();
+            iterator_type iter_ = sm_.begin();
+            std::size_t const dfas_ = sm_.data()._dfa->size ();
+            char const* const char_name_ = (lookups_ == 256) ? "char" : "wchar_t";
+
+            os_ << "    static std::size_t const npos = "
+                   "static_cast<std::size_t>(~0);\n";
+
+            os_ << "\n    if (start_token_ == end_)\n";
+            os_ << "    {\n";
+            os_ << "        unique_id_ = npos;\n";
+            os_ << "        return 0;\n";
+            os_ << "    }\n\n";
+
+            if (sm_.data()._seen_BOL_assertion)
+            {
+                os_ << "    bool bol = bol_;\n";
+            }
+
+            if (dfas_ > 1)
+            {
+                os_ << "again:\n";
+            }
+
+            os_ << "    Iterator curr_ = start_token_;\n";
+            os_ << "    bool end_state_ = false;\n";
+            os_ << "    std::size_t id_ = npos;\n";
+            os_ << "    std::size_t uid_ = npos;\n";
+
+            if (dfas_ > 1)
+            {
+                os_ << "    std::size_t end_start_state_ = start_state_;\n";
+            }
+
+            if (sm_.data()._seen_BOL_assertion)
+            {
+                os_ << "    bool end_bol_ = bol_;\n";
+            }
+
+            os_ << "    Iterator end_token_ = start_token_;\n";
+            os_ << '\n';
+
+            os_ << "    " << char_name_ << " ch_ = 0;\n\n";
+
+            if (dfas_ > 1)
+            {
+                os_ << "    switch (start_state_)\n";
+                os_ << "    {\n";
+
+                for (std::size_t i_ = 0; i_ < dfas_; ++i_)
+                {
+                    os_ << "    case " << i_ << ":\n";
+                    os_ << "        goto state" << i_ << "_0;\n";
+                    os_ << "        break;\n";
+                }
+
+                os_ << "    default:\n";
+                os_ << "        goto end;\n";
+                os_ << "        break;\n";
+                os_ << "    }\n";
+            }
+
+            bool need_state0_0_label = need_label0_0(sm_);
+
+            // ranges of more characters are tested with comparisons
+            std::size_t const max_cases_ = (lookups_ == 256) ? 256 : 64;
+
+            for (std::size_t dfa_ = 0; dfa_ < dfas_; ++dfa_)
+            {
+                std::size_t const states_ = iter_->states;
+                for (std::size_t state_ = 0; state_ < states_; ++state_)
+                {
+                    std::size_t const transitions_ = iter_->transitions;
+
+                    if (dfas_ > 1 || dfa_ != 0 || state_ != 0 || need_state0_0_label)
+                    {
+                        os_ << "\nstate" << dfa_ << '_' << state_ << ":\n";
+                    }
+
+                    if (iter_->end_state)
+                    {
+                        os_ << "    end_state_ = true;\n";
+                        os_ << "    id_ = " << iter_->id << ";\n";
+                        os_ << "    uid_ = " << unique_ids_[iter_->unique_id] << ";\n";
+                        os_ << "    end_token_ = curr_;\n";
+
+                        if (dfas_ > 1)
+                        {
+                            os_ << "    end_start_state_ = " << iter_->goto_dfa <<
+                                ";\n";
+                        }
+
+                        if (sm_.data()._seen_BOL_assertion)
+                        {
+                            os_ << "    end_bol_ = bol;\n";
+                        }
+
+                        if (transitions_) os_ << '\n';
+                    }
+
+                    if (transitions_ ||
+                        iter_->bol_index != boost::lexer::npos ||
+                        iter_->eol_index != boost::lexer::npos)
+                    {
+                        os_ << "    if (curr_ == end_) goto end;\n";
+                        os_ << "    ch_ = *curr_;\n";
+                        if (iter_->bol_index != boost::lexer::npos)
+                        {
+                            os_ << "\n    if (bol) goto state" << dfa_ << '_'
+                                << iter_->bol_index << ";\n";
+                        }
+                        if (iter_->eol_index != boost::lexer::npos)
+                        {
+                            os_ << "\n    if (ch_ == '\\n') goto state" << dfa_
+                                << '_' << iter_->eol_index << ";\n";
+                        }
+                        os_ << "    ++curr_;\n";
+                        if (sm_.data()._seen_BOL_assertion)
+                        {
+                            os_ << "    bol = ch_ == '\\n';\n";
+                        }
+                    }
+
+                    // collect the characters of all transitions, at most
+                    // one of them is negated (it holds more than half of
+                    // all characters)
+                    std::vector<std::vector<std::size_t> > cases_(transitions_);
+                    std::vector<std::size_t> targets_(transitions_);
+                    std::vector<std::pair<char_range, std::size_t> > large_;
+                    std::vector<char_range> excluded_;
+                    std::size_t negated_ = boost::lexer::npos;
+
+                    for (std::size_t t_ = 0; t_ < transitions_; ++t_, ++iter_)
+                    {
+                        std::vector<char_range> ranges_;
+                        get_char_ranges(iter_->token._charset, ranges_);
+                        targets_[t_] = iter_->goto_state;
+
+                        if (iter_->token._negated)
+                        {
+                            negated_ = iter_->goto_state;
+                            excluded_.swap(ranges_);
+                            continue;
+                        }
+
+                        for (std::size_t r_ = 0; r_ < ranges_.size(); ++r_)
+                        {
+                            if (ranges_[r_].second - ranges_[r_].first >= max_cases_)
+                            {
+                                large_.push_back(std::make_pair(ranges_[r_]
+                                  , iter_->goto_state));
+                                continue;
+                            }
+                            for (std::size_t ch_ = ranges_[r_].first;
+                                 ch_ <= ranges_[r_].second; ++ch_)
+                            {
+                                cases_[t_].push_back(ch_);
+                            }
+                        }
+                    }
+
+                    // the characters not part of the negated transition
+                    // and of no other transition end the token
+                    std::vector<std::size_t> end_cases_;
+                    bool negated_compare_ = false;
+                    for (std::size_t r_ = 0; r_ < excluded_.size(); ++r_)
+                    {
+                        if (excluded_[r_].second - excluded_[r_].first >= max_cases_)
+                        {
+                            negated_compare_ = true;
+                            break;
+                        }
+                        for (std::size_t ch_ = excluded_[r_].first;
+                             ch_ <= excluded_[r_].second; ++ch_)
+                        {
+                            bool found_ = false;
+                            for (std::size_t t_ = 0; !found_ && t_ < transitions_; ++t_)
+                            {
+                                found_ = std::binary_search(cases_[t_].begin()
+                                  , cases_[t_].end(), ch_);
+                            }
+                            for (std::size_t l_ = 0; !found_ && l_ < large_.size(); ++l_)
+                            {
+                                found_ = ch_ >= large_[l_].first.first &&
+                                    ch_ <= large_[l_].first.second;
+                            }
+                            if (!found_)
+                                end_cases_.push_back(ch_);
+                        }
+                    }
+                    if (negated_compare_)
+                        end_cases_.clear();
+
+                    for (std::size_t l_ = 0; l_ < large_.size(); ++l_)
+                    {
+                        os_ << "    if (ch_ >= " << large_[l_].first.first
+                            << " && ch_ <= " << large_[l_].first.second
+                            << ") goto state" << dfa_ << '_'
+                            << large_[l_].second << ";\n";
+                    }
+
+                    bool has_cases_ = !end_cases_.empty() ||
+                        (negated_ != boost::lexer::npos && !negated_compare_);
+                    for (std::size_t t_ = 0; t_ < transitions_; ++t_)
+                    {
+                        has_cases_ = has_cases_ || !cases_[t_].empty();
+                    }
+
+                    bool exits_ = false;
+                    if (has_cases_)
+                    {
+                        os_ << "\n    switch ("
+                            << ((lookups_ == 256) ?
+                                "static_cast<unsigned char>(ch_)" : "ch_")
+                            << ")\n";
+                        os_ << "    {\n";
+                        for (std::size_t t_ = 0; t_ < transitions_; ++t_)
+                        {
+                            if (cases_[t_].empty())
+                                continue;
+                            generate_case_labels(os_, cases_[t_]);
+                            os_ << "        goto state" << dfa_ << '_'
+                                << targets_[t_] << ";\n";
+                        }
+                        if (!end_cases_.empty())
+                        {
+                            generate_case_labels(os_, end_cases_);
+                            os_ << "        goto end;\n";
+                        }
+                        os_ << "    default:\n";
+                        if (negated_ != boost::lexer::npos && !negated_compare_)
+                        {
+                            os_ << "        goto state" << dfa_ << '_'
+                                << negated_ << ";\n";
+                            exits_ = true;
+                        }
+                        else if (!negated_compare_)
+                        {
+                            os_ << "        goto end;\n";
+                            exits_ = true;
+                        }
+                        else
+                        {
+                            os_ << "        break;\n";
+                        }
+                        os_ << "    }\n";
+                    }
+
+                    if (negated_compare_)
+                    {
+                        os_ << "\n    if (";
+                        for (std::size_t r_ = 0; r_ < excluded_.size(); ++r_)
+                        {
+                            if (r_)
+                                os_ << " && ";
+                            if (excluded_[r_].first == excluded_[r_].second)
+                            {
+                                os_ << "ch_ != " << excluded_[r_].first;
+                            }
+                            else
+                            {
+                                os_ << "!(ch_ >= " << excluded_[r_].first
+                                    << " && ch_ <= " << excluded_[r_].second << ")";
+                            }
+                        }
+                        os_ << ") goto state" << dfa_ << '_' << negated_ << ";\n";
+                    }
+
+                    if (!exits_ && !(dfa_ == dfas_ - 1 && state_ == states_ - 1))
+                    {
+                        os_ << "    goto end;\n";
+                    }
+
+                    if (transitions_ == 0) ++iter_;
+                }
+            }
+
+            os_ << "\nend:\n";
+
+            for (std::size_t k_ = 0; k_ < keywords_.size(); ++k_)
+            {
+                if (!generate_keyword_lookup(os_, keywords_[k_], dfas_ > 1
+                      , char_name_))
+                {
+                    return false;
+                }
+            }
+
+            os_ << "    if (end_state_)\n";
+            os_ << "    {\n";
+            os_ << "        // return longest match\n";
+            os_ << "        start_token_ = end_token_;\n";
+
+            if (dfas_ > 1)
+            {
+                os_ << "        start_state_ = end_start_state_;\n";
+                os_ << "\n        if (id_ == 0)\n";
+                os_ << "        {\n";
+
+                if (sm_.data()._seen_BOL_assertion)
+                {
+                    os_ << "            bol = end_bol_;\n";
+                }
+
+                os_ << "            goto again;\n";
+                os_ << "        }\n";
+
+                if (sm_.data()._seen_BOL_assertion)
+                {
+                    os_ << "        else\n";
+                    os_ << "        {\n";
+                    os_ << "            bol_ = end_bol_;\n";
+                    os_ << "        }\n";
+                }
+            }
+            else if (sm_.data()._seen_BOL_assertion)
+            {
+                os_ << "        bol_ = end_bol_;\n";
+            }
+
+            os_ << "    }\n";
+            os_ << "    else\n";
+            os_ << "    {\n";
+
+            if (sm_.data()._seen_BOL_assertion)
+            {
+                os_ << "        bol_ = (*start_token_ == '\\n') ? true : false;\n";
+            }
+            os_ << "        id_ = npos;\n";
+            os_ << "        uid_ = npos;\n";
+            os_ << "    }\n\n";
+
+            os_ << "    unique_id_ = uid_;\n";
+            os_ << "    return id_;\n";
+            return os_.good();
+        }
+
+        // replace the token matched by the rule of the keyword table by the
+        // keyword it spells, if any
+        static bool generate_keyword_lookup(std::basic_ostream<Char>& os_
+          , keyword_table<Char> const& table_, bool check_state_
+          , char const* char_name_)
+        {
+            std::size_t const size_ = table_.keywords.size();
+            std::size_t max_length_ = 0;
+            std::size_t min_length_ = boost::lexer::npos;
+            for (std::size_t i_ = 0; i_ < size_; ++i_)
+            {
+                std::size_t const length_ = table_.keywords[i_].size();
+                if (length_ == 0)
+                    continue;
+                if (length_ > max_length_)
+                    max_length_ = length_;
+                if (length_ < min_length_)
+                    min_length_ = length_;
+            }
+
+            os_ << "    if (end_state_ && ";
+            if (check_state_)
+                os_ << "start_state_ == " << table_.state << " && ";
+            os_ << "uid_ == " << table_.unique_id << ")\n";
+            os_ << "    {\n";
+            os_ << "        // the keywords matched by this rule\n";
+            os_ << "        static " << char_name_ << " const* const keywords_["
+                << size_ << "] = {";
+            for (std::size_t i_ = 0; i_ < size_; ++i_)
+            {
+                os_ << ((i_ % 4) ? " " : "\n            ")
+                    << boost::lexer::detail::strings<Char>::char_prefix()
+                    << '"' << table_.keywords[i_] << '"'
+                    << ((i_ + 1 < size_) ? "," : "");
+            }
+            os_ << " };\n";
+            os_ << "        static std::size_t const keyword_lengths_["
+                << size_ << "] = {";
+            generate_keyword_values(os_, table_.keywords, table_.ids, true);
+            os_ << "        static std::size_t const keyword_ids_["
+                << size_ << "] = {";
+            generate_keyword_values(os_, table_.keywords, table_.ids, false);
+            os_ << "        static std::size_t const keyword_uids_["
+                << size_ << "] = {";
+            generate_keyword_values(os_, table_.keywords, table_.unique_ids, false);
+            os_ << '\n';
+
+            char const* const cast_ = (sizeof(Char) == 1) ?
+                "static_cast<unsigned char>" : "static_cast<std::size_t>";
+
+            os_ << "        " << char_name_ << " kw_[" << max_length_ << "];\n";
+            os_ << "        std::size_t len_ = 0;\n";
+            if (table_.all_chars)
+                os_ << "        std::size_t h_ = 0;\n";
+            os_ << "        Iterator it_ = start_token_;\n";
+            os_ << "        for (/**/; it_ != end_token_ && len_ != " << max_length_
+                << "; ++it_, ++len_)\n";
+            os_ << "        {\n";
+            os_ << "            kw_[len_] = *it_;\n";
+            if (table_.all_chars)
+            {
+                os_ << "            h_ = ((h_ ^ " << cast_ << "(kw_[len_])) * "
+                    << table_.seed << ") & 0xffff;\n";
+            }
+            os_ << "        }\n\n";
+
+            os_ << "        if (it_ == end_token_ && len_ >= " << min_length_ << ")\n";
+            os_ << "        {\n";
+            if (!table_.all_chars)
+            {
+                os_ << "            std::size_t const h_ = (((" << cast_
+                    << "(kw_[0]) << 8) ^\n";
+                os_ << "                " << cast_ << "(kw_[len_ - 1]) ^ (len_ << 4)) * "
+                    << table_.seed << ") & 0xffff;\n";
+            }
+            os_ << "            std::size_t const i_ = h_ >> "
+                << keyword_shift(size_) << ";\n";
+            os_ << "            if (keyword_lengths_[i_] == len_)\n";
+            os_ << "            {\n";
+            os_ << "                std::size_t n_ = 0;\n";
+            os_ << "                while (n_ != len_ && kw_[n_] == keywords_[i_][n_])\n";
+            os_ << "                    ++n_;\n";
+            os_ << "                if (n_ == len_)\n";
+            os_ << "                {\n";
+            os_ << "                    id_ = keyword_ids_[i_];\n";
+            os_ << "                    uid_ = keyword_uids_[i_];\n";
+            os_ << "                }\n";
+            os_ << "            }\n";
+            os_ << "        }\n";
+            os_ << "    }\n\n";
+            return os_.good();
+        }
+
+        // the lengths of the keywords, or the values given, npos for the
+        // empty slots
+        static void generate_keyword_values(std::basic_ostream<Char>& os_
+          , std::vector<std::basic_string<Char> > const& keywords_
+          , std::vector<std::size_t> const& values_, bool lengths_)
+        {
+            for (std::size_t i_ = 0; i_ < keywords_.size(); ++i_)
+            {
+                os_ << ((i_ % 8) ? " " : "\n            ");
+                if (keywords_[i_].empty())
+                    os_ << "npos";
+                else if (lengths_)
+                    os_ << keywords_[i_].size();
+                else
+                    os_ << values_[i_];
+                os_ << ((i_ + 1 < keywords_.size()) ? "," : "");
+            }
+            os_ << " };\n";
+        }
+
+        std::vector<std::size_t> const& unique_ids_;
+        std::vector<keyword_table<Char> > const& keywords_;
+
+    private:
+        // silence MSVC warning C4512: assignment operator could not be generated
+        scanner_function_body& operator= (scanner_function_body const&);
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     // Generate a tokenizer for the given state machine.
     template <typename Char, typename F>
@@ -1020,6 +1893,36 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
           , &detail::generate_function_body_switch<typename Lexer::char_type>);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Generates a scanner with a switch statement per DFA state, looking up
+    // the keywords matched by a more general rule in a perfect hash instead
+    // of encoding them in the DFA.
+    template <typename Lexer>
+    inline bool
+    generate_static_scanner(Lexer const& lexer
+      , std::basic_ostream<typename Lexer::char_type>& os
+      , typename Lexer::char_type const* name_suffix)
+    {
+        typedef typename Lexer::char_type char_type;
+
+        boost::lexer::basic_state_machine<char_type> sm;
+        std::vector<std::size_t> unique_ids;
+        std::vector<detail::keyword_table<char_type> > keywords;
+        detail::build_scanner(lexer.rules_, sm, unique_ids, keywords);
+
+        return detail::generate_cpp(sm, lexer.rules_, os, name_suffix
+          , detail::scanner_function_body<char_type>(unique_ids, keywords));
+    }
+
+    template <typename Lexer>
+    inline bool
+    generate_static_scanner(Lexer const& lexer
+      , std::basic_ostream<typename Lexer::char_type>& os)
+    {
+        return generate_static_scanner(lexer, os
+          , detail::L<typename Lexer::char_type>().c_str());
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 }}}}
 
@@ -97,6 +97,11 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
       , std::basic_ostream<typename Lexer::char_type>&
       , typename Lexer::char_type const*, F);
 
+    template <typename Lexer>
+    bool generate_static_scanner(Lexer const&
+      , std::basic_ostream<typename Lexer::char_type>&
+      , typename Lexer::char_type const*);
+
     ///////////////////////////////////////////////////////////////////////////
     //
     //  Every lexer type to be used as a lexer for Spirit has to conform to
@@ -362,6 +367,10 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         friend bool generate_static(Lexer const&
           , std::basic_ostream<typename Lexer::char_type>&
           , typename Lexer::char_type const*, F);
+        template <typename Lexer>
+        friend bool generate_static_scanner(Lexer const&
+          , std::basic_ostream<typename Lexer::char_type>&
+          , typename Lexer::char_type const*);
     };
 
     ///////////////////////////////////////////////////////////////////////////
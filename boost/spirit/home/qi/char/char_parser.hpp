@@ -29,17 +29,6 @@ namespace boost { namespace spirit
       : mpl::true_ {};
 }}
 
-namespace boost { namespace spirit { namespace traits // classification
-{
-    namespace detail
-    {
-        BOOST_MPL_HAS_XXX_TRAIT_DEF(char_parser_id)
-    }
-
-    template <typename T>
-    struct is_char_parser : detail::has_char_parser_id<T> {};
-}}}
-
 namespace boost { namespace spirit { namespace qi
 {
     ///////////////////////////////////////////////////////////////////////////
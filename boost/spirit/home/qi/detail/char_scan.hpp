@@ -0,0 +1,434 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_QI_CHAR_SCAN_OCT_19_2013_0915AM)
+#define BOOST_SPIRIT_QI_CHAR_SCAN_OCT_19_2013_0915AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/spirit/home/support/char_class.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+#include <boost/spirit/home/support/char_encoding/ascii.hpp>
+#include <boost/spirit/home/support/char_encoding/iso8859_1.hpp>
+#include <boost/mpl/has_xxx.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/detail/iterator.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_SPIRIT_NO_SIMD)
+#if defined(__AVX2__)
+#define BOOST_SPIRIT_QI_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_SPIRIT_QI_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && (defined(BOOST_SPIRIT_QI_AVX2) || defined(BOOST_SPIRIT_QI_SSE2))
+#include <intrin.h>
+#endif
+#endif
+
+namespace boost { namespace spirit { namespace traits // classification
+{
+    namespace detail
+    {
+        BOOST_MPL_HAS_XXX_TRAIT_DEF(char_parser_id)
+    }
+
+    template <typename T>
+    struct is_char_parser : detail::has_char_parser_id<T> {};
+}}}
+
+namespace boost { namespace spirit { namespace qi
+{
+    template <typename Tag>
+    struct char_class;
+
+    template <typename CharEncoding, bool no_attribute, bool no_case>
+    struct literal_char;
+
+    template <typename Positive>
+    struct negated_char_parser;
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The ASCII characters of a char_class, as up to 3 inclusive
+        // ranges. Classes with no entry here (cntrl and punct) are tested
+        // one character at a time.
+        ///////////////////////////////////////////////////////////////////////
+        template <char Lo0, char Hi0, char Lo1 = 1, char Hi1 = 0
+          , char Lo2 = 1, char Hi2 = 0>             // 1 to 0 is empty
+        struct ascii_ranges : mpl::true_
+        {
+            enum { lo0 = Lo0, hi0 = Hi0, lo1 = Lo1, hi1 = Hi1, lo2 = Lo2, hi2 = Hi2 };
+        };
+
+        template <typename CharClass>
+        struct char_class_ranges : mpl::false_ {};
+
+        template <>
+        struct char_class_ranges<tag::space>
+          : ascii_ranges<' ', ' ', '\t', '\r'> {};
+
+        template <>
+        struct char_class_ranges<tag::blank>
+          : ascii_ranges<' ', ' ', '\t', '\t'> {};
+
+        template <>
+        struct char_class_ranges<tag::digit>
+          : ascii_ranges<'0', '9'> {};
+
+        template <>
+        struct char_class_ranges<tag::xdigit>
+          : ascii_ranges<'0', '9', 'a', 'f', 'A', 'F'> {};
+
+        template <>
+        struct char_class_ranges<tag::alpha>
+          : ascii_ranges<'a', 'z', 'A', 'Z'> {};
+
+        template <>
+        struct char_class_ranges<tag::alnum>
+          : ascii_ranges<'0', '9', 'a', 'z', 'A', 'Z'> {};
+
+        template <>
+        struct char_class_ranges<tag::lower>
+          : ascii_ranges<'a', 'z'> {};
+
+        template <>
+        struct char_class_ranges<tag::upper>
+          : ascii_ranges<'A', 'Z'> {};
+
+        template <>
+        struct char_class_ranges<tag::graph>
+          : ascii_ranges<'!', '~'> {};
+
+        template <>
+        struct char_class_ranges<tag::print>
+          : ascii_ranges<' ', '~'> {};
+
+        // The encodings which classify the ASCII characters as the C
+        // locale does. For standard, this assumes the current locale
+        // doesn't reclassify ASCII characters, which no known locale does.
+        template <typename CharEncoding>
+        struct ascii_compatible : mpl::false_ {};
+
+        template <>
+        struct ascii_compatible<char_encoding::standard> : mpl::true_ {};
+
+        template <>
+        struct ascii_compatible<char_encoding::ascii> : mpl::true_ {};
+
+        template <>
+        struct ascii_compatible<char_encoding::iso8859_1> : mpl::true_ {};
+
+#if defined(BOOST_SPIRIT_QI_AVX2) || defined(BOOST_SPIRIT_QI_SSE2)
+        inline int count_trailing_zeros(unsigned int mask)
+        {
+#if defined(__GNUC__)
+            return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<int>(index);
+#else
+            int n = 0;
+            for (; !(mask & 1); mask >>= 1)
+                ++n;
+            return n;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Skips the blocks of 16 (SSE2) or 32 (AVX2) characters of
+        // [first, last) which are all ASCII characters in the ranges r, and
+        // returns the position of the first character which is not, or
+        // the start of the last partial block. Non-ASCII characters are
+        // negative as signed chars, so they are never in the ranges.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Ranges>
+        inline char const* scan_ascii_ranges(char const* first, char const* last)
+        {
+#if defined(BOOST_SPIRIT_QI_AVX2)
+            __m256i const lo0 = _mm256_set1_epi8(Ranges::lo0 - 1);
+            __m256i const hi0 = _mm256_set1_epi8(Ranges::hi0 + 1);
+            __m256i const lo1 = _mm256_set1_epi8(Ranges::lo1 - 1);
+            __m256i const hi1 = _mm256_set1_epi8(Ranges::hi1 + 1);
+            __m256i const lo2 = _mm256_set1_epi8(Ranges::lo2 - 1);
+            __m256i const hi2 = _mm256_set1_epi8(Ranges::hi2 + 1);
+            while (last - first >= 32)
+            {
+                __m256i const x =
+                    _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first));
+                __m256i in = _mm256_and_si256(
+                    _mm256_cmpgt_epi8(x, lo0), _mm256_cmpgt_epi8(hi0, x));
+                in = _mm256_or_si256(in, _mm256_and_si256(
+                    _mm256_cmpgt_epi8(x, lo1), _mm256_cmpgt_epi8(hi1, x)));
+                in = _mm256_or_si256(in, _mm256_and_si256(
+                    _mm256_cmpgt_epi8(x, lo2), _mm256_cmpgt_epi8(hi2, x)));
+                unsigned int const mask =
+                    static_cast<unsigned int>(_mm256_movemask_epi8(in));
+                if (mask != 0xffffffffu)
+                    return first + count_trailing_zeros(~mask);
+                first += 32;
+            }
+#elif defined(BOOST_SPIRIT_QI_SSE2)
+            __m128i const lo0 = _mm_set1_epi8(Ranges::lo0 - 1);
+            __m128i const hi0 = _mm_set1_epi8(Ranges::hi0 + 1);
+            __m128i const lo1 = _mm_set1_epi8(Ranges::lo1 - 1);
+            __m128i const hi1 = _mm_set1_epi8(Ranges::hi1 + 1);
+            __m128i const lo2 = _mm_set1_epi8(Ranges::lo2 - 1);
+            __m128i const hi2 = _mm_set1_epi8(Ranges::hi2 + 1);
+            while (last - first >= 16)
+            {
+                __m128i const x =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+                __m128i in = _mm_and_si128(
+                    _mm_cmpgt_epi8(x, lo0), _mm_cmplt_epi8(x, hi0));
+                in = _mm_or_si128(in, _mm_and_si128(
+                    _mm_cmpgt_epi8(x, lo1), _mm_cmplt_epi8(x, hi1)));
+                in = _mm_or_si128(in, _mm_and_si128(
+                    _mm_cmpgt_epi8(x, lo2), _mm_cmplt_epi8(x, hi2)));
+                unsigned int const mask =
+                    static_cast<unsigned int>(_mm_movemask_epi8(in));
+                if (mask != 0xffffu)
+                    return first + count_trailing_zeros(~mask);
+                first += 16;
+            }
+#endif
+            return first;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // scan_chars(p, first, last, context) returns the end of the run of
+        // characters matched by the char parser p, starting at first: the
+        // same as parsing *p with no skipper, without the bookkeeping of a
+        // kleene. For contiguous char input, the ASCII characters of char
+        // classes are tested several at a time, and ~char_(ch) looks for
+        // the next ch. BOOST_SPIRIT_NO_SIMD tests all runs one character
+        // at a time.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Parser, typename Char, typename Context>
+        inline Char const* scan_char_ptr(Parser const& p
+          , Char const* first, Char const* last, Context& context)
+        {
+            while (first != last && p.test(*first, context))
+                ++first;
+            return first;
+        }
+
+        // Short runs, such as the whitespace between tokens, are the
+        // most common: test the first few characters one at a time before
+        // setting up a vectorized scan.
+        template <typename Parser, typename Context>
+        inline bool scan_short_run(Parser const& p
+          , char const*& first, char const* last, Context& context)
+        {
+            for (int n = 16; first != last && p.test(*first, context); )
+            {
+                ++first;
+                if (--n == 0)
+                    return first == last;
+            }
+            return true;
+        }
+
+#if defined(BOOST_SPIRIT_QI_AVX2) || defined(BOOST_SPIRIT_QI_SSE2)
+        template <typename Ranges, typename Parser, typename Context>
+        char const* scan_long_run(Parser const& p
+          , char const* first, char const* last, Context& context)
+        {
+            // the parser decides about the characters the blocks leave:
+            // non-ASCII characters and the last partial block
+            do
+                first = scan_ascii_ranges<Ranges>(first, last);
+            while (!scan_short_run(p, first, last, context));
+            return first;
+        }
+
+        template <typename Tag, typename Context>
+        inline char const* scan_char_class_ptr(char_class<Tag> const& p
+          , char const* first, char const* last, Context& context, mpl::true_)
+        {
+            if (scan_short_run(p, first, last, context))
+                return first;
+            return scan_long_run<char_class_ranges<typename Tag::char_class> >(
+                p, first, last, context);
+        }
+
+        template <typename Tag, typename Context>
+        inline char const* scan_char_class_ptr(char_class<Tag> const& p
+          , char const* first, char const* last, Context& context, mpl::false_)
+        {
+            return scan_char_ptr(p, first, last, context);
+        }
+
+        template <typename Tag, typename Context>
+        inline char const* scan_char_ptr(char_class<Tag> const& p
+          , char const* first, char const* last, Context& context)
+        {
+            return scan_char_class_ptr(p, first, last, context
+              , mpl::and_<
+                    ascii_compatible<typename Tag::char_encoding>
+                  , char_class_ranges<typename Tag::char_class>
+                >());
+        }
+#endif
+
+#if !defined(BOOST_SPIRIT_NO_SIMD)
+        // ~char_(ch), as in strings: find the next ch with memchr, which
+        // the C library vectorizes
+        template <typename Positive, typename Context>
+        inline char const* scan_not_char_ptr(
+            negated_char_parser<Positive> const& p
+          , char const* first, char const* last, Context& context, mpl::true_)
+        {
+            if (scan_short_run(p, first, last, context))
+                return first;
+            for (;;)
+            {
+                void const* found = std::memchr(first
+                  , static_cast<unsigned char>(p.positive.ch), last - first);
+                if (!found)
+                    return last;
+                first = static_cast<char const*>(found);
+                if (!p.test(*first, context))
+                    return first;
+                ++first;
+            }
+        }
+
+        template <typename Positive, typename Context>
+        inline char const* scan_not_char_ptr(
+            negated_char_parser<Positive> const& p
+          , char const* first, char const* last, Context& context, mpl::false_)
+        {
+            return scan_char_ptr(p, first, last, context);
+        }
+
+        template <typename CharEncoding, bool no_attribute, typename Context>
+        inline char const* scan_char_ptr(
+            negated_char_parser<literal_char<CharEncoding, no_attribute, false> > const& p
+          , char const* first, char const* last, Context& context)
+        {
+            return scan_not_char_ptr(p, first, last, context
+              , ascii_compatible<CharEncoding>());
+        }
+#endif
+
+        // Iterators known to walk through contiguous chars
+        template <typename Iterator>
+        struct is_contiguous_char_iterator
+          : mpl::or_<
+                is_same<Iterator, char*>
+              , is_same<Iterator, char const*>
+              , is_same<Iterator, std::string::iterator>
+              , is_same<Iterator, std::string::const_iterator>
+              , mpl::or_<
+                    is_same<Iterator, std::vector<char>::iterator>
+                  , is_same<Iterator, std::vector<char>::const_iterator>
+                >
+            >
+        {};
+
+        template <typename Parser, typename Iterator, typename Context>
+        inline Iterator scan_chars(Parser const& p
+          , Iterator first, Iterator const& last, Context& context, mpl::false_)
+        {
+            while (first != last && p.test(*first, context))
+                ++first;
+            return first;
+        }
+
+        template <typename Parser, typename Iterator, typename Context>
+        inline Iterator scan_chars(Parser const& p
+          , Iterator first, Iterator const& last, Context& context, mpl::true_)
+        {
+            if (first == last)
+                return first;
+            char const* begin = &*first;
+            char const* end = scan_char_ptr(p, begin, begin + (last - first)
+              , context);
+            return first + (end - begin);
+        }
+
+        template <typename Parser, typename Iterator, typename Context>
+        inline Iterator scan_chars(Parser const& p
+          , Iterator const& first, Iterator const& last, Context& context)
+        {
+            return scan_chars(p, first, last, context
+              , is_contiguous_char_iterator<Iterator>());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A kleene or plus of a char parser can use scan_chars when there
+        // is no skipper (as inside lexeme[]), and the attribute is unused
+        // or a string or vector of the input characters.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Attribute, typename Char>
+        struct is_char_run_attribute : mpl::false_ {};
+
+        template <typename Char>
+        struct is_char_run_attribute<unused_type, Char> : mpl::true_ {};
+
+        template <typename Char>
+        struct is_char_run_attribute<unused_type const, Char> : mpl::true_ {};
+
+        template <typename Char, typename Traits, typename Alloc>
+        struct is_char_run_attribute<std::basic_string<Char, Traits, Alloc>, Char>
+          : mpl::true_ {};
+
+        template <typename Char, typename Alloc>
+        struct is_char_run_attribute<std::vector<Char, Alloc>, Char>
+          : mpl::true_ {};
+
+        template <typename Subject, typename Iterator, typename Skipper
+          , typename Attribute>
+        struct use_char_scan
+          : mpl::and_<
+                traits::is_char_parser<Subject>
+              , is_base_of<unused_type, Skipper>
+              , is_char_run_attribute<
+                    typename remove_const<Attribute>::type
+                  , typename boost::detail::iterator_traits<Iterator>::value_type
+                >
+            >
+        {};
+
+        template <typename Iterator>
+        inline void append_char_run(unused_type const&
+          , Iterator const&, Iterator const&)
+        {
+        }
+
+        template <typename Char, typename Traits, typename Alloc
+          , typename Iterator>
+        inline void append_char_run(std::basic_string<Char, Traits, Alloc>& attr
+          , Iterator const& first, Iterator const& last)
+        {
+            attr.append(first, last);
+        }
+
+        template <typename Char, typename Alloc, typename Iterator>
+        inline void append_char_run(std::vector<Char, Alloc>& attr
+          , Iterator const& first, Iterator const& last)
+        {
+            attr.insert(attr.end(), first, last);
+        }
+    }
+}}}
+
+#endif
@@ -17,6 +17,7 @@
 #include <boost/spirit/home/qi/directive/lexeme.hpp>
 #include <boost/spirit/home/qi/directive/no_skip.hpp>
 #include <boost/spirit/home/qi/directive/matches.hpp>
+#include <boost/spirit/home/qi/directive/memoize.hpp>
 #include <boost/spirit/home/qi/directive/no_case.hpp>
 #include <boost/spirit/home/qi/directive/omit.hpp>
 #include <boost/spirit/home/qi/directive/raw.hpp>
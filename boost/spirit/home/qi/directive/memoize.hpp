@@ -0,0 +1,415 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_MEMOIZE_OCTOBER_19_2026_0915AM)
+#define SPIRIT_MEMOIZE_OCTOBER_19_2026_0915AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/meta_compiler.hpp>
+#include <boost/spirit/home/qi/parser.hpp>
+#include <boost/spirit/home/qi/reference.hpp>
+#include <boost/spirit/home/support/attributes.hpp>
+#include <boost/spirit/home/support/container.hpp>
+#include <boost/spirit/home/support/info.hpp>
+#include <boost/spirit/home/support/common_terminals.hpp>
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/spirit/home/support/has_semantic_action.hpp>
+#include <boost/spirit/home/support/handles_container.hpp>
+#include <boost/fusion/include/at.hpp>
+#include <boost/fusion/include/vector.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/mpl/bool.hpp>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+#include <ostream>
+
+namespace boost { namespace spirit { namespace qi
+{
+    template <typename Iterator>
+    class memo_table;
+}}}
+
+namespace boost { namespace spirit
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Enablers
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct use_directive<qi::domain
+      , terminal_ex<tag::memoize                    // enables memoize(table)[p]
+        , fusion::vector1<qi::memo_table<Iterator> > >
+    > : mpl::true_ {};
+}}
+
+namespace boost { namespace spirit { namespace qi
+{
+#ifndef BOOST_SPIRIT_NO_PREDEFINED_TERMINALS
+    using spirit::memoize;
+#endif
+    using spirit::memoize_type;
+
+    namespace detail
+    {
+        // the attributes stored in a memo_table
+        struct memo_value
+        {
+            virtual ~memo_value() {}
+        };
+
+        template <typename T>
+        struct memo_value_holder : memo_value
+        {
+            explicit memo_value_holder(T const& value_)
+              : value(value_) {}
+
+            T value;
+        };
+
+        // a distinct address for each attribute type, the results of a
+        // parser are kept separately for each attribute type it is invoked
+        // with
+        template <typename T>
+        struct memo_type_id
+        {
+            static char const id;
+        };
+
+        template <typename T>
+        char const memo_type_id<T>::id = 0;
+
+        // a rule referenced by several memoize(table)[r] shares its results
+        template <typename Subject>
+        void const* memo_key(Subject const&, void const* directive)
+        {
+            return directive;
+        }
+
+        template <typename Subject>
+        void const* memo_key(reference<Subject> const& subject, void const*)
+        {
+            return &subject.ref.get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of times a parser wrapped into memoize(table)[] was invoked
+    // and how many of those invocations were at an input position where it
+    // was invoked before.
+    ///////////////////////////////////////////////////////////////////////////
+    struct memo_statistics
+    {
+        memo_statistics()
+          : calls(0), reparses(0) {}
+
+        std::string name;
+        std::size_t calls;
+        std::size_t reparses;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The results of the parsers wrapped into memoize(table)[] for a single
+    // parse, keyed by the parser and the input position. Copies of a
+    // memo_table share the same results. Call clear() before parsing
+    // another input.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    class memo_table
+    {
+    public:
+        typedef Iterator iterator_type;
+
+        // the outcome of a parser at an input position
+        struct result
+        {
+            bool ok;
+            Iterator end;
+            shared_ptr<detail::memo_value const> value;
+        };
+
+        struct parser_entry
+        {
+            memo_statistics statistics;
+            std::map<Iterator, result> results;
+        };
+
+    private:
+        typedef std::pair<void const*, void const*> key_type;
+
+        struct impl : noncopyable
+        {
+            explicit impl(bool cache_)
+              : cache(cache_) {}
+
+            bool cache;
+            std::map<key_type, parser_entry*> parsers;
+            std::list<parser_entry> entries;    // in order of first use
+        };
+
+        typedef typename std::list<parser_entry>::const_iterator
+            entry_iterator;
+
+    public:
+        // With cache set to false the parsers are invoked again at every
+        // position, only the statistics are recorded. This helps finding
+        // the rules worth to be memoized.
+        explicit memo_table(bool cache = true)
+          : p(new impl(cache)) {}
+
+        bool caching() const { return p->cache; }
+
+        // forget the results and the statistics
+        void clear()
+        {
+            p->parsers.clear();
+            p->entries.clear();
+        }
+
+        // the number of results stored for all parsers
+        std::size_t size() const
+        {
+            std::size_t n = 0;
+            for (entry_iterator it = p->entries.begin();
+                 it != p->entries.end(); ++it)
+            {
+                n += it->results.size();
+            }
+            return n;
+        }
+
+        std::vector<memo_statistics> statistics() const
+        {
+            std::vector<memo_statistics> result_;
+            for (entry_iterator it = p->entries.begin();
+                 it != p->entries.end(); ++it)
+            {
+                result_.push_back(it->statistics);
+            }
+            return result_;
+        }
+
+        template <typename Out>
+        void report(Out& out) const
+        {
+            for (entry_iterator it = p->entries.begin();
+                 it != p->entries.end(); ++it)
+            {
+                out << it->statistics.name << ": "
+                    << it->statistics.calls << " calls, "
+                    << it->statistics.reparses << " re-parses" << std::endl;
+            }
+        }
+
+        // the interface used by memoize_directive
+        parser_entry* find(void const* parser, void const* type) const
+        {
+            typename std::map<key_type, parser_entry*>::const_iterator it =
+                p->parsers.find(key_type(parser, type));
+            return it != p->parsers.end() ? it->second : 0;
+        }
+
+        parser_entry* insert(void const* parser, void const* type
+          , std::string const& name) const
+        {
+            p->entries.push_back(parser_entry());
+            parser_entry* entry_ = &p->entries.back();
+            entry_->statistics.name = name;
+            p->parsers[key_type(parser, type)] = entry_;
+            return entry_;
+        }
+
+        static result const* lookup(parser_entry& entry_, Iterator const& pos)
+        {
+            ++entry_.statistics.calls;
+            typename std::map<Iterator, result>::const_iterator it =
+                entry_.results.find(pos);
+            if (it == entry_.results.end())
+                return 0;
+            ++entry_.statistics.reparses;
+            return &it->second;
+        }
+
+        static void store(parser_entry& entry_, Iterator const& pos
+          , result const& r)
+        {
+            entry_.results.insert(std::make_pair(pos, r));
+        }
+
+    private:
+        shared_ptr<impl> p;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // memoize(table)[p] stores the outcome of p (whether it succeeded, where
+    // it stopped and its attribute) for each input position it is invoked
+    // at. Invoked again at the same position, it returns the stored outcome
+    // without parsing. Wrapping the rules of a backtracking grammar makes
+    // it a packrat parser, parsing in time linear to the input. All
+    // memoize(table)[r] referencing the same rule share its outcomes.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Iterator>
+    struct memoize_directive
+      : unary_parser<memoize_directive<Subject, Iterator> >
+    {
+        typedef Subject subject_type;
+        typedef memo_table<Iterator> table_type;
+
+        memoize_directive(Subject const& subject_, table_type const& table_)
+          : subject(subject_), table(table_) {}
+
+        template <typename Context, typename Iterator_>
+        struct attribute
+        {
+            typedef typename
+                traits::attribute_of<subject_type, Context, Iterator_>::type
+            type;
+        };
+
+        template <typename Context, typename Skipper, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper, Attribute& attr_) const
+        {
+            typedef typename remove_const<Attribute>::type value_type;
+
+            void const* key = detail::memo_key(subject, this);
+            void const* type = &detail::memo_type_id<value_type>::id;
+            typename table_type::parser_entry* entry = table.find(key, type);
+            if (!entry)
+                entry = table.insert(key, type, subject.what(context).tag);
+
+            typename table_type::result const* r =
+                table_type::lookup(*entry, first);
+            if (r == 0 || !table.caching())
+            {
+                Iterator const start = first;
+                typename table_type::result r_;
+                r_.ok = parse_subject(first, last, context, skipper, attr_
+                  , typename traits::not_is_unused<value_type>::type()
+                  , r_.value);
+                r_.end = first;
+                if (r == 0)
+                    table_type::store(*entry, start, r_);
+                return r_.ok;
+            }
+
+            if (!r->ok)
+                return false;
+
+            first = r->end;
+            if (r->value)
+            {
+                value_type value(static_cast<
+                    detail::memo_value_holder<value_type> const&>(
+                        *r->value).value);
+                commit(value, attr_, traits::is_container<value_type>());
+            }
+            return true;
+        }
+
+        template <typename Context>
+        info what(Context& context) const
+        {
+            return info("memoize", subject.what(context));
+        }
+
+        Subject subject;
+        table_type table;
+
+    private:
+        template <typename Context, typename Skipper, typename Attribute
+          , typename Value>
+        bool parse_subject(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper, Attribute& attr_
+          , mpl::false_, Value&) const
+        {
+            return subject.parse(first, last, context, skipper, attr_);
+        }
+
+        // the attribute is parsed into a new instance, as the stored
+        // attribute has to be independent of the attribute passed in
+        template <typename Context, typename Skipper, typename Attribute
+          , typename Value>
+        bool parse_subject(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper, Attribute& attr_
+          , mpl::true_, Value& stored) const
+        {
+            typedef typename remove_const<Attribute>::type value_type;
+
+            value_type value = value_type();
+            if (!subject.parse(first, last, context, skipper, value))
+                return false;
+
+            if (table.caching())
+                stored.reset(new detail::memo_value_holder<value_type>(value));
+            commit(value, attr_, traits::is_container<value_type>());
+            return true;
+        }
+
+        // containers are appended to the attribute, as the subject would do
+        template <typename Value, typename Attribute>
+        static void commit(Value& value, Attribute& attr_, mpl::true_)
+        {
+            typedef typename traits::container_iterator<Value const>::type
+                iterator_type;
+
+            Value const& v = value;
+            iterator_type end = traits::end(v);
+            for (iterator_type it = traits::begin(v);
+                 !traits::compare(it, end); traits::next(it))
+            {
+                traits::push_back(attr_, traits::deref(it));
+            }
+        }
+
+        template <typename Value, typename Attribute>
+        static void commit(Value& value, Attribute& attr_, mpl::false_)
+        {
+            traits::swap_impl(value, attr_);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parser generators: make_xxx function (objects)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Subject, typename Modifiers>
+    struct make_directive<
+        terminal_ex<tag::memoize, fusion::vector1<memo_table<Iterator> > >
+      , Subject, Modifiers>
+    {
+        typedef memoize_directive<Subject, Iterator> result_type;
+
+        template <typename Terminal>
+        result_type operator()(Terminal const& term, Subject const& subject
+          , unused_type) const
+        {
+            return result_type(subject, fusion::at_c<0>(term.args));
+        }
+    };
+}}}
+
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Iterator>
+    struct has_semantic_action<qi::memoize_directive<Subject, Iterator> >
+      : unary_has_semantic_action<Subject> {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Iterator, typename Attribute
+        , typename Context, typename Iterator_>
+    struct handles_container<qi::memoize_directive<Subject, Iterator>
+        , Attribute, Context, Iterator_>
+      : unary_handles_container<Subject, Attribute, Context, Iterator_> {};
+}}}
+
+#endif
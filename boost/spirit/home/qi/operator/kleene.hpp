@@ -18,6 +18,7 @@
 #include <boost/spirit/home/qi/detail/attributes.hpp>
 #include <boost/spirit/home/qi/detail/fail_function.hpp>
 #include <boost/spirit/home/qi/detail/pass_container.hpp>
+#include <boost/spirit/home/qi/detail/char_scan.hpp>
 #include <boost/spirit/home/support/has_semantic_action.hpp>
 #include <boost/spirit/home/support/handles_container.hpp>
 #include <boost/spirit/home/support/info.hpp>
@@ -69,9 +70,9 @@ namespace boost { namespace spirit { namespace qi
 
         template <typename Iterator, typename Context
           , typename Skipper, typename Attribute>
-        bool parse(Iterator& first, Iterator const& last
+        bool parse_impl(Iterator& first, Iterator const& last
           , Context& context, Skipper const& skipper
-          , Attribute& attr_) const
+          , Attribute& attr_, mpl::false_) const
         {
             // ensure the attribute is actually a container type
             traits::make_container(attr_);
@@ -87,6 +88,29 @@ namespace boost { namespace spirit { namespace qi
             return true;
         }
 
+        // a run of a char parser with no skipper is scanned at once
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse_impl(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& /*skipper*/
+          , Attribute& attr_, mpl::true_) const
+        {
+            Iterator iter = detail::scan_chars(subject, first, last, context);
+            detail::append_char_run(attr_, first, iter);
+            first = iter;
+            return true;
+        }
+
+        template <typename Iterator, typename Context
+          , typename Skipper, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context& context, Skipper const& skipper
+          , Attribute& attr_) const
+        {
+            return parse_impl(first, last, context, skipper, attr_
+              , detail::use_char_scan<Subject, Iterator, Skipper, Attribute>());
+        }
+
         template <typename Context>
         info what(Context& context) const
         {
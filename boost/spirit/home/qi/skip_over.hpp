@@ -13,6 +13,8 @@
 
 #include <boost/spirit/home/support/unused.hpp>
 #include <boost/spirit/home/qi/detail/unused_skipper.hpp>
+#include <boost/spirit/home/qi/detail/char_scan.hpp>
+#include <boost/mpl/bool.hpp>
 
 namespace boost { namespace spirit { namespace qi
 {
@@ -21,11 +23,31 @@ namespace boost { namespace spirit { namespace qi
     // given a skip-parser. The function is a no-op if unused_type is
     // passed as the skip-parser.
     ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Iterator, typename T>
+        inline void skip_over(Iterator& first, Iterator const& last
+          , T const& skipper, mpl::false_)
+        {
+            while (first != last && skipper.parse(first, last, unused, unused, unused))
+                /***/;
+        }
+
+        // A char parser skipper (space, blank, etc.) skips a whole run
+        // of characters at once.
+        template <typename Iterator, typename T>
+        inline void skip_over(Iterator& first, Iterator const& last
+          , T const& skipper, mpl::true_)
+        {
+            first = detail::scan_chars(skipper, first, last, unused);
+        }
+    }
+
     template <typename Iterator, typename T>
     inline void skip_over(Iterator& first, Iterator const& last, T const& skipper)
     {
-        while (first != last && skipper.parse(first, last, unused, unused, unused))
-            /***/;
+        detail::skip_over(first, last, skipper
+          , mpl::bool_<traits::is_char_parser<T>::value>());
     }
 
     template <typename Iterator>
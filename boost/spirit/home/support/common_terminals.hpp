@@ -123,6 +123,7 @@ namespace boost { namespace spirit
         ( big_bin_double, big_bin_double_type )
         ( little_bin_double, little_bin_double_type )
         ( skip, skip_type )
+        ( memoize, memoize_type )
         ( delimit, delimit_type )
         ( stream, stream_type )
         ( wstream, wstream_type )
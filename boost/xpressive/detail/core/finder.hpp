@@ -18,6 +18,7 @@
 #include <boost/xpressive/detail/core/regex_impl.hpp>
 #include <boost/xpressive/detail/utility/boyer_moore.hpp>
 #include <boost/xpressive/detail/utility/hash_peek_bitset.hpp>
+#include <boost/xpressive/detail/utility/peek_chars.hpp>
 
 namespace boost { namespace xpressive { namespace detail
 {
@@ -93,6 +94,32 @@ private:
     hash_peek_bitset<char_type> bset_;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// peek_chars_finder
+//   for contiguous char iterators, when at most three characters can start
+//   a match
+template<typename BidiIter, typename Traits>
+struct peek_chars_finder
+  : finder<BidiIter>
+{
+    peek_chars_finder(peek_chars const &chars)
+      : chars_(chars)
+    {
+    }
+
+    bool operator ()(match_state<BidiIter> &state) const
+    {
+        state.cur_ = this->chars_.find(state.cur_, state.end_);
+        return state.cur_ != state.end_;
+    }
+
+private:
+    peek_chars_finder(peek_chars_finder const &);
+    peek_chars_finder &operator =(peek_chars_finder const &);
+
+    peek_chars chars_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // line_start_finder
 //
@@ -158,6 +185,7 @@ struct line_start_finder<BidiIter, Traits, 1u>
         {
             this->bits_[j] = tr.isctype(static_cast<char_type>(static_cast<unsigned char>(j)), newline);
         }
+        this->newlines_.assign(this->bits_);
     }
 
     bool operator ()(match_state<BidiIter> &state) const
@@ -171,13 +199,11 @@ struct line_start_finder<BidiIter, Traits, 1u>
         BidiIter const end = state.end_;
         std::advance(cur, static_cast<diff_type>(-!state.bos()));
 
-        for(; cur != end; ++cur)
+        cur = this->find_(cur, end, is_contiguous_char_iterator<BidiIter>());
+        if(cur != end)
         {
-            if(this->bits_[static_cast<unsigned char>(*cur)])
-            {
-                state.cur_ = ++cur;
-                return true;
-            }
+            state.cur_ = ++cur;
+            return true;
         }
 
         return false;
@@ -187,7 +213,22 @@ private:
     line_start_finder(line_start_finder const &);
     line_start_finder &operator =(line_start_finder const &);
 
+    BidiIter find_(BidiIter cur, BidiIter end, mpl::false_) const
+    {
+        for(; cur != end && !this->bits_[static_cast<unsigned char>(*cur)]; ++cur)
+            ;
+        return cur;
+    }
+
+    BidiIter find_(BidiIter cur, BidiIter end, mpl::true_) const
+    {
+        return 0 != this->newlines_.size()
+            ? this->newlines_.find(cur, end)
+            : this->find_(cur, end, mpl::false_());
+    }
+
     bool bits_[256];
+    peek_chars newlines_;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -197,19 +238,38 @@ template<typename BidiIter>
 struct leading_simple_repeat_finder
   : finder<BidiIter>
 {
-    leading_simple_repeat_finder()
+    // chars is not empty if the repeat matches at least once and only a
+    // few characters can start it
+    leading_simple_repeat_finder(peek_chars const &chars)
       : finder<BidiIter>()
+      , chars_(chars)
     {}
 
     bool operator ()(match_state<BidiIter> &state) const
     {
         state.cur_ = state.next_search_;
+        if(0 != this->chars_.size())
+        {
+            state.cur_ = this->find_(state.cur_, state.end_, is_contiguous_char_iterator<BidiIter>());
+        }
         return true;
     }
 
 private:
     leading_simple_repeat_finder(leading_simple_repeat_finder const &);
     leading_simple_repeat_finder &operator =(leading_simple_repeat_finder const &);
+
+    BidiIter find_(BidiIter cur, BidiIter, mpl::false_) const
+    {
+        return cur;
+    }
+
+    BidiIter find_(BidiIter cur, BidiIter end, mpl::true_) const
+    {
+        return this->chars_.find(cur, end);
+    }
+
+    peek_chars chars_;
 };
 
 }}}
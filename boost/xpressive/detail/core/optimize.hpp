@@ -21,6 +21,37 @@
 namespace boost { namespace xpressive { namespace detail
 {
 
+///////////////////////////////////////////////////////////////////////////////
+// get_peek_chars
+//   the characters that can start a match, if there are at most three of
+//   them and the input can be searched for them with memchr
+template<typename Char, typename Traits>
+bool get_peek_chars(peek_chars &, hash_peek_bitset<Char> const &, Traits const &, mpl::false_)
+{
+    return false;
+}
+
+template<typename Char, typename Traits>
+bool get_peek_chars(peek_chars &chars, hash_peek_bitset<Char> const &bset, Traits const &tr, mpl::true_)
+{
+    return 256 != bset.count() && chars.assign(bset, tr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// new_peek_chars_finder
+//
+template<typename BidiIter, typename Traits>
+finder<BidiIter> *new_peek_chars_finder(peek_chars const &, mpl::false_)
+{
+    return 0;
+}
+
+template<typename BidiIter, typename Traits>
+finder<BidiIter> *new_peek_chars_finder(peek_chars const &chars, mpl::true_)
+{
+    return new peek_chars_finder<BidiIter, Traits>(chars);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // optimize_regex
 //
@@ -32,6 +63,10 @@ intrusive_ptr<finder<BidiIter> > optimize_regex
   , mpl::false_
 )
 {
+    typedef is_contiguous_char_iterator<BidiIter> is_contiguous;
+    peek_chars chars;
+    bool const few_chars = get_peek_chars(chars, peeker.bitset(), tr, is_contiguous());
+
     if(peeker.line_start())
     {
         return intrusive_ptr<finder<BidiIter> >
@@ -43,7 +78,14 @@ intrusive_ptr<finder<BidiIter> > optimize_regex
     {
         return intrusive_ptr<finder<BidiIter> >
         (
-            new leading_simple_repeat_finder<BidiIter>()
+            new leading_simple_repeat_finder<BidiIter>(chars)
+        );
+    }
+    else if(few_chars)
+    {
+        return intrusive_ptr<finder<BidiIter> >
+        (
+            new_peek_chars_finder<BidiIter, Traits>(chars, is_contiguous())
         );
     }
     else if(256 != peeker.bitset().count())
@@ -13,6 +13,7 @@
 # pragma once
 #endif
 
+#include <climits>  // for UCHAR_MAX
 #include <string>
 #include <typeinfo>
 #include <boost/assert.hpp>
@@ -24,6 +25,7 @@
 #include <boost/xpressive/detail/detail_fwd.hpp>
 #include <boost/xpressive/detail/core/matchers.hpp>
 #include <boost/xpressive/detail/utility/hash_peek_bitset.hpp>
+#include <boost/xpressive/detail/utility/chset/chset.hpp>
 #include <boost/xpressive/detail/utility/never_true.hpp>
 #include <boost/xpressive/detail/utility/algorithm.hpp>
 
@@ -218,6 +220,39 @@ struct xpression_peeker
         return mpl::false_();
     }
 
+    template<typename ICase, typename Traits>
+    typename enable_if<is_narrow_char<typename Traits::char_type>, mpl::false_>::type
+    accept(charset_matcher<Traits, ICase, compound_charset<Traits> > const &xpr)
+    {
+        Traits const &tr = this->get_traits_<Traits>();
+        for(std::size_t i = 0; i <= UCHAR_MAX; ++i)
+        {
+            Char const ch = std::char_traits<Char>::to_char_type(static_cast<typename std::char_traits<Char>::int_type>(i));
+            if(xpr.charset_.test(ch, tr, ICase()))
+            {
+                this->bset_.set_char(ch, ICase(), tr);
+            }
+        }
+        return mpl::false_();
+    }
+
+    template<typename Traits, typename Size>
+    mpl::false_ accept(set_matcher<Traits, Size> const &xpr)
+    {
+        if(xpr.not_)
+        {
+            this->fail();
+        }
+        else
+        {
+            for(int i = 0; i < Size::value; ++i)
+            {
+                this->bset_.set_char(xpr.set_[i], xpr.icase_, this->get_traits_<Traits>());
+            }
+        }
+        return mpl::false_();
+    }
+
     template<typename Traits, typename ICase>
     mpl::false_ accept(range_matcher<Traits, ICase> const &xpr)
     {
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file peek_chars.hpp
+///   Contains peek_chars, a set of up to three characters that is searched
+///   for with memchr, or with SSE2 when there are two or three of them.
+//
+//  Copyright 2008 Eric Niebler. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_XPRESSIVE_DETAIL_UTILITY_PEEK_CHARS_HPP_EAN_10_19_2026
+#define BOOST_XPRESSIVE_DETAIL_UTILITY_PEEK_CHARS_HPP_EAN_10_19_2026
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <climits>  // for UCHAR_MAX
+#include <cstddef>  // for std::size_t
+#include <cstring>  // for std::memchr
+#include <string>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/xpressive/detail/utility/hash_peek_bitset.hpp>
+
+// Define BOOST_XPRESSIVE_NO_SIMD to search for two or three characters
+// one character at a time.
+#ifndef BOOST_XPRESSIVE_NO_SIMD
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define BOOST_XPR_SSE2_
+#  include <emmintrin.h>
+#  if defined(_MSC_VER)
+#   include <intrin.h>
+#  endif
+# endif
+#endif
+
+namespace boost { namespace xpressive { namespace detail
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// is_contiguous_char_iterator
+//   iterators into a contiguous array of char, which can be searched as a
+//   char const *
+template<typename BidiIter>
+struct is_contiguous_char_iterator
+  : mpl::or_
+    <
+        is_same<BidiIter, char *>
+      , is_same<BidiIter, char const *>
+      , is_same<BidiIter, std::string::iterator>
+      , is_same<BidiIter, std::string::const_iterator>
+      , mpl::or_
+        <
+            is_same<BidiIter, std::vector<char>::iterator>
+          , is_same<BidiIter, std::vector<char>::const_iterator>
+        >
+    >
+{
+};
+
+#ifdef BOOST_XPR_SSE2_
+///////////////////////////////////////////////////////////////////////////////
+// count_trailing_zeros
+//   the index of the lowest bit set, mask must not be 0
+inline int count_trailing_zeros(unsigned int mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    for(; 0 == (mask & 1u); mask >>= 1)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// peek_chars
+//
+struct peek_chars
+{
+    peek_chars()
+      : size_(0)
+    {
+    }
+
+    std::size_t size() const
+    {
+        return this->size_;
+    }
+
+    // the characters accepted by the bitset, if there are at most three of
+    // them. Otherwise the set is left empty and false is returned.
+    template<typename Traits>
+    bool assign(hash_peek_bitset<char> const &bset, Traits const &tr)
+    {
+        this->size_ = 0;
+        for(int i = 0; i <= UCHAR_MAX; ++i)
+        {
+            char const ch = static_cast<char>(static_cast<unsigned char>(i));
+            if(bset.test(ch, tr))
+            {
+                if(3 == this->size_)
+                {
+                    this->size_ = 0;
+                    return false;
+                }
+                this->chars_[this->size_++] = ch;
+            }
+        }
+        return 0 != this->size_;
+    }
+
+    void assign(bool const (&bits)[UCHAR_MAX + 1])
+    {
+        this->size_ = 0;
+        for(int i = 0; i <= UCHAR_MAX; ++i)
+        {
+            if(bits[i])
+            {
+                if(3 == this->size_)
+                {
+                    this->size_ = 0;
+                    return;
+                }
+                this->chars_[this->size_++] = static_cast<char>(static_cast<unsigned char>(i));
+            }
+        }
+    }
+
+    // the first of the characters in [begin, end), or end
+    template<typename BidiIter>
+    BidiIter find(BidiIter begin, BidiIter end) const
+    {
+        if(begin == end)
+        {
+            return end;
+        }
+
+        char const *const first = &*begin;
+        return begin + (this->find(first, first + (end - begin)) - first);
+    }
+
+    char const *find(char const *begin, char const *end) const
+    {
+        BOOST_ASSERT(0 != this->size_);
+        if(1 == this->size_)
+        {
+            void const *found = std::memchr(begin, this->chars_[0], static_cast<std::size_t>(end - begin));
+            return found ? static_cast<char const *>(found) : end;
+        }
+
+        // with two characters, the last one is compared twice
+        char const a = this->chars_[0];
+        char const b = this->chars_[1];
+        char const c = this->chars_[this->size_ - 1];
+
+#ifdef BOOST_XPR_SSE2_
+        __m128i const va = _mm_set1_epi8(a);
+        __m128i const vb = _mm_set1_epi8(b);
+        __m128i const vc = _mm_set1_epi8(c);
+        for(; 16 <= end - begin; begin += 16)
+        {
+            __m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const *>(begin));
+            __m128i const eq = _mm_or_si128
+            (
+                _mm_or_si128(_mm_cmpeq_epi8(block, va), _mm_cmpeq_epi8(block, vb))
+              , _mm_cmpeq_epi8(block, vc)
+            );
+            unsigned int const mask = static_cast<unsigned int>(_mm_movemask_epi8(eq));
+            if(0 != mask)
+            {
+                return begin + count_trailing_zeros(mask);
+            }
+        }
+#endif
+
+        for(; begin != end; ++begin)
+        {
+            if(a == *begin || b == *begin || c == *begin)
+            {
+                break;
+            }
+        }
+        return begin;
+    }
+
+private:
+    std::size_t size_;
+    char chars_[3];
+};
+
+}}} // namespace boost::xpressive::detail
+
+#endif
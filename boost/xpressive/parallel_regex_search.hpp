@@ -0,0 +1,419 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file parallel_regex_search.hpp
+/// Contains the parallel_regex_search() algorithm, which searches a large
+/// sequence in line-aligned chunks on several threads. This file is not
+/// included by xpressive.hpp, as it requires linking with Boost.Thread.
+//
+//  Copyright 2008 Eric Niebler. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_XPRESSIVE_PARALLEL_REGEX_SEARCH_HPP_EAN_10_19_2026
+#define BOOST_XPRESSIVE_PARALLEL_REGEX_SEARCH_HPP_EAN_10_19_2026
+
+// MS compatible compilers support #pragma once
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <deque>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/next_prior.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/iterator/iterator_traits.hpp>
+#include <boost/xpressive/basic_regex.hpp>
+#include <boost/xpressive/match_results.hpp>
+#include <boost/xpressive/regex_algorithms.hpp>
+#include <boost/xpressive/detail/detail_fwd.hpp>
+#include <boost/xpressive/detail/core/access.hpp>
+#include <boost/xpressive/detail/core/state.hpp>
+
+namespace boost { namespace xpressive { namespace detail
+{
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_search_writer
+//   writes the matches in order, with the prefix of each match beginning
+//   where the previous match ended
+template<typename BidiIter, typename OutIter>
+struct parallel_search_writer
+{
+    typedef core_access<BidiIter> access;
+
+    parallel_search_writer(BidiIter begin, BidiIter end, OutIter out)
+      : begin_(begin)
+      , end_(end)
+      , prev_(begin)
+      , out_(out)
+    {
+    }
+
+    void operator ()(match_results<BidiIter> &what)
+    {
+        access::set_prefix_suffix(what, this->prev_, this->end_);
+        access::set_base(what, this->begin_);
+        this->prev_ = what[0].second;
+        *this->out_ = what;
+        ++this->out_;
+    }
+
+    BidiIter begin_;
+    BidiIter end_;
+    BidiIter prev_;
+    OutIter out_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_search_buffer
+//   keeps the matches of a chunk until they can be written
+template<typename BidiIter>
+struct parallel_search_buffer
+{
+    void operator ()(match_results<BidiIter> const &what)
+    {
+        this->matches_.push_back(what);
+    }
+
+    template<typename Writer>
+    void write(Writer &writer)
+    {
+        typename std::deque<match_results<BidiIter> >::iterator it = this->matches_.begin();
+        for(; it != this->matches_.end(); ++it)
+        {
+            writer(*it);
+        }
+    }
+
+    void swap(parallel_search_buffer &that)
+    {
+        this->matches_.swap(that.matches_);
+    }
+
+    std::deque<match_results<BidiIter> > matches_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_search_impl
+//   The chunks are searched by the worker threads, at most window_ chunks
+//   ahead of the chunk the calling thread is writing the matches of.
+template<typename BidiIter>
+struct parallel_search_impl
+  : noncopyable
+{
+    typedef core_access<BidiIter> access;
+    typedef parallel_search_buffer<BidiIter> results_type;
+
+    parallel_search_impl
+    (
+        BidiIter begin
+      , BidiIter end
+      , basic_regex<BidiIter> const &rex
+      , std::size_t chunk_size
+      , regex_constants::match_flag_type flags
+    )
+      : rex_(rex)
+      , flags_(flags)
+      , begin_(begin)
+      , end_(end)
+      , bounds_()
+      , results_()
+      , done_()
+      , next_(0)
+      , written_(0)
+      , window_(0)
+      , stop_(false)
+      , exception_()
+    {
+        // each chunk but the last ends after the first newline following
+        // chunk_size characters
+        typedef typename iterator_value<BidiIter>::type char_type;
+        std::size_t rest = static_cast<std::size_t>(std::distance(begin, end));
+        BidiIter cur = begin;
+        this->bounds_.push_back(begin);
+        while(rest > chunk_size)
+        {
+            std::advance(cur, chunk_size);
+            BidiIter next = std::find(boost::prior(cur), end, char_type('\n'));
+            if(next == end || ++next == end)
+            {
+                break;
+            }
+            rest -= chunk_size + static_cast<std::size_t>(std::distance(cur, next));
+            this->bounds_.push_back(cur = next);
+        }
+        this->bounds_.push_back(end);
+        this->results_.resize(this->bounds_.size() - 1);
+        this->done_.resize(this->bounds_.size() - 1, false);
+    }
+
+    std::size_t chunk_count() const
+    {
+        return this->results_.size();
+    }
+
+    // find the matches in the chunk i, matches at its end belong to the
+    // next chunk
+    template<typename Sink>
+    void search(std::size_t i, Sink &sink) const
+    {
+        BidiIter const cur = this->bounds_[i], end = this->bounds_[i + 1];
+        bool const last = i + 1 == this->chunk_count();
+
+        // the state begins at the beginning of the whole sequence, so that
+        // assertions see the characters preceding the chunk
+        match_results<BidiIter> what;
+        match_state<BidiIter> state(this->begin_, end, what, *access::get_regex_impl(this->rex_), this->flags_);
+        state.cur_ = state.next_search_ = cur;
+        bool not_null = false;
+
+        while(true)
+        {
+            state.reset(what, *access::get_regex_impl(this->rex_));
+            if(!regex_search_impl(state, this->rex_, not_null) || (!last && what[0].first == end))
+            {
+                break;
+            }
+
+            state.cur_ = state.next_search_ = what[0].second;
+            not_null = (0 == what.length());
+            sink(what);
+        }
+    }
+
+    void worker()
+    {
+        while(true)
+        {
+            std::size_t i = 0;
+            {
+                boost::unique_lock<boost::mutex> lock(this->mutex_);
+                while(!this->stop_ && this->next_ != this->chunk_count()
+                   && this->next_ >= this->written_ + this->window_)
+                {
+                    this->window_moved_.wait(lock);
+                }
+                if(this->stop_ || this->next_ == this->chunk_count())
+                {
+                    return;
+                }
+                i = this->next_++;
+            }
+
+            results_type results;
+            try
+            {
+                this->search(i, results);
+            }
+            catch(...)
+            {
+                boost::lock_guard<boost::mutex> lock(this->mutex_);
+                if(!this->exception_)
+                {
+                    this->exception_ = boost::current_exception();
+                }
+                this->stop_ = true;
+                this->window_moved_.notify_all();
+                this->chunk_done_.notify_all();
+                return;
+            }
+
+            boost::lock_guard<boost::mutex> lock(this->mutex_);
+            this->results_[i].swap(results);
+            this->done_[i] = true;
+            this->chunk_done_.notify_all();
+        }
+    }
+
+    template<typename OutIter>
+    OutIter run(OutIter out, unsigned int thread_count)
+    {
+        parallel_search_writer<BidiIter, OutIter> writer(this->begin_, this->end_, out);
+        if(thread_count > this->chunk_count())
+        {
+            thread_count = static_cast<unsigned int>(this->chunk_count());
+        }
+
+        if(thread_count < 2)
+        {
+            for(std::size_t i = 0; i != this->chunk_count(); ++i)
+            {
+                this->search(i, writer);
+            }
+            return writer.out_;
+        }
+
+        this->window_ = 4 * thread_count;
+        boost::thread_group threads;
+        try
+        {
+            for(unsigned int t = 0; t != thread_count; ++t)
+            {
+                threads.create_thread(boost::bind(&parallel_search_impl::worker, this));
+            }
+
+            for(; this->written_ != this->chunk_count(); )
+            {
+                results_type results;
+                {
+                    boost::unique_lock<boost::mutex> lock(this->mutex_);
+                    while(!this->stop_ && !this->done_[this->written_])
+                    {
+                        this->chunk_done_.wait(lock);
+                    }
+                    if(this->stop_)
+                    {
+                        break;
+                    }
+                    results.swap(this->results_[this->written_]);
+                }
+
+                results.write(writer);
+
+                boost::lock_guard<boost::mutex> lock(this->mutex_);
+                ++this->written_;
+                this->window_moved_.notify_all();
+            }
+        }
+        catch(...)
+        {
+            this->stop();
+            threads.join_all();
+            throw;
+        }
+
+        threads.join_all();
+        if(this->exception_)
+        {
+            boost::rethrow_exception(this->exception_);
+        }
+        return writer.out_;
+    }
+
+    void stop()
+    {
+        boost::lock_guard<boost::mutex> lock(this->mutex_);
+        this->stop_ = true;
+        this->window_moved_.notify_all();
+    }
+
+private:
+    basic_regex<BidiIter> const &rex_;
+    regex_constants::match_flag_type const flags_;
+    BidiIter const begin_;
+    BidiIter const end_;
+    std::vector<BidiIter> bounds_;
+    std::vector<results_type> results_;
+    std::vector<bool> done_;
+    std::size_t next_;
+    std::size_t written_;
+    std::size_t window_;
+    bool stop_;
+    boost::exception_ptr exception_;
+    boost::mutex mutex_;
+    boost::condition_variable window_moved_;
+    boost::condition_variable chunk_done_;
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+// parallel_regex_search
+///////////////////////////////////////////////////////////////////////////////
+
+/// \brief Searches [begin, end) for all the matches of a regex on several
+/// threads, and writes them to an output iterator in order.
+///
+/// The sequence is split into chunks of about \c chunk_size characters, each
+/// one ending after a newline. The chunks are searched concurrently on
+/// \c thread_count threads. The matches are written in the order they occur,
+/// the same as the ones of a regex_iterator over [begin, end), provided no
+/// match spans a newline.
+///
+/// Assertions see the characters preceding a chunk, but not the ones
+/// following it. The end of each chunk is treated as the end of the sequence,
+/// so patterns should not depend on what follows the end of a line.
+///
+/// The position() of each match_results is its offset from begin, and its
+/// prefix() reaches back to the end of the previous match.
+///
+/// \pre [begin,end) is a valid iterator range.
+/// \param out An output iterator to which the match_results objects are written.
+/// \param begin The beginning of the sequence to search.
+/// \param end The end of the sequence to search.
+/// \param re The regular expression object to use.
+/// \param chunk_size The approximate number of characters in each chunk, 1M
+///        if 0.
+/// \param thread_count The number of threads searching the chunks, one for
+///        each hardware thread if 0. With a single thread, the chunks are
+///        searched by the calling thread.
+/// \param flags Optional match flags, used to control how the expression
+///        is matched against the sequence. (See match_flag_type.)
+/// \return The output iterator, after the last match was written.
+/// \throw regex_error on stack exhaustion
+/// \throw thread_resource_error if the threads cannot be created
+template<typename OutIter, typename BidiIter>
+inline OutIter parallel_regex_search
+(
+    OutIter out
+  , BOOST_XPR_NONDEDUCED_TYPE_(BidiIter) begin
+  , BOOST_XPR_NONDEDUCED_TYPE_(BidiIter) end
+  , basic_regex<BidiIter> const &re
+  , std::size_t chunk_size = 0
+  , unsigned int thread_count = 0
+  , regex_constants::match_flag_type flags = regex_constants::match_default
+)
+{
+    // a default-constructed regex matches nothing
+    if(0 == re.regex_id())
+    {
+        return out;
+    }
+
+    if(0 == chunk_size)
+    {
+        chunk_size = 1024 * 1024;
+    }
+
+    if(0 == thread_count)
+    {
+        thread_count = boost::thread::hardware_concurrency();
+    }
+
+    detail::parallel_search_impl<BidiIter> impl(begin, end, re, chunk_size, flags);
+    return impl.run(out, thread_count);
+}
+
+/// \overload
+///
+template<typename OutIter, typename BidiRange, typename BidiIter>
+inline OutIter parallel_regex_search
+(
+    OutIter out
+  , BidiRange const &rng
+  , basic_regex<BidiIter> const &re
+  , std::size_t chunk_size = 0
+  , unsigned int thread_count = 0
+  , regex_constants::match_flag_type flags = regex_constants::match_default
+  , typename disable_if<detail::is_char_ptr<BidiRange> >::type * = 0
+)
+{
+    // Note that the result iterator of the range must be convertible
+    // to BidiIter here.
+    BidiIter begin = boost::begin(rng), end = boost::end(rng);
+    return xpressive::parallel_regex_search(out, begin, end, re, chunk_size, thread_count, flags);
+}
+
+}} // namespace boost::xpressive
+
+#endif
@@ -349,6 +349,14 @@ int main(int argc, char** argv) {
     perf_test<std::string, structure_sprintf>("double->string",      1.123, "%lf");
     perf_test<std::string, structure_sprintf>("long double->string", 1.123L, "%Lf");
 
+    // Floating point values with all their digits, as written by programs
+    perf_test<double, structure_sscanf>("string->double, 17 digits", std::string("0.30000000000000004"), "%lf");
+    perf_test<double, structure_sscanf>("string->double, exponent", std::string("-1.2345678901234567e-89"), "%lf");
+    perf_test<float, structure_sscanf>("string->float, 9 digits", std::string("0.333333343"), "%f");
+    perf_test<std::string, structure_sprintf>("double->string, 17 digits", 1.0 / 3.0, "%.17g");
+    perf_test<std::string, structure_sprintf>("double->string, exponent", -1.2345678901234567e-89, "%.17g");
+    perf_test<std::string, structure_sprintf>("float->string, 9 digits", 1.0f / 3.0f, "%.9g");
+
 
     string_like_test_set<to_char_conv>("char*");
     string_like_test_set<to_uchar_conv>("unsigned char*");
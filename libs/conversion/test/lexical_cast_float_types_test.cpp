@@ -25,6 +25,8 @@
 void test_conversion_from_to_float();
 void test_conversion_from_to_double();
 void test_conversion_from_to_long_double();
+void test_correct_rounding();
+void test_shortest_output();
 
 using namespace boost;
 
@@ -36,6 +38,8 @@ unit_test::test_suite *init_unit_test_suite(int, char *[])
     suite->add(BOOST_TEST_CASE(&test_conversion_from_to_float));
     suite->add(BOOST_TEST_CASE(&test_conversion_from_to_double));
     suite->add(BOOST_TEST_CASE(&test_conversion_from_to_long_double));
+    suite->add(BOOST_TEST_CASE(&test_correct_rounding));
+    suite->add(BOOST_TEST_CASE(&test_shortest_output));
 
     return suite;
 }
@@ -512,9 +516,65 @@ void test_conversion_from_to_long_double()
     BOOST_CHECK(true);
 }
 
+void test_correct_rounding()
+{
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+    // Halfway and nearly halfway between two values; the fallback conversion
+    // does not always round these correctly
+    BOOST_CHECK_EQUAL(lexical_cast<double>("9007199254740993"), 9007199254740992.0);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("9007199254740995"), 9007199254740996.0);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("9007199254740993.0000000000000000000000000001"), 9007199254740994.0);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("1.00000005960464477550"), 1.00000005960464477550);
+    BOOST_CHECK_EQUAL(lexical_cast<float>("1.00000005960464477550"), 1.00000005960464477550f);
+    BOOST_CHECK_EQUAL(lexical_cast<float>("1.000000059604644775390625"), 1.0f);
+    BOOST_CHECK_EQUAL(lexical_cast<float>("1.000000059604644775390626"), 1.00000012f);
+#endif
 
+    // Around the smallest and largest values
+    BOOST_CHECK_EQUAL(lexical_cast<double>("2.2250738585072011e-308"), 2.2250738585072011e-308);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("2.2250738585072012e-308"), 2.2250738585072012e-308);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("4.9406564584124654e-324"), 4.9406564584124654e-324);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("2.4703282292062328e-324"), 4.9406564584124654e-324);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("2.4703282292062327e-324"), 0.0);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("1.7976931348623158e308"), 1.7976931348623157e308);
+    BOOST_CHECK_THROW(lexical_cast<double>("1.7976931348623159e308"), bad_lexical_cast);
+    BOOST_CHECK_EQUAL(lexical_cast<float>("1.4e-45"), 1.4e-45f);
+    BOOST_CHECK_EQUAL(lexical_cast<float>("3.4028235e38"), 3.4028235e38f);
+
+    // Many digits
+    BOOST_CHECK_EQUAL(lexical_cast<double>("0.1000000000000000055511151231257827021181583404541015625"), 0.1);
+    BOOST_CHECK_EQUAL(lexical_cast<double>(std::string(400, '1') + "e-400"), 0.1111111111111111);
+    BOOST_CHECK_EQUAL(lexical_cast<double>("0." + std::string(400, '0') + "1e400"), 0.1);
+}
 
+void test_shortest_output()
+{
+#ifndef BOOST_LCAST_NO_FAST_FLOAT
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(0.1), "0.1");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(0.1f), "0.1");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1.0 / 3.0), "0.3333333333333333");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1.0f / 3.0f), "0.33333334");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(100.0), "100");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(-1.5), "-1.5");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(-0.0), "-0");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1e-5), "1e-05");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1e16), "10000000000000000");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1e17), "1e+17");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(1.7976931348623157e308), "1.7976931348623157e+308");
+    BOOST_CHECK_EQUAL(lexical_cast<std::string>(4.9406564584124654e-324), "5e-324");
+#ifndef BOOST_LCAST_NO_WCHAR_T
+    BOOST_CHECK(lexical_cast<std::wstring>(0.25) == L"0.25");
+    BOOST_CHECK(lexical_cast<std::wstring>(2.5e-10f) == L"2.5e-10");
+#endif
+#endif
 
-
-
-
+    // Whatever the output, it reads back as the same value
+    boost::uint32_t seed = 12345;
+    for (int i = 0; i < 10000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const double d = std::ldexp(static_cast<double>(seed), static_cast<int>(seed % 600) - 300);
+        BOOST_CHECK_EQUAL(lexical_cast<double>(lexical_cast<std::string>(d)), d);
+        const float f = static_cast<float>(std::ldexp(static_cast<double>(seed >> 8), static_cast<int>(seed % 200) - 100));
+        BOOST_CHECK_EQUAL(lexical_cast<float>(lexical_cast<std::string>(f)), f);
+    }
+}
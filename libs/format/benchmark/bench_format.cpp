@@ -108,6 +108,7 @@ void test_snprintf();
 void test_nullstream();
 void test_opti_nullstream();
 void test_parsed_once_format();
+void test_compiled_format();
 void test_reused_format();
 void test_format();
 void test_try1();
@@ -135,6 +136,8 @@ int main(int argc, char * argv[]) {
       test_nullstream();
     if(choices=="" || choices.find('1') !=npos)
       test_parsed_once_format();
+    if(choices=="" || choices.find('c') !=npos)
+      test_compiled_format();
     if(choices=="" || choices.find('r') !=npos)
       test_reused_format();
     if(choices=="" || choices.find('f') !=npos)
@@ -325,6 +328,30 @@ void test_parsed_once_format()
           << ",  = " << t / tstream << " * nullStream \n";
 }
 
+void test_compiled_format()
+{
+    using namespace std;
+    static const boost::compiled_format fmter(fstring);
+
+    boost::io::basic_oaltstringstream<char> oss;
+    fmter.write(ostreambuf_iterator<char>(oss), arg1, arg2, arg3);
+    if( oss.str() != res ) {
+      cerr << endl << oss.str();
+    }
+
+    // the format-string is parsed once, and the arguments are written
+    // straight to the stream buffer.
+
+    boost::timer chrono;
+    for(int i=0; i<NTests; ++i) {
+        fmter.write(ostreambuf_iterator<char>(nullStream), arg1, arg2, arg3);
+    }
+    double t=chrono.elapsed();
+    cout  << left << setw(20) <<"compiled time"<< right <<":" << setw(5) << t
+          << ",  = " << t / tpf << " * printf "
+          << ",  = " << t / tstream << " * nullStream \n";
+}
+
 void test_reused_format()
 {
   using namespace std;
@@ -0,0 +1,140 @@
+// ------------------------------------------------------------------------------
+// format_test_compiled.cpp :  compiled formats give the same results as format
+// ------------------------------------------------------------------------------
+
+//  Copyright Samuel Krempp 2013. Use, modification, and distribution are
+//  subject to the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// see http://www.boost.org/libs/format for library home page
+
+// ------------------------------------------------------------------------------
+
+#include "boost/format.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+#define BOOST_INCLUDE_MAIN
+#include <boost/test/test_tools.hpp>
+
+struct Rational {
+  int n,d;
+  Rational (int an, int ad) : n(an), d(ad) {}
+};
+
+std::ostream& operator<<( std::ostream& os, const Rational& r) {
+  os << r.n << "/" << r.d;
+  return os;
+}
+
+// checks that a compiled format gives the same result as format,
+// for every format string in fstrings
+template<class T>
+void check_same(const char * const * fstrings, const T& x) {
+    using boost::format;
+    using boost::compiled_format;
+    for(; *fstrings; ++fstrings) {
+        std::string expected = str(format(*fstrings) % x);
+        std::string s = compiled_format(*fstrings).str(x);
+        if(s != expected) {
+          std::cerr << *fstrings << " : \"" << s << "\" instead of \"" << expected << "\"\n";
+          BOOST_ERROR("compiled format and format disagree");
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    using namespace std;
+    using boost::format;
+    using boost::compiled_format;
+    using boost::io::group;
+
+    static const char * const number_fstrings[] = {
+        "%d", "%5d", "%-5d|", "%=7d", "%05d", "%+d", "%+6d", "% d", "% 6d", "%-+6d|",
+        "%x", "%#x", "%#X", "%08x", "%#08x", "%#o", "%o", "%c", "%5.1s", "%_6d",
+        "%|1$s|", "%g", "%e", "%E", "%f", "%.3f", "%10.2f", "%-10.2e|", "%+08.3f",
+        "%#g", "%G", "%.0f", "%.0e", "%s", "%1%", "% +d", "%_ 6d", "%_6.2s", 0
+    };
+    check_same(number_fstrings, 0);
+    check_same(number_fstrings, 42);
+    check_same(number_fstrings, -42);
+    check_same(number_fstrings, 255u);
+    check_same(number_fstrings, -1L);
+    check_same(number_fstrings, static_cast<short>(-300));
+    check_same(number_fstrings, static_cast<unsigned short>(65535));
+    check_same(number_fstrings, true);
+#ifdef BOOST_HAS_LONG_LONG
+    check_same(number_fstrings, static_cast< ::boost::long_long_type>(-1234567890123LL));
+    check_same(number_fstrings, static_cast< ::boost::ulong_long_type>(18446744073709551615ULL));
+#endif
+    check_same(number_fstrings, 0.0);
+    check_same(number_fstrings, -0.0);
+    check_same(number_fstrings, 3.14159265);
+    check_same(number_fstrings, -2.5e-7);
+    check_same(number_fstrings, 1.5e200);
+    check_same(number_fstrings, 12.34f);
+    check_same(number_fstrings, 1.0L / 3);
+    check_same(number_fstrings, 'a');
+    check_same(number_fstrings, "text");
+    check_same(number_fstrings, "");
+    check_same(number_fstrings, string("-text"));
+    check_same(number_fstrings, Rational(16, 9));
+    check_same(number_fstrings, group(setfill('_'), hex, 255));
+
+    // several arguments, tabulations, and literal text
+    compiled_format f("%5%. %5$=6s . %1% format %5%, c'%3% %1% %2%.\n");
+    BOOST_CHECK(f.expected_args() == 5);
+    BOOST_CHECK(f.str("le", "bonheur", "est", "trop", group(setfill('_'), "bref"))
+                == "bref. _bref_ . le format bref, c'est le bonheur.\n");
+    BOOST_CHECK(compiled_format("%1%, %20T_ (%|2$5|,%|3$5|)\n").str("98765", 1326, 88)
+                == "98765, _____________ ( 1326,   88)\n");
+    BOOST_CHECK(compiled_format("%s, %|20t|=").str(88) == "88,                 =");
+    BOOST_CHECK(compiled_format("%% no arguments %%").str() == "% no arguments %");
+    BOOST_CHECK(compiled_format("%3$0#6x %1$20.10E %2$g %3$0+5d \n").str(45.23, 12.34, 23)
+                == "0x0017     4.5230000000E+01 12.34 +0023 \n");
+
+    // output iterators, and reuse
+    compiled_format g("%1%-%2%");
+    char buf[32];
+    char * end = g.write(buf, 12, "ab");
+    BOOST_CHECK(string(buf, end) == "12-ab");
+    ostringstream oss;
+    for(int i=0; i<3; ++i)
+        g.write(ostreambuf_iterator<char>(oss), i, i*i);
+    BOOST_CHECK(oss.str() == "0-01-12-4");
+
+    // wrong number of arguments
+    try {
+        g.str(1);
+        BOOST_ERROR("too_few_args not thrown");
+    }
+    catch(boost::io::too_few_args& e) {
+        BOOST_CHECK(e.get_cur() == 1 && e.get_expected() == 2);
+    }
+    try {
+        g.str(1, 2, 3);
+        BOOST_ERROR("too_many_args not thrown");
+    }
+    catch(boost::io::too_many_args&) {
+    }
+    try {
+        compiled_format("%1% %");
+        BOOST_ERROR("bad_format_string not thrown");
+    }
+    catch(boost::io::bad_format_string&) {
+    }
+
+#if !defined(BOOST_NO_STD_WSTRING)  && !defined(BOOST_NO_STD_WSTREAMBUF) \
+    && !defined(BOOST_FORMAT_IGNORE_STRINGSTREAM)
+    boost::wcompiled_format w(L"%1% %|2$+08.2f| %3$#x %4%");
+    BOOST_CHECK(w.str(L"wide", -3.14159, 255, 'c') == L"wide -0003.14 0xff c");
+    BOOST_CHECK(w.str(L"wide", -3.14159, 255, 'c')
+                == str(boost::wformat(L"%1% %|2$+08.2f| %3$#x %4%") % L"wide" % -3.14159 % 255 % 'c'));
+#endif
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+// Boost.Function library
+
+//  Copyright Douglas Gregor 2001-2006. Use, modification and
+//  distribution is subject to the Boost Software License, Version
+//  1.0. (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// For more information, see http://www.boost.org
+
+#include <boost/test/minimal.hpp>
+#include <boost/function/small_function.hpp>
+#include <boost/function.hpp>
+#include <boost/ref.hpp>
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+#  include <memory>
+#endif
+
+using boost::small_function;
+
+static int global_value = 0;
+
+static int add(int x, int y) { return x + y; }
+
+static void set_global(int x) { global_value = x; }
+
+struct counted
+{
+  static int instances;
+  static int copies;
+
+  counted() { ++instances; }
+  counted(const counted&) throw() { ++instances; ++copies; }
+  ~counted() { --instances; }
+};
+
+int counted::instances = 0;
+int counted::copies = 0;
+
+// Small enough for the default buffer
+struct small_adder : counted
+{
+  explicit small_adder(int v) : value(v) { }
+  int operator()(int x, int y) const { return x + y + value; }
+
+  int value;
+};
+
+// Larger than the default buffer on every platform
+struct large_adder : counted
+{
+  explicit large_adder(int v) : value(v) { }
+  int operator()(int x, int y) const { return x + y + value; }
+
+  int value;
+  char padding[8 * sizeof(void*)];
+};
+
+// Small, but copying may throw
+struct throwing_adder
+{
+  throwing_adder() { }
+  throwing_adder(const throwing_adder&) { }
+  int operator()(int x, int y) const { return x + y; }
+};
+
+struct stateful
+{
+  stateful() : calls(0) { }
+  int operator()() { return ++calls; }
+
+  int calls;
+};
+
+struct X
+{
+  explicit X(int v) : value(v) { }
+  int get(int x) const { return value + x; }
+
+  int value;
+};
+
+static void test_empty()
+{
+  small_function<int (int, int)> f;
+
+  BOOST_CHECK(f.empty());
+  BOOST_CHECK(!f);
+  BOOST_CHECK(!f.stored_inline());
+  BOOST_CHECK(f.target_type() == BOOST_SP_TYPEID(void));
+
+  bool caught = false;
+  try {
+    f(1, 2);
+  } catch (boost::bad_function_call&) {
+    caught = true;
+  }
+  BOOST_CHECK(caught);
+
+  small_function<int (int, int)> g(0);
+  BOOST_CHECK(g.empty());
+
+  int (*null_ptr)(int, int) = 0;
+  small_function<int (int, int)> h(null_ptr);
+  BOOST_CHECK(h.empty());
+}
+
+static void test_targets()
+{
+  small_function<int (int, int)> f(&add);
+  BOOST_CHECK(f);
+  BOOST_CHECK(f.stored_inline());
+  BOOST_CHECK(f(2, 3) == 5);
+  BOOST_CHECK(f.target_type() == BOOST_SP_TYPEID(int (*)(int, int)));
+  BOOST_CHECK(*f.target<int (*)(int, int)>() == &add);
+  BOOST_CHECK(f.target<small_adder>() == 0);
+
+  small_function<void (int)> v(&set_global);
+  v(7);
+  BOOST_CHECK(global_value == 7);
+
+  // void return type discards the result
+  small_function<void (int, int)> d(&add);
+  d(1, 2);
+
+  small_function<int (const X&, int)> m(&X::get);
+  BOOST_CHECK(m(X(10), 5) == 15);
+
+  stateful s;
+  small_function<int ()> r(boost::ref(s));
+  BOOST_CHECK(r() == 1);
+  BOOST_CHECK(r() == 2);
+  BOOST_CHECK(s.calls == 2);
+
+  // a boost::function is just another function object
+  boost::function<int (int, int)> bf(&add);
+  small_function<int (int, int)> fromf(bf);
+  BOOST_CHECK(fromf(4, 4) == 8);
+}
+
+static void test_storage()
+{
+  counted::copies = 0;
+
+  {
+    small_function<int (int, int)> f((small_adder(1)));
+    BOOST_CHECK(f.stored_inline());
+    BOOST_CHECK(f(1, 2) == 4);
+    BOOST_CHECK(f.target<small_adder>()->value == 1);
+
+    small_function<int (int, int)> g((large_adder(2)));
+    BOOST_CHECK(!g.stored_inline());
+    BOOST_CHECK(g(1, 2) == 5);
+
+    // a larger buffer keeps the same object inline
+    small_function<int (int, int), sizeof(large_adder)> h((large_adder(3)));
+    BOOST_CHECK(h.stored_inline());
+    BOOST_CHECK(h(1, 2) == 6);
+    BOOST_CHECK(h.buffer_size() == sizeof(large_adder));
+
+    BOOST_CHECK(counted::instances == 3);
+
+    // objects that may throw when moved never go in the buffer
+    small_function<int (int, int)> t((throwing_adder()));
+    BOOST_CHECK(!t.stored_inline());
+    BOOST_CHECK(t(1, 2) == 3);
+  }
+
+  BOOST_CHECK(counted::instances == 0);
+}
+
+static void test_move()
+{
+  {
+    small_function<int (int, int)> f((large_adder(2)));
+    const large_adder* target = f.target<large_adder>();
+
+    counted::copies = 0;
+
+    // moving a heap allocated target transfers the pointer
+    small_function<int (int, int)> g(boost::move(f));
+    BOOST_CHECK(f.empty());
+    BOOST_CHECK(g(1, 1) == 4);
+    BOOST_CHECK(g.target<large_adder>() == target);
+    BOOST_CHECK(counted::copies == 0);
+
+    small_function<int (int, int)> h((small_adder(1)));
+    h = boost::move(g);
+    BOOST_CHECK(g.empty());
+    BOOST_CHECK(h(1, 1) == 4);
+    BOOST_CHECK(counted::instances == 1);
+
+    // inline targets are moved into the new buffer
+    small_function<int (int, int)> i((small_adder(5)));
+    small_function<int (int, int)> j(boost::move(i));
+    BOOST_CHECK(i.empty());
+    BOOST_CHECK(j.stored_inline());
+    BOOST_CHECK(j(0, 0) == 5);
+
+    swap(h, j);
+    BOOST_CHECK(h(0, 0) == 5);
+    BOOST_CHECK(j(0, 0) == 2);
+    BOOST_CHECK(h.stored_inline());
+    BOOST_CHECK(!j.stored_inline());
+
+    j = 0;
+    BOOST_CHECK(j.empty());
+    BOOST_CHECK(counted::instances == 1);
+
+    h = &add;
+    BOOST_CHECK(h(1, 2) == 3);
+    BOOST_CHECK(counted::instances == 0);
+  }
+
+  BOOST_CHECK(counted::instances == 0);
+}
+
+#if !defined(BOOST_NO_CXX11_LAMBDAS) && !defined(BOOST_NO_CXX11_SMART_PTR) \
+  && !defined(BOOST_NO_CXX11_NOEXCEPT)
+struct move_only
+{
+  explicit move_only(int v) : p(new int(v)) { }
+  int operator()() const { return *p; }
+
+  std::unique_ptr<int> p;
+};
+
+static void test_move_only()
+{
+  small_function<int ()> f((move_only(42)));
+
+  BOOST_CHECK(f.stored_inline());
+  BOOST_CHECK(f() == 42);
+
+  small_function<int ()> g(std::move(f));
+  BOOST_CHECK(f.empty());
+  BOOST_CHECK(g() == 42);
+
+  // move-only arguments are passed on
+  small_function<int (std::unique_ptr<int>)> h(
+    [](std::unique_ptr<int> x) { return *x; });
+  BOOST_CHECK(h(std::unique_ptr<int>(new int(3))) == 3);
+
+  BOOST_STATIC_ASSERT(noexcept(small_function<int ()>(std::move(g))));
+}
+#endif
+
+int test_main(int, char* [])
+{
+  test_empty();
+  test_targets();
+  test_storage();
+  test_move();
+#if !defined(BOOST_NO_CXX11_LAMBDAS) && !defined(BOOST_NO_CXX11_SMART_PTR) \
+  && !defined(BOOST_NO_CXX11_NOEXCEPT)
+  test_move_only();
+#endif
+
+  return 0;
+}
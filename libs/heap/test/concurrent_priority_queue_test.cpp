@@ -0,0 +1,181 @@
+/*=============================================================================
+    Copyright (c) 2010 Tim Blechmann
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#define BOOST_TEST_MAIN
+#ifdef BOOST_HEAP_INCLUDE_TESTS
+#include <boost/test/included/unit_test.hpp>
+#else
+#include <boost/test/unit_test.hpp>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <boost/heap/concurrent_priority_queue.hpp>
+
+#include "stable_heap_tests.hpp"
+
+template <typename pri_queue, typename Data>
+Data drain(pri_queue & q)
+{
+    Data ret;
+    typename pri_queue::value_type value;
+    while (q.try_pop(value))
+        ret.push_back(value);
+    return ret;
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_priority_queue_sequential_test )
+{
+    typedef boost::heap::concurrent_priority_queue<int> pri_queue;
+
+    for (int i = 0; i != test_size; ++i) {
+        pri_queue q;
+        BOOST_REQUIRE(q.empty());
+
+        test_data data = make_test_data(i);
+        std::random_shuffle(data.begin(), data.end());
+        for (size_t j = 0; j != data.size(); ++j)
+            q.push(data[j]);
+
+        BOOST_REQUIRE_EQUAL(q.size(), data.size());
+        BOOST_REQUIRE_EQUAL(q.empty(), data.empty());
+
+        test_data popped = drain<pri_queue, test_data>(q);
+        BOOST_REQUIRE(q.empty());
+
+        std::sort(popped.begin(), popped.end());
+        std::sort(data.begin(), data.end());
+        BOOST_REQUIRE(popped == data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_priority_queue_single_queue_order_test )
+{
+    /* with a single internal heap, the ordering is not relaxed */
+    typedef boost::heap::concurrent_priority_queue<int> pri_queue;
+    typedef boost::heap::concurrent_priority_queue<int, boost::heap::compare<std::greater<int> > > min_queue;
+
+    test_data data = make_test_data(test_size * 4);
+    std::random_shuffle(data.begin(), data.end());
+
+    pri_queue q(1);
+    min_queue mq(1);
+    BOOST_REQUIRE_EQUAL(q.queue_count(), 1u);
+    for (size_t j = 0; j != data.size(); ++j) {
+        q.push(data[j]);
+        mq.push(data[j]);
+    }
+
+    test_data popped = drain<pri_queue, test_data>(q);
+    std::sort(data.begin(), data.end(), std::greater<int>());
+    BOOST_REQUIRE(popped == data);
+
+    popped = drain<min_queue, test_data>(mq);
+    std::sort(data.begin(), data.end());
+    BOOST_REQUIRE(popped == data);
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_priority_queue_stable_test )
+{
+    typedef boost::heap::concurrent_priority_queue<q_tester, boost::heap::stable<true> > pri_queue;
+    BOOST_STATIC_ASSERT(pri_queue::is_stable);
+
+    stable_test_data data = make_stable_test_data(test_size);
+
+    pri_queue q(1);
+    for (size_t j = 0; j != data.size(); ++j)
+        q.push(data[j]);
+
+    stable_test_data popped = drain<pri_queue, stable_test_data>(q);
+    std::stable_sort(data.begin(), data.end(), std::greater<q_tester>());
+    BOOST_REQUIRE(popped == data);
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_priority_queue_clear_test )
+{
+    boost::heap::concurrent_priority_queue<int> q(4);
+    for (int i = 0; i != test_size; ++i)
+        q.push(i);
+    BOOST_REQUIRE(!q.empty());
+
+    q.clear();
+    BOOST_REQUIRE(q.empty());
+    BOOST_REQUIRE_EQUAL(q.size(), 0u);
+
+    int value;
+    BOOST_REQUIRE(!q.try_pop(value));
+}
+
+typedef boost::heap::concurrent_priority_queue<int> concurrent_queue;
+
+const int producer_count = 4;
+const int consumer_count = 4;
+const int elements_per_producer = 100000;
+
+void produce(concurrent_queue & q, int offset)
+{
+    for (int i = 0; i != elements_per_producer; ++i)
+        q.push(offset + i);
+}
+
+void consume(concurrent_queue & q, boost::atomic<int> & running_producers, std::vector<int> & popped)
+{
+    for (;;) {
+        int value;
+        if (q.try_pop(value)) {
+            popped.push_back(value);
+            continue;
+        }
+
+        if (running_producers.load() == 0) {
+            /* producers are done: drain what is left */
+            while (q.try_pop(value))
+                popped.push_back(value);
+            return;
+        }
+    }
+}
+
+void produce_and_count(concurrent_queue & q, int offset, boost::atomic<int> & running_producers)
+{
+    produce(q, offset);
+    --running_producers;
+}
+
+BOOST_AUTO_TEST_CASE( concurrent_priority_queue_concurrent_test )
+{
+    concurrent_queue q(2 * (producer_count + consumer_count));
+    boost::atomic<int> running_producers(producer_count);
+    std::vector<std::vector<int> > popped(consumer_count);
+
+    boost::thread_group threads;
+    for (int i = 0; i != producer_count; ++i)
+        threads.create_thread(boost::bind(&produce_and_count, boost::ref(q), i * elements_per_producer,
+                                          boost::ref(running_producers)));
+    for (int i = 0; i != consumer_count; ++i)
+        threads.create_thread(boost::bind(&consume, boost::ref(q), boost::ref(running_producers),
+                                          boost::ref(popped[i])));
+    threads.join_all();
+
+    BOOST_REQUIRE(q.empty());
+
+    std::vector<int> all;
+    for (int i = 0; i != consumer_count; ++i)
+        all.insert(all.end(), popped[i].begin(), popped[i].end());
+
+    /* every element has been removed exactly once */
+    BOOST_REQUIRE_EQUAL(all.size(), size_t(producer_count * elements_per_producer));
+    std::sort(all.begin(), all.end());
+    for (int i = 0; i != producer_count * elements_per_producer; ++i)
+        BOOST_REQUIRE_EQUAL(all[i], i);
+}
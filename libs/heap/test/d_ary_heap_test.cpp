@@ -14,6 +14,7 @@
 #endif
 
 #include <algorithm>
+#include <iterator>
 
 #include <boost/heap/d_ary_heap.hpp>
 
@@ -23,6 +24,55 @@
 #include "merge_heap_tests.hpp"
 
 
+template <typename pri_queue>
+void pri_queue_test_push_range(void)
+{
+    for (int i = 0; i != test_size; ++i)
+    {
+        // small prefix (element-wise sifting) and large prefix (bottom-up heap construction)
+        for (int j = 0; j <= i; j += (i / 2) + 1)
+        {
+            pri_queue q;
+            test_data data = make_test_data(i);
+
+            test_data shuffled (data);
+            std::random_shuffle(shuffled.begin(), shuffled.end());
+
+            fill_q(q, test_data(shuffled.begin(), shuffled.begin() + j));
+            q.push_range(shuffled.begin() + j, shuffled.end());
+
+            check_q(q, data);
+        }
+    }
+}
+
+template <typename pri_queue>
+void pri_queue_test_pop_n(void)
+{
+    pri_queue q;
+    test_data data = make_test_data(test_size);
+    test_data shuffled (data);
+    std::random_shuffle(shuffled.begin(), shuffled.end());
+    q.push_range(shuffled.begin(), shuffled.end());
+
+    test_data popped;
+    q.pop_n(test_size / 4, std::back_inserter(popped));
+    BOOST_REQUIRE_EQUAL(popped.size(), (size_t)test_size / 4);
+    for (int i = 0; i != test_size / 4; ++i)
+        BOOST_REQUIRE_EQUAL(popped[i], data[test_size - 1 - i]);
+
+    data.resize(test_size - test_size / 4);
+    check_q(q, data);
+}
+
+template <typename pri_queue>
+void run_batch_heap_tests(void)
+{
+    pri_queue_test_push_range<pri_queue>();
+    pri_queue_test_pop_n<pri_queue>();
+}
+
+
 template <int D, bool stable>
 void run_d_ary_heap_test(void)
 {
@@ -40,6 +90,7 @@ void run_d_ary_heap_test(void)
     run_moveable_heap_tests<pri_queue>();
     run_reserve_heap_tests<pri_queue>();
     run_merge_tests<pri_queue>();
+    run_batch_heap_tests<pri_queue>();
 
     run_ordered_iterator_tests<pri_queue>();
 
@@ -85,6 +136,7 @@ void run_d_ary_heap_mutable_test(void)
     run_mutable_heap_tests<pri_queue>();
 
     run_merge_tests<pri_queue>();
+    run_batch_heap_tests<pri_queue>();
 
     run_ordered_iterator_tests<pri_queue>();
 
@@ -120,3 +172,17 @@ BOOST_AUTO_TEST_CASE( d_ary_heap_compare_lookup_test )
                                     boost::heap::allocator<std::allocator<int> > > pri_queue;
     run_common_heap_tests<pri_queue>();
 }
+
+BOOST_AUTO_TEST_CASE( d_ary_heap_cache_aligned_arity_test )
+{
+    typedef boost::heap::d_ary_heap<int, boost::heap::cache_aligned_arity<int> > pri_queue;
+    typedef boost::heap::d_ary_heap<int, boost::heap::cache_aligned_arity<int>,
+                                         boost::heap::mutable_<true> > mutable_pri_queue;
+    typedef boost::heap::d_ary_heap<double, boost::heap::cache_aligned_arity<double, 8> > binary_pri_queue;
+
+    run_common_heap_tests<pri_queue>();
+    run_batch_heap_tests<pri_queue>();
+    run_common_heap_tests<mutable_pri_queue>();
+    run_mutable_heap_tests<mutable_pri_queue>();
+    run_common_heap_tests<binary_pri_queue>();
+}
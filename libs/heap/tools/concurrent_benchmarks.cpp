@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2010 Tim Blechmann
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+#include <boost/bind.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "../../../boost/heap/priority_queue.hpp"
+#include "../../../boost/heap/concurrent_priority_queue.hpp"
+
+#include "high_resolution_timer.hpp"
+
+using namespace std;
+
+/* every thread alternates between push and try_pop on a prefilled queue.
+ * the benchmark reports the aggregated number of operations per second */
+
+const int prefill = 1<<16;
+const int operations_per_thread = 1<<20;
+
+class locked_priority_queue
+{
+public:
+    void push(long v)
+    {
+        boost::mutex::scoped_lock lock(mutex_);
+        q_.push(v);
+    }
+
+    bool try_pop(long & ret)
+    {
+        boost::mutex::scoped_lock lock(mutex_);
+        if (q_.empty())
+            return false;
+        ret = q_.top();
+        q_.pop();
+        return true;
+    }
+
+private:
+    boost::mutex mutex_;
+    boost::heap::priority_queue<long> q_;
+};
+
+template <typename pri_queue>
+void worker(pri_queue & q, boost::barrier & barrier, int seed)
+{
+    /* rand() may be serialized internally, so every thread uses its own generator */
+    unsigned int state = seed * 2654435761u + 1;
+    long sink = 0;
+    barrier.wait();
+
+    for (int i = 0; i != operations_per_thread / 2; ++i) {
+        state = state * 1664525u + 1013904223u;
+        q.push(state >> 8);
+        long value;
+        if (q.try_pop(value))
+            sink += value;
+    }
+    if (sink == 42)
+        cerr << "";
+}
+
+template <typename pri_queue>
+double run_benchmark(pri_queue & q, int thread_count)
+{
+    for (int i = 0; i != prefill; ++i)
+        q.push(rand());
+
+    boost::barrier barrier(thread_count + 1);
+    boost::thread_group threads;
+    for (int i = 0; i != thread_count; ++i)
+        threads.create_thread(boost::bind(&worker<pri_queue>, boost::ref(q), boost::ref(barrier), i));
+
+    barrier.wait();
+    boost::high_resolution_timer timer;
+    threads.join_all();
+    double elapsed = timer.elapsed();
+
+    return double(thread_count) * operations_per_thread / elapsed;
+}
+
+int main()
+{
+    cout << fixed << setprecision(0);
+    cout << "threads\tmutex + priority_queue\tconcurrent_priority_queue" << endl;
+
+    for (int thread_count = 1; thread_count <= 32; thread_count *= 2) {
+        cout << thread_count << '\t';
+        {
+            locked_priority_queue q;
+            cout << run_benchmark(q, thread_count) << '\t';
+        }
+        {
+            boost::heap::concurrent_priority_queue<long> q(2 * thread_count);
+            cout << run_benchmark(q, thread_count) << '\t';
+        }
+        cout << endl;
+    }
+}
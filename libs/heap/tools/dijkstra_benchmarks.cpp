@@ -0,0 +1,170 @@
+/*=============================================================================
+    Copyright (c) 2010 Tim Blechmann
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+
+#include "../../../boost/heap/d_ary_heap.hpp"
+#include "../../../boost/heap/pairing_heap.hpp"
+#include "../../../boost/heap/fibonacci_heap.hpp"
+#include "../../../boost/heap/binomial_heap.hpp"
+
+#include "high_resolution_timer.hpp"
+
+using namespace std;
+
+/* single-source shortest paths on random sparse graphs: every edge relaxation
+ * that improves a tentative distance is a decrease-key operation */
+
+struct edge
+{
+    int target;
+    int weight;
+};
+
+typedef vector<vector<edge> > graph;
+
+graph make_graph(int vertices, int degree)
+{
+    srand(vertices);
+
+    graph g(vertices);
+    for (int v = 0; v != vertices; ++v) {
+        // connect to the next vertex, so that every vertex is reachable
+        edge next = { (v + 1) % vertices, 1 + rand() % 1000 };
+        g[v].push_back(next);
+
+        for (int i = 1; i != degree; ++i) {
+            edge random_edge = { rand() % vertices, 1 + rand() % 1000 };
+            g[v].push_back(random_edge);
+        }
+    }
+    return g;
+}
+
+struct vertex_distance
+{
+    vertex_distance(int vertex, int distance):
+        vertex(vertex), distance(distance)
+    {}
+
+    int vertex;
+    int distance;
+};
+
+// heaps are max-heaps: the vertex with the shortest distance has the highest priority
+struct shorter_distance
+{
+    bool operator()(vertex_distance const & lhs, vertex_distance const & rhs) const
+    {
+        return lhs.distance > rhs.distance;
+    }
+};
+
+struct dijkstra_result
+{
+    double time;
+    long long checksum;
+    int decrease_keys;
+};
+
+template <typename pri_queue>
+dijkstra_result run_dijkstra(graph const & g)
+{
+    typedef typename pri_queue::handle_type handle_type;
+
+    enum { unseen, queued, done };
+
+    const int vertices = static_cast<int>(g.size());
+    vector<int> distance(vertices, INT_MAX);
+    vector<handle_type> handles(vertices);
+    vector<char> state(vertices, unseen);
+
+    boost::high_resolution_timer timer;
+    int decrease_keys = 0;
+
+    pri_queue q;
+    distance[0] = 0;
+    handles[0] = q.push(vertex_distance(0, 0));
+    state[0] = queued;
+
+    while (!q.empty()) {
+        const vertex_distance u = q.top();
+        q.pop();
+        state[u.vertex] = done;
+
+        for (size_t i = 0; i != g[u.vertex].size(); ++i) {
+            edge const & e = g[u.vertex][i];
+            const int d = u.distance + e.weight;
+            if (d >= distance[e.target] || state[e.target] == done)
+                continue;
+
+            distance[e.target] = d;
+            if (state[e.target] == queued) {
+                q.increase(handles[e.target], vertex_distance(e.target, d));
+                ++decrease_keys;
+            } else {
+                handles[e.target] = q.push(vertex_distance(e.target, d));
+                state[e.target] = queued;
+            }
+        }
+    }
+
+    dijkstra_result result;
+    result.time = timer.elapsed();
+    result.checksum = 0;
+    for (int v = 0; v != vertices; ++v)
+        result.checksum += distance[v];
+    result.decrease_keys = decrease_keys;
+    return result;
+}
+
+template <typename pri_queue>
+void run_benchmark(graph const & g, long long & checksum)
+{
+    dijkstra_result result = run_dijkstra<pri_queue>(g);
+    if (checksum == 0)
+        checksum = result.checksum;
+    else if (checksum != result.checksum)
+        cerr << "distance mismatch" << endl;
+    cout << result.time << '\t';
+}
+
+int main()
+{
+    typedef boost::heap::compare<shorter_distance> cmp;
+
+    cout << fixed << setprecision(6);
+    cout << "vertices\tdegree\tdecrease-keys\td_ary<2>\td_ary<4>\td_ary<8>\td_ary<cache aligned>\t"
+            "pairing\tfibonacci\tbinomial" << endl;
+
+    for (int i = 12; i != 21; i += 2) {
+        for (int degree = 4; degree <= 16; degree *= 2) {
+            const int vertices = 1<<i;
+            graph g = make_graph(vertices, degree);
+
+            long long checksum = 0;
+            dijkstra_result reference =
+                run_dijkstra<boost::heap::d_ary_heap<vertex_distance, cmp, boost::heap::arity<2>, boost::heap::mutable_<true> > >(g);
+
+            cout << vertices << '\t' << degree << '\t' << reference.decrease_keys << '\t';
+            run_benchmark<boost::heap::d_ary_heap<vertex_distance, cmp, boost::heap::arity<2>, boost::heap::mutable_<true> > >(g, checksum);
+            run_benchmark<boost::heap::d_ary_heap<vertex_distance, cmp, boost::heap::arity<4>, boost::heap::mutable_<true> > >(g, checksum);
+            run_benchmark<boost::heap::d_ary_heap<vertex_distance, cmp, boost::heap::arity<8>, boost::heap::mutable_<true> > >(g, checksum);
+            run_benchmark<boost::heap::d_ary_heap<vertex_distance, cmp, boost::heap::cache_aligned_arity<void*>, boost::heap::mutable_<true> > >(g, checksum);
+            run_benchmark<boost::heap::pairing_heap<vertex_distance, cmp> >(g, checksum);
+            run_benchmark<boost::heap::fibonacci_heap<vertex_distance, cmp> >(g, checksum);
+            run_benchmark<boost::heap::binomial_heap<vertex_distance, cmp> >(g, checksum);
+            cout << endl;
+        }
+    }
+}
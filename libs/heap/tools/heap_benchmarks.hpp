@@ -147,6 +147,84 @@ struct run_sequential_pop
 
 DEFINE_BENCHMARKS_SELECTOR(sequential_pop)
 
+template <typename pri_queue>
+struct run_push_range
+{
+    run_push_range(int size):
+        size(size)
+    {}
+
+    void prepare(int index)
+    {
+        q.clear();
+        q.reserve(size);
+    }
+
+    no_inline void operator()(int index)
+    {
+        test_data const & data = get_data(index);
+
+        q.push_range(data.begin(), data.begin() + size);
+    }
+
+    pri_queue q;
+    int size;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(push_range)
+
+template <typename pri_queue>
+struct run_push_loop
+{
+    run_push_loop(int size):
+        size(size)
+    {}
+
+    void prepare(int index)
+    {
+        q.clear();
+        q.reserve(size);
+    }
+
+    no_inline void operator()(int index)
+    {
+        test_data const & data = get_data(index);
+
+        for (int i = 0; i != size; ++i)
+            q.push(data[i]);
+    }
+
+    pri_queue q;
+    int size;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(push_loop)
+
+template <typename pri_queue>
+struct run_pop_n
+{
+    run_pop_n(int size):
+        size(size), out(16)
+    {}
+
+    void prepare(int index)
+    {
+        q.clear();
+        fill_heap(q, index, size);
+    }
+
+    no_inline void operator()(int index)
+    {
+        q.pop_n(16, out.begin());
+    }
+
+    pri_queue q;
+    int size;
+    std::vector<long> out;
+};
+
+DEFINE_BENCHMARKS_SELECTOR(pop_n)
+
 template <typename pri_queue>
 struct run_sequential_increase
 {
@@ -224,6 +224,52 @@ void run_benchmarks_mutable(void)
     }
 }
 
+template <typename benchmark_selector>
+void run_benchmarks_d_ary(void)
+{
+    for (int i = 4; i != max_data; ++i) {
+        int size = 1<<i;
+
+        cout << size << "\t";
+        {
+            typedef typename benchmark_selector::
+                template rebind<boost::heap::d_ary_heap<long, boost::heap::arity<2> > >
+                ::type benchmark_functor;
+            benchmark_functor benchmark(size);
+            double result = run_benchmark(benchmark);
+            cout << result << '\t';
+        }
+
+        {
+            typedef typename benchmark_selector::
+                template rebind<boost::heap::d_ary_heap<long, boost::heap::arity<4> > >
+                ::type benchmark_functor;
+            benchmark_functor benchmark(size);
+            double result = run_benchmark(benchmark);
+            cout << result << '\t';
+        }
+
+        {
+            typedef typename benchmark_selector::
+                template rebind<boost::heap::d_ary_heap<long, boost::heap::cache_aligned_arity<long> > >
+                ::type benchmark_functor;
+            benchmark_functor benchmark(size);
+            double result = run_benchmark(benchmark);
+            cout << result << '\t';
+        }
+
+        {
+            typedef typename benchmark_selector::
+                template rebind<boost::heap::d_ary_heap<long, boost::heap::cache_aligned_arity<void*>, boost::heap::mutable_<true> > >
+                ::type benchmark_functor;
+            benchmark_functor benchmark(size);
+            double result = run_benchmark(benchmark);
+            cout << result << '\t';
+        }
+        cout << endl;
+    }
+}
+
 int main()
 {
     cout << fixed << setprecision(12);
@@ -245,4 +291,13 @@ int main()
 
     cout << endl << "equivalence" << endl;
     run_benchmarks_immutable<make_equivalence>();
+
+    cout << endl << "d-ary heaps: push loop" << endl;
+    run_benchmarks_d_ary<make_push_loop>();
+
+    cout << endl << "d-ary heaps: push_range" << endl;
+    run_benchmarks_d_ary<make_push_range>();
+
+    cout << endl << "d-ary heaps: pop_n" << endl;
+    run_benchmarks_d_ary<make_pop_n>();
 }
@@ -0,0 +1,230 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Ion Gaztanaga 2007-2012
+//
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/intrusive for documentation.
+//
+/////////////////////////////////////////////////////////////////////////////
+#include <boost/intrusive/detail/config_begin.hpp>
+#include <boost/intrusive/skiplist_set.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+using namespace boost::intrusive;
+
+class MyClass
+   :  public skiplist_set_base_hook<>
+{
+   public:
+   int int_;
+   skiplist_set_member_hook<link_mode<normal_link>, max_height<6> > member_hook_;
+
+   MyClass(int i = 0)
+      :  int_(i)
+   {}
+
+   friend bool operator<(const MyClass &l, const MyClass &r)
+   {  return l.int_ < r.int_;  }
+};
+
+struct int_compare
+{
+   bool operator()(int i, const MyClass &v) const
+   {  return i < v.int_;  }
+
+   bool operator()(const MyClass &v, int i) const
+   {  return v.int_ < i;  }
+};
+
+typedef skiplist_set<MyClass>                                        base_set_t;
+typedef skiplist_multiset<MyClass, constant_time_size<true> >        base_multiset_t;
+typedef member_hook
+   < MyClass
+   , skiplist_set_member_hook<link_mode<normal_link>, max_height<6> >
+   , &MyClass::member_hook_>                                         member_option;
+typedef skiplist_multiset<MyClass, member_option>                    member_multiset_t;
+
+template<class Container>
+bool is_sorted(const Container &c)
+{
+   typename Container::const_iterator it = c.begin(), itend = c.end(), prev;
+   if(it == itend)
+      return true;
+   for(prev = it++; it != itend; prev = it++){
+      if(*it < *prev)
+         return false;
+   }
+   return true;
+}
+
+void test_sequential()
+{
+   const int NumValues = 1000;
+   std::vector<MyClass> values;
+   for(int i = 0; i < NumValues; ++i)
+      values.push_back(MyClass((i * 7919) % NumValues));
+
+   base_set_t s;
+   BOOST_TEST(s.empty());
+   s.insert(values.begin(), values.end());
+   BOOST_TEST(s.size() == std::size_t(NumValues));
+   BOOST_TEST(is_sorted(s));
+   for(int i = 0; i < NumValues; ++i){
+      BOOST_TEST(s.find(MyClass(i)) != s.end());
+      BOOST_TEST(s.find(i, int_compare())->int_ == i);
+      BOOST_TEST(values[i].is_linked());
+   }
+   BOOST_TEST(s.find(NumValues, int_compare()) == s.end());
+   BOOST_TEST(s.lower_bound(-1, int_compare())->int_ == 0);
+   BOOST_TEST(s.upper_bound(NumValues - 1, int_compare()) == s.end());
+
+   //Duplicates are rejected
+   MyClass dup(10);
+   std::pair<base_set_t::iterator, bool> ret = s.insert(dup);
+   BOOST_TEST(!ret.second);
+   BOOST_TEST(&*ret.first != &dup && ret.first->int_ == 10);
+   BOOST_TEST(!dup.is_linked());
+
+   //Erase even values
+   for(int i = 0; i < NumValues; i += 2){
+      BOOST_TEST(s.erase(i, int_compare()) == 1u);
+   }
+   BOOST_TEST(s.size() == std::size_t(NumValues/2));
+   BOOST_TEST(is_sorted(s));
+   for(int i = 0; i < NumValues; ++i){
+      BOOST_TEST((s.count(i, int_compare()) == 1u) == (i % 2 == 1));
+   }
+   s.erase(s.iterator_to(values[1]));
+   BOOST_TEST(!values[1].is_linked());
+   s.clear();
+   BOOST_TEST(s.empty());
+   for(int i = 0; i < NumValues; ++i){
+      BOOST_TEST(!values[i].is_linked());
+   }
+}
+
+void test_multiset()
+{
+   const int NumValues = 300;
+   std::vector<MyClass> values;
+   for(int i = 0; i < NumValues; ++i)
+      values.push_back(MyClass(i % 10));
+
+   base_multiset_t ms(values.begin(), values.end());
+   member_multiset_t mms(values.begin(), values.end());
+   BOOST_TEST(ms.size() == std::size_t(NumValues));
+   BOOST_TEST(mms.size() == std::size_t(NumValues));
+   BOOST_TEST(is_sorted(ms));
+   BOOST_TEST(is_sorted(mms));
+   for(int i = 0; i < 10; ++i){
+      BOOST_TEST(ms.count(MyClass(i)) == std::size_t(NumValues/10));
+      BOOST_TEST(mms.count(i, int_compare()) == std::size_t(NumValues/10));
+   }
+
+   //Erase one of several equivalent values
+   ms.erase(ms.iterator_to(values[15]));
+   BOOST_TEST(ms.count(MyClass(5)) == std::size_t(NumValues/10 - 1));
+   BOOST_TEST(ms.size() == std::size_t(NumValues - 1));
+   BOOST_TEST(ms.erase(MyClass(5)) == std::size_t(NumValues/10 - 1));
+   BOOST_TEST(ms.size() == std::size_t(NumValues - NumValues/10));
+   BOOST_TEST(is_sorted(ms));
+   ms.clear();
+   mms.clear();
+}
+
+template<class Container>
+void insert_range(Container &c, std::vector<MyClass> &values, std::size_t first, std::size_t stride)
+{
+   for(std::size_t i = first; i < values.size(); i += stride){
+      c.insert(values[i]);
+      //The value must be visible as soon as it's inserted
+      BOOST_TEST(c.find(values[i]) != c.end());
+   }
+}
+
+void test_concurrent()
+{
+   const std::size_t NumThreads = 4;
+   const int NumValues = 20000;
+
+   //Each thread inserts an interleaved slice of the values
+   std::vector<MyClass> values;
+   for(int i = 0; i < NumValues; ++i)
+      values.push_back(MyClass((i * 7919) % NumValues));
+
+   {
+      base_set_t s;
+      boost::thread_group threads;
+      for(std::size_t t = 0; t < NumThreads; ++t){
+         threads.create_thread(boost::bind
+            (&insert_range<base_set_t>, boost::ref(s), boost::ref(values), t, NumThreads));
+      }
+      threads.join_all();
+      BOOST_TEST(s.size() == std::size_t(NumValues));
+      BOOST_TEST(is_sorted(s));
+      s.clear();
+   }
+   {
+      //All threads race to insert the same values: each one is inserted once
+      base_set_t s;
+      std::vector< std::vector<MyClass> > copies(NumThreads, values);
+      boost::thread_group threads;
+      for(std::size_t t = 0; t < NumThreads; ++t){
+         threads.create_thread(boost::bind
+            (&insert_range<base_set_t>, boost::ref(s), boost::ref(copies[t]), 0, 1));
+      }
+      threads.join_all();
+      BOOST_TEST(s.size() == std::size_t(NumValues));
+      BOOST_TEST(is_sorted(s));
+      std::size_t linked = 0;
+      for(std::size_t t = 0; t < NumThreads; ++t){
+         for(int i = 0; i < NumValues; ++i){
+            linked += copies[t][i].is_linked();
+         }
+      }
+      BOOST_TEST(linked == std::size_t(NumValues));
+      s.clear();
+   }
+   {
+      base_multiset_t ms;
+      std::vector< std::vector<MyClass> > copies(NumThreads, values);
+      boost::thread_group threads;
+      for(std::size_t t = 0; t < NumThreads; ++t){
+         threads.create_thread(boost::bind
+            (&insert_range<base_multiset_t>, boost::ref(ms), boost::ref(copies[t]), 0, 1));
+      }
+      threads.join_all();
+      BOOST_TEST(ms.size() == NumThreads*NumValues);
+      BOOST_TEST(is_sorted(ms));
+      for(int i = 0; i < NumValues; i += 97){
+         BOOST_TEST(ms.count(i, int_compare()) == NumThreads);
+      }
+      //Erase needs the same ordering at every level
+      for(std::size_t t = 0; t < NumThreads; t += 2){
+         for(int i = 0; i < NumValues; ++i){
+            ms.erase(ms.iterator_to(copies[t][i]));
+         }
+      }
+      BOOST_TEST(ms.size() == (NumThreads/2)*NumValues);
+      BOOST_TEST(is_sorted(ms));
+      ms.clear();
+   }
+}
+
+int main()
+{
+   test_sequential();
+   test_multiset();
+   test_concurrent();
+   return boost::report_errors();
+}
+
+#include <boost/intrusive/detail/config_end.hpp>
@@ -10,6 +10,7 @@
 
 #include <boost/detail/lightweight_test.hpp>
 #include "test_basic.hpp"
+#include "test_bulk_load.hpp"
 #include "test_capacity.hpp"
 #include "test_comparison.hpp"
 #include "test_composite_key.hpp"
@@ -34,6 +35,7 @@
 int main()
 {
   test_basic();
+  test_bulk_load();
   test_capacity();
   test_comparison();
   test_composite_key();
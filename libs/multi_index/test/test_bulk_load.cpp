@@ -0,0 +1,136 @@
+/* Boost.MultiIndex test for bulk loading.
+ *
+ * Copyright 2003-2013 Joaquin M Lopez Munoz.
+ * Distributed under the Boost Software License, Version 1.0.
+ * (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * See http://www.boost.org/libs/multi_index for library home page.
+ */
+
+#include "test_bulk_load.hpp"
+
+#include <boost/config.hpp> /* keep it first to prevent nasty warns in MSVC */
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <vector>
+#include "pre_multi_index.hpp"
+#include "employee.hpp"
+#include <boost/multi_index/parallel_bulk_load.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+using namespace boost::multi_index;
+
+static std::vector<employee> make_employees(std::size_t n,int dup_ssn=-1)
+{
+  std::vector<employee> v;
+  for(std::size_t i=0;i<n;++i){
+    int                id=static_cast<int>((i*7919)%n);
+    std::ostringstream os;
+    os<<"emp"<<(i%13);
+    v.push_back(employee(id,os.str(),static_cast<int>(20+i%37),
+      dup_ssn>=0&&i%5==0?dup_ssn:static_cast<int>(1000+i)));
+  }
+  return v;
+}
+
+template<typename Index>
+static bool same_hashed_contents(const Index& x,const Index& y)
+{
+  if(x.size()!=y.size())return false;
+  for(typename Index::const_iterator it=x.begin(),it_end=x.end();
+      it!=it_end;++it){
+    if(x.count(x.key_extractor()(*it))!=y.count(x.key_extractor()(*it)))
+      return false;
+  }
+  return true;
+}
+
+static bool less_age(const employee& x,const employee& y)
+{
+  return x.age<y.age;
+}
+
+static bool same_age(const employee& x,const employee& y)
+{
+  return x.age==y.age;
+}
+
+/* Equivalent elements are not guaranteed to be in the same relative order
+ * when inserted one by one, so only keys are compared for the non-unique
+ * ordered index.
+ */
+
+static void test_same(const employee_set& es1,const employee_set& es2)
+{
+  BOOST_TEST(es1.size()==es2.size());
+  BOOST_TEST(get<0>(es1)==get<0>(es2));
+  BOOST_TEST(same_hashed_contents(get<1>(es1),get<1>(es2)));
+  BOOST_TEST(std::equal(
+    get<2>(es1).begin(),get<2>(es1).end(),get<2>(es2).begin(),same_age));
+  BOOST_TEST(get<3>(es1)==get<3>(es2));
+  BOOST_TEST(same_hashed_contents(get<4>(es1),get<4>(es2)));
+  BOOST_TEST(get<5>(es1)==get<5>(es2));
+}
+
+void test_bulk_load()
+{
+  /* every size up to 300 exercises all shapes of the bottom-up tree */
+
+  for(std::size_t n=0;n<=300;++n){
+    std::vector<employee> v=make_employees(n);
+    employee_set          es1(v.begin(),v.end());
+    employee_set          es2(bulk_load,v.begin(),v.end());
+    test_same(es1,es2);
+
+    /* bulk loading keeps equivalent elements in input order */
+
+    std::stable_sort(v.begin(),v.end(),less_age);
+    BOOST_TEST(std::equal(v.begin(),v.end(),get<2>(es2).begin()));
+  }
+
+  {
+    /* duplicate ids and ssn's: falls back to element-by-element insertion */
+
+    std::vector<employee> v=make_employees(50,2000);
+    v.push_back(v[3]);
+    employee_set          es1(v.begin(),v.end());
+    employee_set          es2(bulk_load,v.begin(),v.end());
+    test_same(es1,es2);
+    BOOST_TEST(es2.size()<v.size());
+  }
+
+  {
+    std::vector<employee> v=make_employees(10000);
+    employee_set          es1(v.begin(),v.end());
+    employee_set          es2(parallel_bulk_load,v.begin(),v.end());
+    employee_set          es3(parallel_bulk_load_t(2),v.begin(),v.end());
+    test_same(es1,es2);
+    test_same(es1,es3);
+
+    es2.insert(employee(-1,"Joe",31,-1));
+    es2.erase(es2.find(employee(5000,"",0,0)));
+    BOOST_TEST(es2.size()==es1.size());
+  }
+
+  {
+    /* input iterators are accepted */
+
+    std::istringstream             is("5 3 8 1 9 2 3 7");
+    std::istream_iterator<int>     first(is),last;
+    multi_index_container<
+      int,
+      indexed_by<
+        ordered_non_unique<identity<int> >,
+        sequenced<>
+      >
+    >                              c(bulk_load,first,last);
+    int                            sorted[]={1,2,3,3,5,7,8,9};
+    int                            seq[]={5,3,8,1,9,2,3,7};
+    BOOST_TEST(c.size()==8);
+    BOOST_TEST(std::equal(c.begin(),c.end(),&sorted[0]));
+    BOOST_TEST(std::equal(get<1>(c).begin(),get<1>(c).end(),&seq[0]));
+  }
+}
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Sebastian Redl
+//
+// Distributed under the Boost Software License, Version 1.0. 
+// (See accompanying file LICENSE_1_0.txt or copy at 
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see www.boost.org
+// ----------------------------------------------------------------------------
+
+// Measures how fast JSON is read: into a property tree, into a property tree
+// keeping only part of the data, and with a handler which only counts what
+// it is given.
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <ctime>
+
+using namespace std;
+using namespace boost::property_tree;
+
+string make_json(int records)
+{
+    ostringstream out;
+    out << "{\"records\": [\n";
+    for (int i = 0; i < records; ++i)
+    {
+        if (i)
+            out << ",\n";
+        out << "  {\"id\": " << i << ", \"name\": \"record number " << i
+            << "\", \"value\": " << i * 0.25 << "e+3, \"active\": "
+            << (i % 2 ? "true" : "false")
+            << ", \"tags\": [\"alpha\", \"beta\\n\", null],"
+            << " \"nested\": {\"x\": -" << i << ", \"y\": \"\\u0041bc\"}}";
+    }
+    out << "\n]}\n";
+    return out.str();
+}
+
+struct counter
+{
+    long n;
+    counter(): n(0) { }
+    bool begin_object() { return true; }
+    void end_object() { }
+    bool begin_array() { return true; }
+    void end_array() { }
+    bool member(const string &) { ++n; return true; }
+    void string_value(const string &) { ++n; }
+    void number_value(const string &) { ++n; }
+    void boolean_value(bool) { ++n; }
+    void null_value() { ++n; }
+};
+
+// Keeps only the names of the records
+struct names_only
+{
+    bool operator()(const string &path) const
+    {
+        return path == "records" || path == "records.name";
+    }
+};
+
+template<class Read>
+void clock_read(const char *what, const string &json, Read read)
+{
+    int n = 0;
+    clock_t t1 = clock(), t2;
+    do
+    {
+        istringstream stream(json);
+        read(stream);
+        t2 = clock();
+        ++n;
+    } while (t2 - t1 < 2 * CLOCKS_PER_SEC);
+
+    double seconds = double(t2 - t1) / CLOCKS_PER_SEC / n;
+    cout << "  " << what << ": " << seconds * 1000 << " ms, "
+         << json.size() / seconds / (1024 * 1024) << " MB/s\n";
+}
+
+void read_ptree(istream &stream)
+{
+    ptree pt;
+    read_json(stream, pt);
+}
+
+void read_flat(istream &stream)
+{
+    flat_ptree pt;
+    read_json(stream, pt);
+}
+
+void read_names(istream &stream)
+{
+    ptree pt;
+    read_json(stream, pt, names_only());
+}
+
+void count_events(istream &stream)
+{
+    counter c;
+    parse_json(stream, c);
+}
+
+int main()
+{
+    string json = make_json(100000);
+    cout << "Reading " << json.size() / (1024 * 1024) << " MB of JSON\n";
+    clock_read("read_json", json, read_ptree);
+    clock_read("read_json, flat_ptree", json, read_flat);
+    clock_read("read_json, names only", json, read_names);
+    clock_read("parse_json", json, count_events);
+}
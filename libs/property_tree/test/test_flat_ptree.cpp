@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Sebastian Redl
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see www.boost.org
+// ----------------------------------------------------------------------------
+
+#include <boost/test/minimal.hpp>
+#include <boost/property_tree/flat_ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <sstream>
+#include <string>
+
+using namespace boost::property_tree;
+
+const char *json_data =
+    "{\n"
+    "  \"name\": \"server\",\n"
+    "  \"port\": 8080,\n"
+    "  \"debug\": true,\n"
+    "  \"proxy\": null,\n"
+    "  \"ratio\": 0.25,\n"
+    "  \"paths\": [\"/a\", \"/b\", {\"c\": \"d\"}],\n"
+    "  \"limits\": {\"soft\": 10, \"hard\": 20, \"soft\": 30},\n"
+    "  \"empty\": {}\n"
+    "}\n";
+
+// Checks that a flat tree and a property tree hold the same nodes, in the
+// same order
+void check_same(const flat_ptree &flat, const ptree &pt)
+{
+    BOOST_CHECK(flat.data() == pt.data());
+    BOOST_CHECK(flat.size() == pt.size());
+    BOOST_CHECK(flat.empty() == pt.empty());
+    if (flat.size() != pt.size())
+        return;
+    flat_ptree::const_iterator i = flat.begin();
+    for (ptree::const_iterator j = pt.begin(); j != pt.end(); ++i, ++j)
+    {
+        BOOST_CHECK(i->first == j->first);
+        check_same(i->second, j->second);
+    }
+    BOOST_CHECK(i == flat.end());
+}
+
+void test_read_json()
+{
+    std::istringstream stream(json_data);
+    flat_ptree flat;
+    read_json(stream, flat);
+    stream.clear();
+    stream.seekg(0);
+    ptree pt;
+    read_json(stream, pt);
+    check_same(flat, pt);
+    BOOST_CHECK(flat == flat_ptree(pt));
+
+    BOOST_CHECK(flat.get<std::string>("name") == "server");
+    BOOST_CHECK(flat.get<int>("port") == 8080);
+    BOOST_CHECK(flat.get<bool>("debug") == true);
+    BOOST_CHECK(flat.get<std::string>("proxy") == "null");
+    BOOST_CHECK(flat.get<double>("ratio") == 0.25);
+    BOOST_CHECK(flat.get_child("paths").size() == 3);
+    BOOST_CHECK(flat.get_child("paths").begin()->first.empty());
+    BOOST_CHECK((flat.get_child("paths").begin() + 2)->second.get<std::string>("c") == "d");
+    BOOST_CHECK(flat.get<int>("limits.soft") == 10);
+    BOOST_CHECK(flat.get_child("limits").count("soft") == 2);
+    BOOST_CHECK(flat.get_child("limits").count("none") == 0);
+    BOOST_CHECK(flat.get_child("empty").empty());
+    BOOST_CHECK(flat.get_child("empty").data().empty());
+
+    // Errors leave the tree unchanged
+    std::istringstream bad("{\"a\": 1,}");
+    try
+    {
+        read_json(bad, flat);
+        BOOST_ERROR("No required exception thrown");
+    }
+    catch (json_parser_error &)
+    {
+    }
+    BOOST_CHECK(flat.get<int>("port") == 8080);
+}
+
+void test_get()
+{
+    std::istringstream stream(json_data);
+    flat_ptree flat;
+    read_json(stream, flat);
+
+    BOOST_CHECK(flat.get("port", 0) == 8080);
+    BOOST_CHECK(flat.get("missing", 42) == 42);
+    BOOST_CHECK(flat.get("name", 0) == 0);
+    BOOST_CHECK(flat.get("missing", "x") == "x");
+    BOOST_CHECK(flat.get("name", "x") == "server");
+    BOOST_CHECK(flat.get_optional<int>("port").get() == 8080);
+    BOOST_CHECK(!flat.get_optional<int>("name"));
+    BOOST_CHECK(!flat.get_optional<int>("limits.none"));
+    BOOST_CHECK(!flat.get_child_optional("name.x"));
+    BOOST_CHECK(flat.get_child("missing", flat).size() == flat.size());
+    BOOST_CHECK(flat.get_child("port").get_value<int>() == 8080);
+    BOOST_CHECK(flat.get_child("port").get_value(0) == 8080);
+    BOOST_CHECK(flat.get_child("name").get_value("x") == "server");
+    BOOST_CHECK(flat.find("port") != flat.end());
+    BOOST_CHECK(flat.find("none") == flat.end());
+    BOOST_CHECK(flat.end() - flat.begin() == 8);
+
+    try
+    {
+        flat.get<int>("missing");
+        BOOST_ERROR("No required exception thrown");
+    }
+    catch (ptree_bad_path &)
+    {
+    }
+    try
+    {
+        flat.get<int>("name");
+        BOOST_ERROR("No required exception thrown");
+    }
+    catch (ptree_bad_data &)
+    {
+    }
+}
+
+void test_lifetime()
+{
+    // Children and their data stay valid after the root handle is gone
+    flat_ptree limits;
+    boost::string_ref name;
+    {
+        std::istringstream stream(json_data);
+        flat_ptree flat;
+        read_json(stream, flat);
+        limits = flat.get_child("limits");
+        name = flat.get_child("name").data();
+    }
+    BOOST_CHECK(limits.get<int>("hard") == 20);
+    BOOST_CHECK(name == "server");
+
+    flat_ptree empty;
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK(empty.data().empty());
+    BOOST_CHECK(empty.begin() == empty.end());
+    swap(empty, limits);
+    BOOST_CHECK(limits.empty());
+    BOOST_CHECK(empty.size() == 3);
+}
+
+void test_from_ptree()
+{
+    std::istringstream stream(
+        "<config version=\"2\"><server>a</server><server>b</server>"
+        "<timeout>5</timeout></config>");
+    ptree pt;
+    read_xml(stream, pt);
+    flat_ptree flat(pt);
+    check_same(flat, pt);
+    BOOST_CHECK(flat.get<int>("config.<xmlattr>.version") == 2);
+    BOOST_CHECK(flat.get<int>("config.timeout") == 5);
+    BOOST_CHECK(flat.get_child("config").count("server") == 2);
+
+    flat_ptree::builder b;
+    b.data("root");
+    b.open("a");
+    b.data("1");
+    b.open("b");
+    b.close();
+    b.close();
+    b.open("a");
+    b.data("2");
+    flat_ptree built;
+    b.finish(built);
+    BOOST_CHECK(built.data() == "root");
+    BOOST_CHECK(built.size() == 2);
+    BOOST_CHECK(built.get<int>("a") == 1);
+    BOOST_CHECK(built.get_child("a").size() == 1);
+    BOOST_CHECK((++built.begin())->second.get_value<int>() == 2);
+}
+
+#ifndef BOOST_NO_CWCHAR
+void test_wide()
+{
+    std::wistringstream stream(L"{\"k\": [\"\\u00e9\", 2]}");
+    wflat_ptree flat;
+    read_json(stream, flat);
+    BOOST_CHECK(flat.get_child(L"k").size() == 2);
+    BOOST_CHECK(flat.get_child(L"k").begin()->second.data() == L"\x00e9");
+    BOOST_CHECK((++flat.get_child(L"k").begin())->second.get_value<int>() == 2);
+}
+#endif
+
+int test_main(int, char *[])
+{
+    test_read_json();
+    test_get();
+    test_lifetime();
+    test_from_ptree();
+#ifndef BOOST_NO_CWCHAR
+    test_wide();
+#endif
+    return 0;
+}
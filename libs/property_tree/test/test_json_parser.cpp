@@ -10,6 +10,7 @@
 
 #include "test_utils.hpp"
 #include <boost/property_tree/json_parser.hpp>
+#include <sstream>
 
 ///////////////////////////////////////////////////////////////////////////////
 // Test data
@@ -380,9 +381,107 @@ void test_json_parser()
 
 }
 
+// Records the events reported by parse_json, and skips the members
+// named "skip" and arrays starting within them
+struct event_recorder
+{
+    std::string events;
+    bool begin_object() { events += "{"; return true; }
+    void end_object() { events += "}"; }
+    bool begin_array() { events += "["; return true; }
+    void end_array() { events += "]"; }
+    bool member(const std::string &name)
+    {
+        events += name + ":";
+        return name != "skip";
+    }
+    void string_value(const std::string &s) { events += "s(" + s + ")"; }
+    void number_value(const std::string &s) { events += "n(" + s + ")"; }
+    void boolean_value(bool b) { events += b ? "true" : "false"; }
+    void null_value() { events += "null"; }
+};
+
+void test_parse_json()
+{
+    using namespace boost::property_tree;
+
+    std::istringstream stream(
+        "{\"a\": [1, -2.5e+3, \"x\" /* c */ \"y\", true, false, null],\n"
+        " \"skip\": {\"b\": [1, {\"c\": 2}]}, // comment\n"
+        " \"d\\u0041\": {}, \"e\": []}");
+    event_recorder r;
+    parse_json(stream, r);
+    BOOST_CHECK(r.events ==
+        "{a:[n(1)n(-2.5e+3)s(xy)truefalsenull]skip:dA:{}e:[]}");
+
+    // Errors inside skipped values are still found, on the right line
+    std::istringstream bad("{\"skip\":\n[1,\n\"x\" 2]}");
+    event_recorder r2;
+    try
+    {
+        parse_json(bad, r2);
+        BOOST_ERROR("No required exception thrown");
+    }
+    catch (json_parser_error &e)
+    {
+        BOOST_CHECK(e.line() == 3);
+    }
+    catch (...)
+    {
+        BOOST_ERROR("Wrong exception type thrown");
+    }
+
+    static const char *const bad_data[] =
+    {
+        "{\"a\":\"b}", "{\"a\":01}", "{\"a\":1.}", "{\"a\":tru}",
+        "{\"a\":\"\\x\"}", "{\"a\":\"\\u12g4\"}", "{/* }", "{} x", "[1,]"
+    };
+    for (std::size_t i = 0; i < sizeof(bad_data) / sizeof(bad_data[0]); ++i)
+    {
+        std::istringstream in(bad_data[i]);
+        event_recorder r3;
+        try
+        {
+            parse_json(in, r3);
+            BOOST_ERROR("No required exception thrown");
+        }
+        catch (json_parser_error &)
+        {
+        }
+    }
+}
+
+// Keeps everything except "b" and whatever is inside it
+struct not_b
+{
+    bool operator()(const std::string &path) const
+    {
+        return path != "a.b";
+    }
+};
+
+void test_read_json_filtered()
+{
+    using namespace boost::property_tree;
+
+    std::istringstream stream(
+        "{\"a\": [{\"b\": {\"c\": 1}, \"d\": 2}, {\"b\": 3}],"
+        " \"b\": 4, \"e\": {\"b\": 5}}");
+    ptree pt;
+    read_json(stream, pt, not_b());
+    BOOST_CHECK(pt.get_child("a").size() == 2);
+    BOOST_CHECK(pt.get_child("a").front().second.size() == 1);
+    BOOST_CHECK(pt.get_child("a").front().second.get<int>("d") == 2);
+    BOOST_CHECK(pt.get_child("a").back().second.empty());
+    BOOST_CHECK(pt.get<int>("b") == 4);
+    BOOST_CHECK(pt.get<int>("e.b") == 5);
+}
+
 int test_main(int argc, char *argv[])
 {
     using namespace boost::property_tree;
+    test_parse_json();
+    test_read_json_filtered();
     test_json_parser<ptree>();
     test_json_parser<iptree>();
 #ifndef BOOST_NO_CWCHAR
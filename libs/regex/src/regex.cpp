@@ -191,10 +191,24 @@ BOOST_REGEX_DECL void BOOST_REGEX_CALL put_mem_block(void* p)
 
 #else
 
-#ifdef BOOST_HAS_THREADS
-mem_block_cache block_cache = { 0, 0, BOOST_STATIC_MUTEX_INIT, };
+#if defined(BOOST_REGEX_THREAD_BLOCK_CACHE)
+mem_block_cache block_cache = { PTHREAD_ONCE_INIT, false, };
+
+extern "C" void free_thread_block_list(void* p)
+{
+   mem_block_list* l = static_cast<mem_block_list*>(p);
+   l->clear();
+   delete l;
+}
+
+extern "C" void create_thread_block_key()
+{
+   block_cache.has_key = (pthread_key_create(&block_cache.key, &free_thread_block_list) == 0);
+}
+#elif defined(BOOST_HAS_THREADS)
+mem_block_cache block_cache = { { 0, 0, 0, 0, }, BOOST_STATIC_MUTEX_INIT, };
 #else
-mem_block_cache block_cache = { 0, 0, };
+mem_block_cache block_cache = { { 0, 0, 0, 0, }, };
 #endif
 
 BOOST_REGEX_DECL void* BOOST_REGEX_CALL get_mem_block()
@@ -213,7 +227,19 @@ BOOST_REGEX_DECL void BOOST_REGEX_CALL put_mem_block(void* p)
 
 } // namespace re_detail
 
+#if defined(BOOST_REGEX_NON_RECURSIVE) && !defined(BOOST_REGEX_V3)
+
+BOOST_REGEX_DECL regex_block_cache_statistics BOOST_REGEX_CALL get_regex_block_cache_statistics()
+{
+#if BOOST_REGEX_MAX_CACHE_BLOCKS == 0
+   regex_block_cache_statistics result = { 0, 0 };
+   return result;
+#else
+   return re_detail::block_cache.statistics();
+#endif
+}
 
+#endif
 
 } // namespace boost
 
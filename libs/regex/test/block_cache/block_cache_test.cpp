@@ -0,0 +1,115 @@
+/*
+ *
+ * Copyright (c) 2013
+ * John Maddock
+ *
+ * Use, modification and distribution are subject to the 
+ * Boost Software License, Version 1.0. (See accompanying file 
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+ 
+ /*
+  *   LOCATION:    see http://www.boost.org for most recent version.
+  *   FILE         block_cache_test.cpp
+  *   VERSION      see <boost/version.hpp>
+  *   DESCRIPTION: Checks the memory block cache and the lazy DFA when
+  *                many threads search at once.
+  */
+
+#include <iostream>
+#include <list>
+#include <string>
+#include <boost/regex.hpp>
+#include <boost/regex/pending/static_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/shared_ptr.hpp>
+
+//
+// we cannot use the regular Boost.Test in here: it is not thread safe.
+//
+#define BOOST_TEST(pred) if(!(pred)) failed_test(__FILE__, __LINE__, BOOST_STRINGIZE(pred));
+
+int total_failures = 0;
+void failed_test(const char* file, int line, const char* pred)
+{
+   static boost::static_mutex mut = BOOST_STATIC_MUTEX_INIT ;
+   boost::static_mutex::scoped_lock guard(mut);
+   ++total_failures;
+   std::cout << "Failed test in \"" << file << "\" at line " << line << ": " << pred << std::endl;
+}
+
+const int cycles = 20000;
+
+// back-references mean this uses the backtracking matcher and its memory blocks:
+const boost::regex backref("(\\w+) \\1");
+// while this one is searched for with the lazy DFA shared by all the threads:
+const boost::regex dfa("(\\w+)@(\\w+)\\.com");
+
+const std::string text("one two three three four me@example.com five");
+
+void thread_proc()
+{
+#if defined(BOOST_REGEX_NON_RECURSIVE) && defined(BOOST_REGEX_THREAD_BLOCK_CACHE)
+   boost::regex_block_cache_statistics start = boost::get_regex_block_cache_statistics();
+   // each thread starts with an empty cache of its own:
+   BOOST_TEST(start.hits == 0);
+   BOOST_TEST(start.misses == 0);
+#endif
+   boost::smatch what;
+   for(int i = 0; i < cycles; ++i)
+   {
+      BOOST_TEST(boost::regex_search(text, what, backref));
+      BOOST_TEST(what.position() == 8);
+      BOOST_TEST(boost::regex_search(text, what, dfa));
+      BOOST_TEST(what.position() == 25);
+      BOOST_TEST(what.str(2) == "example");
+   }
+#if defined(BOOST_REGEX_NON_RECURSIVE) && defined(BOOST_REGEX_THREAD_BLOCK_CACHE)
+   boost::regex_block_cache_statistics finish = boost::get_regex_block_cache_statistics();
+   // almost every block comes from the cache:
+   BOOST_TEST(finish.hits + finish.misses >= static_cast<unsigned long>(cycles));
+   BOOST_TEST(finish.misses < 10);
+#endif
+}
+
+void test_statistics()
+{
+#if defined(BOOST_REGEX_NON_RECURSIVE) && (BOOST_REGEX_MAX_CACHE_BLOCKS > 0)
+   boost::smatch what;
+   boost::regex_block_cache_statistics s0 = boost::get_regex_block_cache_statistics();
+   BOOST_TEST(boost::regex_search(text, what, backref));
+   boost::regex_block_cache_statistics s1 = boost::get_regex_block_cache_statistics();
+   BOOST_TEST(s1.hits + s1.misses > s0.hits + s0.misses);
+   // the block used by the last search is reused by the next:
+   BOOST_TEST(boost::regex_search(text, what, backref));
+   boost::regex_block_cache_statistics s2 = boost::get_regex_block_cache_statistics();
+   BOOST_TEST(s2.hits > s1.hits);
+   BOOST_TEST(s2.misses == s1.misses);
+#endif
+}
+
+int main()
+{
+   test_statistics();
+
+   std::list<boost::shared_ptr<boost::thread> > threads;
+   for(int i = 0; i < 8; ++i)
+   {
+      try{
+         threads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(&thread_proc)));
+      }
+      catch(const std::exception& e)
+      {
+         std::cerr << "<note>Thread creation failed with message: " << e.what() << "</note>" << std::endl;
+      }
+   }
+   std::list<boost::shared_ptr<boost::thread> >::const_iterator a(threads.begin()), b(threads.end());
+   while(a != b)
+   {
+      (*a)->join();
+      ++a;
+   }
+
+   return total_failures;
+}
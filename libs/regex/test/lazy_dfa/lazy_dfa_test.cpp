@@ -0,0 +1,331 @@
+/*
+ *
+ * Copyright (c) 2013
+ * John Maddock
+ *
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+ /*
+  *   LOCATION:    see http://www.boost.org for most recent version.
+  *   FILE         lazy_dfa_test.cpp
+  *   VERSION      see <boost/version.hpp>
+  *   DESCRIPTION: Checks that searches using the lazy DFA find the same
+  *                matches as the backtracking matcher.
+  */
+
+#include <string>
+#include <list>
+#include <iostream>
+#include <cstdio>
+#include <boost/regex.hpp>
+#include <boost/test/test_tools.hpp>
+
+#ifdef BOOST_INTEL
+#pragma warning(disable:1418 981 983 383)
+#endif
+
+//
+// A simple deterministic random number generator, so that failures
+// can be reproduced:
+//
+unsigned next_random()
+{
+   static unsigned long seed = 12345;
+   seed = (seed * 1103515245uL + 12345uL) & 0x7fffffffuL;
+   return static_cast<unsigned>(seed >> 16);
+}
+
+unsigned random_index(unsigned n)
+{
+   return next_random() % n;
+}
+
+std::string random_atom(int depth, bool& can_repeat);
+
+std::string random_sequence(int depth)
+{
+   std::string result;
+   unsigned n = 1 + random_index(3);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      bool can_repeat;
+      std::string atom = random_atom(depth, can_repeat);
+      if(can_repeat && (random_index(3) == 0))
+      {
+         static const char* const repeats[] =
+         { "*", "+", "?", "{2}", "{1,2}", "{0,3}", "{2,}", "*?", "+?", "??", "{1,3}?" };
+         atom += repeats[random_index(sizeof(repeats) / sizeof(repeats[0]))];
+      }
+      result += atom;
+   }
+   return result;
+}
+
+std::string random_expression(int depth)
+{
+   std::string result = random_sequence(depth);
+   while(random_index(4) == 0)
+   {
+      result += "|";
+      result += random_sequence(depth);
+   }
+   return result;
+}
+
+std::string random_atom(int depth, bool& can_repeat)
+{
+   static const char* const atoms[] =
+   {
+      "a", "b", "ab", "ba", "aab", ".", "[ab]", "[^a]", "\\w", "\\s", "x", " ", "(?:)", "[[:alpha:]_]"
+   };
+   static const char* const assertions[] =
+   {
+      "^", "$", "\\b", "\\B", "\\<", "\\>", "\\`", "\\'"
+   };
+   can_repeat = true;
+   if(random_index(5) == 0)
+   {
+      can_repeat = false;
+      return assertions[random_index(sizeof(assertions) / sizeof(assertions[0]))];
+   }
+   if((depth < 3) && (random_index(4) == 0))
+   {
+      if(random_index(2))
+         return "(" + random_expression(depth + 1) + ")";
+      return "(?:" + random_expression(depth + 1) + ")";
+   }
+   return atoms[random_index(sizeof(atoms) / sizeof(atoms[0]))];
+}
+
+std::string random_text()
+{
+   static const char chars[] = "aab b\nx_\r";
+   std::string result;
+   unsigned n = random_index(14);
+   for(unsigned i = 0; i < n; ++i)
+      result += chars[random_index(sizeof(chars) - 1)];
+   return result;
+}
+
+std::string describe(const boost::smatch& what)
+{
+   std::string result;
+   for(unsigned i = 0; i < what.size(); ++i)
+   {
+      if(what[i].matched)
+      {
+         char buf[50];
+         std::sprintf(buf, "(%d,%d)", static_cast<int>(what.position(i)), static_cast<int>(what.length(i)));
+         result += buf;
+      }
+      else
+         result += "(-)";
+   }
+   return result;
+}
+
+//
+// Runs the same search with e, which can use the lazy DFA, and with
+// reference, which can't:
+//
+void compare(const boost::regex& e, const boost::regex& reference, const std::string& text, boost::match_flag_type f, int offset)
+{
+   std::string::const_iterator first = text.begin() + offset;
+   boost::smatch what, expected;
+   bool result, expected_result, any, expected_any;
+   try
+   {
+      // without match results, only whether there is a match matters
+      // (the backtracking matcher can disagree with itself over that
+      // when given match_any, so the reference doesn't use it):
+      any = boost::regex_search(first, text.end(), e, f);
+      expected_any = boost::regex_search(first, text.end(), what, reference, f);
+      result = boost::regex_search(first, text.end(), what, e, f, text.begin());
+      expected_result = boost::regex_search(first, text.end(), expected, reference, f, text.begin());
+   }
+   catch(const std::runtime_error&)
+   {
+      // too complex for the backtracking matcher:
+      return;
+   }
+   BOOST_CHECK_EQUAL(result, expected_result);
+   if(result && expected_result)
+   {
+      BOOST_CHECK_EQUAL(describe(what), describe(expected));
+   }
+   BOOST_CHECK_EQUAL(any, expected_any);
+   if((any != expected_any) || (result != expected_result) || (describe(what) != describe(expected)))
+   {
+      std::cout << "Expression: \"" << e.str() << "\" text: \"" << text << "\" offset: " << offset << " flags: " << f << std::endl;
+   }
+}
+
+void compare_all(const boost::regex& e, const boost::regex& reference, const std::string& text)
+{
+   static const boost::match_flag_type flags[] =
+   {
+      boost::match_default,
+      boost::match_not_bol,
+      boost::match_not_eol,
+      boost::match_not_bob | boost::match_not_eob,
+      boost::match_not_bow | boost::match_not_eow,
+      boost::match_not_dot_newline,
+      boost::match_single_line,
+   };
+   for(unsigned i = 0; i < sizeof(flags) / sizeof(flags[0]); ++i)
+   {
+      compare(e, reference, text, flags[i], 0);
+      if(!text.empty())
+      {
+         compare(e, reference, text, flags[i] | boost::match_prev_avail, 1);
+      }
+   }
+   // all the matches in the text, the iterator uses match_prev_avail and
+   // match_not_null as it goes:
+   std::string result, expected;
+   boost::sregex_iterator j;
+   try
+   {
+      boost::sregex_iterator i(text.begin(), text.end(), e);
+      for(; i != j; ++i)
+         result += describe(*i);
+      boost::sregex_iterator k(text.begin(), text.end(), reference);
+      for(; k != j; ++k)
+         expected += describe(*k);
+   }
+   catch(const std::runtime_error&)
+   {
+      return;
+   }
+   BOOST_CHECK_EQUAL(result, expected);
+}
+
+void test_random_expressions()
+{
+   for(unsigned i = 0; i < 3000; ++i)
+   {
+      std::string expression = random_expression(0);
+      boost::regex::flag_type f = random_index(4) ? boost::regex::perl : boost::regex::perl | boost::regex::icase;
+      boost::regex e(expression, f);
+      // a zero width lookahead, which always matches, prevents the use of the DFA:
+      boost::regex reference(expression + "(?=a?)", f);
+      for(unsigned j = 0; j < 10; ++j)
+         compare_all(e, reference, random_text());
+   }
+}
+
+void test_fixed_expressions()
+{
+   static const char* const expressions[] =
+   {
+      "(a|ab)(c|bcd)(d*)",
+      "(?:(?:ab){2,3}c){2}",
+      "(?:(ab|a){1,2}c){2}",
+      "(?:x(?:ab)*)*y",
+      "(a*)*b",
+      "(a?){3}b",
+      "(?:a|)*b",
+      "^\\s*(\\w+)\\s*=\\s*(\\w*)\\s*$",
+      "\\<[[:alpha:]]+\\>",
+      "[[:digit:]]{1,3}(?:\\.[[:digit:]]{1,3}){3}",
+   };
+   static const char* const texts[] =
+   {
+      "abcd", "ababcabababc", "abacaac", "xababxaby", "aaab", "b", "  key = value \n", "10.0.0.256 and 1.2.3",
+   };
+   for(unsigned i = 0; i < sizeof(expressions) / sizeof(expressions[0]); ++i)
+   {
+      boost::regex e(expressions[i]);
+      boost::regex reference(std::string(expressions[i]) + "(?=a?)");
+      for(unsigned j = 0; j < sizeof(texts) / sizeof(texts[0]); ++j)
+         compare_all(e, reference, texts[j]);
+   }
+}
+
+void test_pathological_expressions()
+{
+   //
+   // These take exponential time with the backtracking matcher,
+   // but not with the DFA:
+   //
+   std::string bad_text(100000, ' ');
+   boost::smatch what;
+   boost::regex e1("(.+)+xyz");
+   BOOST_CHECK(!boost::regex_search(bad_text, what, e1));
+   boost::regex e2("(\\s*)+(\\w+\\s*)+=");
+   BOOST_CHECK(!boost::regex_search(bad_text, what, e2));
+   bad_text.append("xyz");
+   BOOST_CHECK(boost::regex_search(bad_text, e1));
+   BOOST_CHECK(boost::regex_search(bad_text, what, e1));
+   BOOST_CHECK_EQUAL(what.position(), 0);
+   BOOST_CHECK_EQUAL(what.length(), static_cast<int>(bad_text.size()));
+}
+
+void test_literals()
+{
+   //
+   // Searches which skip ahead to a literal string, with both random access
+   // and bidirectional iterators:
+   //
+   static const char* const expressions[] =
+   {
+      "abcde", "a", "\\<xab", "^aab b", "(\\w+) b\\n", "x_\\r*aab", "[ab]+aaba",
+   };
+   for(unsigned i = 0; i < sizeof(expressions) / sizeof(expressions[0]); ++i)
+   {
+      boost::regex e(expressions[i]);
+      boost::regex reference(std::string(expressions[i]) + "(?=a?)");
+      for(unsigned j = 0; j < 200; ++j)
+      {
+         std::string text = random_text() + "aab b\nx_abcde" + random_text() + "xaaba";
+         compare_all(e, reference, text);
+         const std::list<char> l(text.begin(), text.end());
+         boost::match_results<std::list<char>::const_iterator> what;
+         boost::smatch expected;
+         bool result = boost::regex_search(l.begin(), l.end(), what, e);
+         BOOST_CHECK_EQUAL(result, boost::regex_search(text, expected, e));
+         if(result)
+         {
+            BOOST_CHECK_EQUAL(what.position(), expected.position());
+            BOOST_CHECK_EQUAL(what.length(), expected.length());
+         }
+         BOOST_CHECK_EQUAL(boost::regex_search(text.c_str(), e), boost::regex_search(text, e));
+      }
+   }
+}
+
+void test_wide()
+{
+#ifndef BOOST_NO_WREGEX
+   std::wstring text(L"abc \x0100\x0101\x0100 def");
+   boost::wsmatch what;
+   boost::wregex e(L"[\x0100-\x0101]+|d.f");
+   BOOST_CHECK(boost::regex_search(text, what, e));
+   BOOST_CHECK_EQUAL(what.position(), 4);
+   BOOST_CHECK_EQUAL(what.length(), 3);
+   e.assign(L"\\bd\\w+$");
+   BOOST_CHECK(boost::regex_search(text, what, e));
+   BOOST_CHECK_EQUAL(what.position(), 8);
+   e.assign(L"\x0101\x0100 d");
+   BOOST_CHECK(boost::regex_search(text, what, e));
+   BOOST_CHECK_EQUAL(what.position(), 5);
+   e.assign(L"\\w+\x0101\x0100");
+   BOOST_CHECK(!boost::regex_search(text, what, e));
+#endif
+}
+
+int test_main( int , char* [] )
+{
+   test_fixed_expressions();
+   test_random_expressions();
+   test_pathological_expressions();
+   test_literals();
+   test_wide();
+   return 0;
+}
+
+#include <boost/test/included/test_exec_monitor.hpp>
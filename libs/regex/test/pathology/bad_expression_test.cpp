@@ -35,7 +35,12 @@ int test_main( int , char* [] )
    boost::regex e1("(.+)+xyz");
 
    BOOST_CHECK(boost::regex_search(good_text, what, e1));
+#ifdef BOOST_REGEX_NO_LAZY_DFA
    BOOST_CHECK_THROW(boost::regex_search(bad_text, what, e1), std::runtime_error);
+#else
+   // searches for these expressions are carried out by the lazy DFA:
+   BOOST_CHECK(!boost::regex_search(bad_text, what, e1));
+#endif
    BOOST_CHECK(boost::regex_search(good_text, what, e1));
 
    BOOST_CHECK(boost::regex_match(good_text, what, e1));
@@ -45,12 +50,20 @@ int test_main( int , char* [] )
    boost::regex e2("abc|[[:space:]]+(xyz)?[[:space:]]+xyz");
 
    BOOST_CHECK(boost::regex_search(good_text, what, e2));
+#ifdef BOOST_REGEX_NO_LAZY_DFA
    BOOST_CHECK_THROW(boost::regex_search(bad_text, what, e2), std::runtime_error);
+#else
+   BOOST_CHECK(!boost::regex_search(bad_text, what, e2));
+#endif
    BOOST_CHECK(boost::regex_search(good_text, what, e2));
 
    bad_text.assign((std::string::size_type)500000, 'a');
    e2.assign("aaa*@");
+#ifdef BOOST_REGEX_NO_LAZY_DFA
    BOOST_CHECK_THROW(boost::regex_search(bad_text, what, e2), std::runtime_error);
+#else
+   BOOST_CHECK(!boost::regex_search(bad_text, what, e2));
+#endif
    good_text.assign((std::string::size_type)5000, 'a');
    BOOST_CHECK(0 == boost::regex_search(good_text, what, e2));
 
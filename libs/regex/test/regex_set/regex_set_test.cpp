@@ -0,0 +1,266 @@
+/*
+ *
+ * Copyright (c) 2013
+ * John Maddock
+ *
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+ /*
+  *   LOCATION:    see http://www.boost.org for most recent version.
+  *   FILE         regex_set_test.cpp
+  *   VERSION      see <boost/version.hpp>
+  *   DESCRIPTION: Checks that basic_regex_set finds the same expressions
+  *                as searching for each one on its own.
+  */
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdio>
+#include <boost/regex.hpp>
+#include <boost/test/test_tools.hpp>
+
+#ifdef BOOST_INTEL
+#pragma warning(disable:1418 981 983 383)
+#endif
+
+//
+// A simple deterministic random number generator, so that failures
+// can be reproduced:
+//
+unsigned next_random()
+{
+   static unsigned long seed = 54321;
+   seed = (seed * 1103515245uL + 12345uL) & 0x7fffffffuL;
+   return static_cast<unsigned>(seed >> 16);
+}
+
+unsigned random_index(unsigned n)
+{
+   return next_random() % n;
+}
+
+std::string random_atom(int depth);
+
+std::string random_sequence(int depth)
+{
+   static const char* const repeats[] =
+   { "", "", "", "*", "+", "?", "{2}", "{1,2}", "{0,3}", "*?", "+?" };
+   std::string result;
+   unsigned n = 1 + random_index(3);
+   for(unsigned i = 0; i < n; ++i)
+   {
+      std::string atom = random_atom(depth);
+      if((atom.size() > 1) && (atom[0] == '\\') && (atom[1] != 'w') && (atom[1] != 's'))
+         result += atom;   // an assertion, which can't be repeated
+      else
+         result += atom + repeats[random_index(sizeof(repeats) / sizeof(repeats[0]))];
+   }
+   return result;
+}
+
+std::string random_atom(int depth)
+{
+   static const char* const atoms[] =
+   {
+      "a", "b", "ab", "ba", ".", "[ab]", "[^a]", "\\w", "\\s", "x", " ", "\\b", "\\<", "\\>", "\\`", "\\'"
+   };
+   if((depth < 2) && (random_index(5) == 0))
+   {
+      std::string result = "(" + random_sequence(depth + 1);
+      if(random_index(2))
+         result += "|" + random_sequence(depth + 1);
+      return result + ")";
+   }
+   return atoms[random_index(sizeof(atoms) / sizeof(atoms[0]))];
+}
+
+std::string random_text()
+{
+   static const char chars[] = "aab b\nx_";
+   std::string result;
+   unsigned n = random_index(16);
+   for(unsigned i = 0; i < n; ++i)
+      result += chars[random_index(sizeof(chars) - 1)];
+   return result;
+}
+
+std::string describe(const std::vector<std::size_t>& which)
+{
+   std::string result;
+   for(std::size_t i = 0; i < which.size(); ++i)
+   {
+      char buf[20];
+      std::sprintf(buf, i ? ",%u" : "%u", static_cast<unsigned>(which[i]));
+      result += buf;
+   }
+   return result;
+}
+
+//
+// Compares the result of searching for the set with the result of
+// searching for each of its expressions in turn:
+//
+void compare(const boost::regex_set& s, const std::string& text, boost::match_flag_type f)
+{
+   std::vector<std::size_t> which, expected;
+   bool result;
+   try
+   {
+      for(std::size_t i = 0; i < s.size(); ++i)
+      {
+         if(!s[i].empty() && boost::regex_search(text.begin(), text.end(), s[i], f))
+            expected.push_back(i);
+      }
+      result = boost::regex_search(text.begin(), text.end(), which, s, f);
+   }
+   catch(const std::runtime_error&)
+   {
+      // too complex for the backtracking matcher:
+      return;
+   }
+   BOOST_CHECK_EQUAL(result, !expected.empty());
+   BOOST_CHECK_EQUAL(describe(which), describe(expected));
+   if(describe(which) != describe(expected))
+   {
+      std::cout << "Text: \"" << text << "\" flags: " << f << " expressions:" << std::endl;
+      for(std::size_t i = 0; i < s.size(); ++i)
+         std::cout << "   \"" << s[i].str() << "\"" << std::endl;
+   }
+}
+
+void test_random_sets()
+{
+   static const boost::match_flag_type flags[] =
+   {
+      boost::match_default,
+      boost::match_not_bol | boost::match_not_eol,
+      boost::match_not_bob | boost::match_not_eob,
+      boost::match_not_bow | boost::match_not_eow,
+      boost::match_not_dot_newline,
+      boost::match_single_line,
+      boost::match_partial,
+   };
+   for(unsigned i = 0; i < 1000; ++i)
+   {
+      std::vector<std::string> expressions(1 + random_index(8));
+      for(std::size_t j = 0; j < expressions.size(); ++j)
+         expressions[j] = random_sequence(0);
+      boost::regex::flag_type f = random_index(4) ? boost::regex::perl : boost::regex::perl | boost::regex::icase;
+      boost::regex_set s(expressions.begin(), expressions.end(), f);
+      BOOST_CHECK_EQUAL(s.size(), expressions.size());
+      for(unsigned j = 0; j < 10; ++j)
+      {
+         std::string text = random_text();
+         compare(s, text, flags[random_index(sizeof(flags) / sizeof(flags[0]))]);
+      }
+   }
+}
+
+void test_mixed_sets()
+{
+   //
+   // Sets whose expressions can't all be searched for by the lazy DFA,
+   // or which don't survive being joined together:
+   //
+   static const char* const expressions[] =
+   {
+      "(a)\\1",          // back reference
+      "a(?=b)",          // lookahead
+      "(?i)AB",          // case change
+      "(x)(y)?",         // sub-expressions before the next expression
+      "\\Qa|b",          // unterminated quote
+      "(?x) b a # comment",
+      "\\w+@\\w+\\.com",
+   };
+   std::vector<std::string> v(expressions, expressions + sizeof(expressions) / sizeof(expressions[0]));
+   static const char* const texts[] =
+   {
+      "aa", "ab", "xy", "a|b", "ba", "me@example.com", "a|b x ba aa", "",
+   };
+   for(unsigned i = 0; i < sizeof(texts) / sizeof(texts[0]); ++i)
+   {
+      boost::regex_set s(v.begin(), v.end());
+      compare(s, texts[i], boost::match_default);
+      s.assign(v.begin() + 2, v.end(), boost::regex::perl | boost::regex::nosubs);
+      compare(s, texts[i], boost::match_default);
+      s.assign(v.begin() + 2, v.end(), boost::regex::extended | boost::regex::no_except);
+      compare(s, texts[i], boost::match_default);
+   }
+}
+
+void test_large_set()
+{
+   //
+   // Too many expressions for a single DFA, so the set has to be split:
+   //
+   std::vector<std::string> v;
+   for(unsigned i = 0; i < 300; ++i)
+   {
+      char buf[50];
+      std::sprintf(buf, "\\w+%u\\s+(\\w+|[ab]*x)\\s*%u", i, (i * 7) % 300);
+      v.push_back(buf);
+   }
+   boost::regex_set s(v.begin(), v.end());
+   compare(s, "x12 abx 84 y299 b 193 foo0   0 bar", boost::match_default);
+   compare(s, "a150 b 150", boost::match_default);
+   compare(s, "", boost::match_default);
+}
+
+void test_interface()
+{
+   const char* expressions[] = { "error: (\\w+)", "^warning", "disk", "[" };
+   boost::regex_set s;
+   BOOST_CHECK(s.empty());
+   std::vector<std::size_t> which;
+   BOOST_CHECK(!boost::regex_search("disk error: full", which, s));
+   BOOST_CHECK(which.empty());
+   try
+   {
+      s.assign(expressions, expressions + 4);
+      BOOST_ERROR("Expected an exception from an invalid expression");
+   }
+   catch(const boost::regex_error&)
+   {
+   }
+   s.assign(expressions, expressions + 4, boost::regex::perl | boost::regex::no_except);
+   BOOST_CHECK_EQUAL(s.size(), 4u);
+   BOOST_CHECK(s[3].empty());
+   BOOST_CHECK(boost::regex_search("disk error: full", which, s));
+   BOOST_CHECK_EQUAL(describe(which), "0,2");
+   BOOST_CHECK(!boost::regex_search(std::string("nothing to see"), which, s));
+   BOOST_CHECK(which.empty());
+   std::string text("warning: disk\nerror: x");
+   BOOST_CHECK(boost::regex_search(text.begin(), text.end(), which, s));
+   BOOST_CHECK_EQUAL(describe(which), "0,1,2");
+   BOOST_CHECK(boost::regex_search(text.begin() + 1, text.end(), which, s, boost::match_prev_avail));
+   BOOST_CHECK_EQUAL(describe(which), "0,2");
+   boost::regex_set t;
+   swap(s, t);
+   BOOST_CHECK(s.empty());
+   BOOST_CHECK_EQUAL(t.size(), 4u);
+#ifndef BOOST_NO_WREGEX
+   std::vector<std::wstring> wexpressions;
+   wexpressions.push_back(L"\x0100+");
+   wexpressions.push_back(L"d.f");
+   wexpressions.push_back(L"\\bz");
+   boost::wregex_set ws(wexpressions.begin(), wexpressions.end());
+   BOOST_CHECK(boost::regex_search(L"abc \x0100\x0101\x0100 def", which, ws));
+   BOOST_CHECK_EQUAL(describe(which), "0,1");
+#endif
+}
+
+int test_main( int , char* [] )
+{
+   test_interface();
+   test_mixed_sets();
+   test_large_set();
+   test_random_sets();
+   return 0;
+}
+
+#include <boost/test/included/test_exec_monitor.hpp>
@@ -434,5 +434,22 @@ void test_tricky_cases3()
       test(char(0), test_regex_search_tag());
    }while(0);
 #endif
+   //
+   // searches which skip ahead to a literal string:
+   //
+   TEST_REGEX_SEARCH("abcde", perl, "xxabcdexabcde", match_default, make_array(2, 7, -2, 8, 13, -2, -2));
+   TEST_REGEX_SEARCH("abcde\\w+", perl, "abcdabcdefg", match_default, make_array(4, 11, -2, -2));
+   TEST_REGEX_SEARCH("aaab", perl, "aaaaaab", match_default, make_array(3, 7, -2, -2));
+   TEST_REGEX_SEARCH("abab", perl, "abaabab", match_default, make_array(3, 7, -2, -2));
+   TEST_REGEX_SEARCH("\\<abcd", perl, "xabcd abcd", match_default, make_array(6, 10, -2, -2));
+   TEST_REGEX_SEARCH("^abcd", perl, "abcd\nxabcd\nabcd", match_default, make_array(0, 4, -2, 11, 15, -2, -2));
+   TEST_REGEX_SEARCH("(\\w+)@example\\.com", perl, "mail a@example.co b@example.com", match_default, make_array(18, 31, 18, 19, -2, -2));
+   TEST_REGEX_SEARCH("\\w+xyzw", perl, "abc xyz", match_default, make_array(-2, -2));
+   TEST_REGEX_SEARCH("[[:digit:]]+ apples", perl, "1 apple 2 apples", match_default, make_array(8, 16, -2, -2));
+   TEST_REGEX_SEARCH("abcdef", perl, "xxabc", match_default|match_partial, make_array(2, 5, -2, -2));
+   TEST_REGEX_SEARCH("\\w+cdef", perl, "xxabc", match_default|match_partial, make_array(0, 5, -2, -2));
+   TEST_REGEX_SEARCH("ABcdE", perl|icase, "xxabcde", match_default, make_array(2, 7, -2, -2));
+   TEST_REGEX_SEARCH("(?i)abcde", perl, "ABCDE", match_default, make_array(0, 5, -2, -2));
+   TEST_REGEX_SEARCH("x(?i:abcde)", perl, "xABCDE", match_default, make_array(0, 6, -2, -2));
 }
 
@@ -24,6 +24,7 @@ namespace std{
 #endif
 
 #include <boost/integer_traits.hpp>
+#include <boost/unordered_map.hpp>
 #include <boost/serialization/state_saver.hpp>
 #include <boost/serialization/throw_exception.hpp>
 #include <boost/serialization/tracking.hpp>
@@ -53,6 +54,7 @@ class basic_iarchive_impl {
     friend class basic_iarchive;
     library_version_type m_archive_library_version;
     unsigned int m_flags;
+    archive_stats m_stats;
 
     //////////////////////////////////////////////////////////////////////
     // information about each serialized object loaded
@@ -119,6 +121,15 @@ class basic_iarchive_impl {
     typedef std::set<cobject_type> cobject_info_set_type;
     cobject_info_set_type cobject_info_set;
 
+    // Comparing type_info for every object loaded is expensive. Since
+    // serializers are singletons, remember the class id of each one
+    // we've seen.
+    typedef boost::unordered_map<
+        const basic_iserializer *,
+        class_id_type
+    > cobject_cache_type;
+    cobject_cache_type cobject_cache;
+
     //////////////////////////////////////////////////////////////////////
     // information about each serialized class indexed on class_id
     class cobject_id 
@@ -203,6 +214,9 @@ class basic_iarchive_impl {
         pending_object = t;
     }
     void delete_created_pointers();
+    void reserve(std::size_t object_count){
+        object_id_vector.reserve(object_count);
+    }
     class_id_type register_type(
         const basic_pointer_iserializer & bpis
     );
@@ -293,16 +307,26 @@ inline class_id_type
 basic_iarchive_impl::register_type(
     const basic_iserializer & bis
 ){
+    ++m_stats.class_lookups;
     class_id_type cid(cobject_info_set.size());
-    cobject_type co(cid, bis);
-    std::pair<cobject_info_set_type::const_iterator, bool>
-        result = cobject_info_set.insert(co);
-
-    if(result.second){
-        cobject_id_vector.push_back(cobject_id(bis));
-        BOOST_ASSERT(cobject_info_set.size() == cobject_id_vector.size());
+    cobject_cache_type::const_iterator it = cobject_cache.find(& bis);
+    if(it != cobject_cache.end()){
+        cid = it->second;
+    }
+    else{
+        ++m_stats.class_lookup_misses;
+        cobject_type co(cid, bis);
+        std::pair<cobject_info_set_type::const_iterator, bool>
+            result = cobject_info_set.insert(co);
+
+        if(result.second){
+            ++m_stats.classes;
+            cobject_id_vector.push_back(cobject_id(bis));
+            BOOST_ASSERT(cobject_info_set.size() == cobject_id_vector.size());
+        }
+        cid = result.first->m_class_id;
+        cobject_cache.insert(std::make_pair(& bis, cid));
     }
-    cid = result.first->m_class_id;
     // borland complains without this minor hack
     const int tid = cid;
     cobject_id & coid = cobject_id_vector[tid];
@@ -363,6 +387,7 @@ basic_iarchive_impl::load_object(
         return;
     }
 
+    ++m_stats.objects;
     const class_id_type cid = register_type(bis);
     const int i = cid;
     cobject_id & co = cobject_id_vector[i];
@@ -382,9 +407,12 @@ basic_iarchive_impl::load_object(
     // if we tracked this object when the archive was saved
     if(tracking){ 
         // if it was already read
-        if(!track(ar, t))
+        if(!track(ar, t)){
+            ++m_stats.object_references;
             // we're done
             return;
+        }
+        ++m_stats.tracked_objects;
         // add a new enty into the tracking list
         object_id_vector.push_back(aobject(t, cid));
         // and add an entry for this object
@@ -412,6 +440,7 @@ basic_iarchive_impl::load_pointer(
         t = NULL;
         return bpis_ptr;
     }
+    ++m_stats.pointers;
 
     // if its a new class type - i.e. never been registered
     if(class_id_type(cobject_info_set.size()) <= cid){
@@ -448,9 +477,11 @@ basic_iarchive_impl::load_pointer(
     // extra line to evade borland issue
     const bool tracking = co.tracking_level;
     // if we're tracking and the pointer has already been read
-    if(tracking && ! track(ar, t))
+    if(tracking && ! track(ar, t)){
+        ++m_stats.object_references;
         // we're done
         return bpis_ptr;
+    }
 
     // save state
     serialization::state_saver<object_id_type> w_start(moveable_objects_start);
@@ -466,6 +497,7 @@ basic_iarchive_impl::load_pointer(
         pending_bis = & bpis_ptr->get_basic_serializer();
         pending_version = co.file_version;
 
+        ++m_stats.tracked_objects;
         // predict next object id to be created
         const unsigned int ui = object_id_vector.size();
 
@@ -571,6 +603,16 @@ basic_iarchive::get_flags() const{
     return pimpl->m_flags;
 }
 
+BOOST_ARCHIVE_DECL(void)
+basic_iarchive::reserve(std::size_t object_count){
+    pimpl->reserve(object_count);
+}
+
+BOOST_ARCHIVE_DECL(archive_stats)
+basic_iarchive::get_stats() const{
+    return pimpl->m_stats;
+}
+
 } // namespace detail
 } // namespace archive
 } // namespace boost
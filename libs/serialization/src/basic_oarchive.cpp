@@ -12,9 +12,13 @@
 
 #include <boost/assert.hpp>
 #include <set>
+#include <vector>
 #include <cstddef> // NULL
 
 #include <boost/limits.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/unordered_set.hpp>
+#include <boost/unordered_map.hpp>
 #include <boost/serialization/state_saver.hpp>
 #include <boost/serialization/throw_exception.hpp>
 
@@ -47,6 +51,7 @@ namespace detail {
 class basic_oarchive_impl {
     friend class basic_oarchive;
     unsigned int m_flags;
+    archive_stats m_stats;
 
     //////////////////////////////////////////////////////////////////////
     // information about each serialized object saved
@@ -57,16 +62,19 @@ class basic_oarchive_impl {
         class_id_type class_id;
         object_id_type object_id;
 
-        bool operator<(const aobject &rhs) const
+        bool operator==(const aobject &rhs) const
         {
             BOOST_ASSERT(NULL != address);
             BOOST_ASSERT(NULL != rhs.address);
-            if( address < rhs.address )
-                return true;
-            if( address > rhs.address )
-                return false;
-            return class_id < rhs.class_id;
+            return address == rhs.address && class_id == rhs.class_id;
         }
+        struct hash {
+            std::size_t operator()(const aobject & ao) const {
+                std::size_t seed = boost::hash_value(ao.address);
+                boost::hash_combine(seed, static_cast<int>(ao.class_id));
+                return seed;
+            }
+        };
         aobject & operator=(const aobject & rhs)
         {
             address = rhs.address;
@@ -85,8 +93,9 @@ class basic_oarchive_impl {
         {}
         aobject() : address(NULL){}
     };
-    // keyed on class_id, address
-    typedef std::set<aobject> object_set_type;
+    // keyed on address, class_id.  This is consulted for every tracked
+    // object so use a hash table rather than a tree.
+    typedef boost::unordered_set<aobject, aobject::hash> object_set_type;
     object_set_type object_set;
 
     //////////////////////////////////////////////////////////////////////
@@ -128,9 +137,18 @@ class basic_oarchive_impl {
     typedef std::set<cobject_type> cobject_info_set_type;
     cobject_info_set_type cobject_info_set;
 
-    // list of objects initially stored as pointers - used to detect errors
-    // keyed on object id
-    std::set<object_id_type> stored_pointers;
+    // Comparing type_info for every object saved is expensive. Since
+    // serializers are singletons, remember where each one we've seen
+    // is found in cobject_info_set.  Elements of a std::set don't move.
+    typedef boost::unordered_map<
+        const basic_oserializer *,
+        const cobject_type *
+    > cobject_cache_type;
+    cobject_cache_type cobject_cache;
+
+    // objects initially stored as pointers - used to detect errors
+    // indexed on object id
+    std::vector<bool> stored_pointers;
 
     // address of the most recent object serialized as a poiner
     // whose data itself is now pending serialization
@@ -151,6 +169,7 @@ class basic_oarchive_impl {
 //public:
     const cobject_type &
     register_type(const basic_oserializer & bos);
+    void reserve(std::size_t object_count);
     void save_object(
         basic_oarchive & ar,
         const void *t,
@@ -235,12 +254,28 @@ inline const basic_oarchive_impl::cobject_type &
 basic_oarchive_impl::register_type(
     const basic_oserializer & bos
 ){
+    ++m_stats.class_lookups;
+    cobject_cache_type::const_iterator it = cobject_cache.find(& bos);
+    if(it != cobject_cache.end())
+        return *(it->second);
+    ++m_stats.class_lookup_misses;
     cobject_type co(cobject_info_set.size(), bos);
     std::pair<cobject_info_set_type::const_iterator, bool>
         result = cobject_info_set.insert(co);
+    if(result.second)
+        ++m_stats.classes;
+    cobject_cache.insert(std::make_pair(& bos, &*(result.first)));
     return *(result.first);
 }
 
+inline void
+basic_oarchive_impl::reserve(std::size_t object_count){
+    object_set.rehash(
+        static_cast<std::size_t>(object_count / object_set.max_load_factor()) + 1
+    );
+    stored_pointers.reserve(object_count);
+}
+
 inline void
 basic_oarchive_impl::save_object(
     basic_oarchive & ar,
@@ -255,6 +290,7 @@ basic_oarchive_impl::save_object(
         return;
     }
 
+    ++m_stats.objects;
     // get class information for this object
     const cobject_type & co = register_type(bos);
     if(bos.class_info()){
@@ -285,6 +321,7 @@ basic_oarchive_impl::save_object(
 
     // if its a new object
     if(aresult.second){
+        ++m_stats.tracked_objects;
         // write out the object id
         ar.vsave(oid);
         ar.end_preamble();
@@ -292,9 +329,10 @@ basic_oarchive_impl::save_object(
         (bos.save_object_data)(ar, t);
         return;
     }
+    ++m_stats.object_references;
 
     // check that it wasn't originally stored through a pointer
-    if(stored_pointers.end() != stored_pointers.find(oid)){
+    if(oid < stored_pointers.size() && stored_pointers[oid]){
         // this has to be a user error.  loading such an archive
         // would create duplicate objects
         boost::serialization::throw_exception(
@@ -314,6 +352,7 @@ basic_oarchive_impl::save_pointer(
     const void * t, 
     const basic_pointer_oserializer * bpos_ptr
 ){
+    ++m_stats.pointers;
     const basic_oserializer & bos = bpos_ptr->get_basic_serializer();
     std::size_t original_count = cobject_info_set.size();
     const cobject_type & co = register_type(bos);
@@ -372,6 +411,7 @@ basic_oarchive_impl::save_pointer(
     oid = aresult.first->object_id;
     // if the saved object already exists
     if(! aresult.second){
+        ++m_stats.object_references;
         // append the object id to he preamble
         ar.vsave(object_reference_type(oid));
         // and windup.
@@ -379,6 +419,7 @@ basic_oarchive_impl::save_pointer(
         return;
     }
 
+    ++m_stats.tracked_objects;
     // append id of this object to preamble
     ar.vsave(oid);
     ar.end_preamble();
@@ -390,7 +431,9 @@ basic_oarchive_impl::save_pointer(
     pending_bos = & bpos_ptr->get_basic_serializer();
     bpos_ptr->save_object_ptr(ar, t);
     // add to the set of object initially stored through pointers
-    stored_pointers.insert(oid);
+    if(stored_pointers.size() <= oid)
+        stored_pointers.resize(oid + 1, false);
+    stored_pointers[oid] = true;
 }
 
 } // namespace detail
@@ -446,6 +489,16 @@ basic_oarchive::get_flags() const{
     return pimpl->m_flags;
 }
 
+BOOST_ARCHIVE_DECL(void) 
+basic_oarchive::reserve(std::size_t object_count){
+    pimpl->reserve(object_count);
+}
+
+BOOST_ARCHIVE_DECL(archive_stats)
+basic_oarchive::get_stats() const{
+    return pimpl->m_stats;
+}
+
 BOOST_ARCHIVE_DECL(void) 
 basic_oarchive::end_preamble(){
 }
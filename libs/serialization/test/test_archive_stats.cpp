@@ -0,0 +1,103 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// test_archive_stats.cpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// should pass compilation and execution
+
+#include <cstddef>
+#include <sstream>
+
+#include <boost/config.hpp>
+
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/archive_stats.hpp>
+#include "test_tools.hpp"
+
+#include <boost/serialization/nvp.hpp>
+
+class A
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(x);
+    }
+public:
+    int x;
+    A() : x(0) {}
+};
+
+class B
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(a);
+        ar & BOOST_SERIALIZATION_NVP(p1);
+        ar & BOOST_SERIALIZATION_NVP(p2);
+        ar & BOOST_SERIALIZATION_NVP(p3);
+    }
+public:
+    A a;
+    A * p1;
+    A * p2;
+    A * p3;
+    B() : p1(NULL), p2(NULL), p3(NULL) {}
+};
+
+void check_stats(const boost::archive::archive_stats & s){
+    // b and b.a
+    BOOST_CHECK_EQUAL(2u, s.objects);
+    // p1, p2 and p3. The null pointer isn't counted
+    BOOST_CHECK_EQUAL(3u, s.pointers);
+    // b, b.a and the object p1 and p2 point to
+    BOOST_CHECK_EQUAL(3u, s.tracked_objects);
+    // p2 and p3
+    BOOST_CHECK_EQUAL(2u, s.object_references);
+    BOOST_CHECK_EQUAL(2u, s.classes);
+    BOOST_CHECK(s.class_lookups >= s.objects + s.pointers);
+    // each class is looked up the slow way only once
+    BOOST_CHECK_EQUAL(s.classes, s.class_lookup_misses);
+}
+
+int
+test_main( int /* argc */, char* /* argv */[] )
+{
+    A a;
+    B b;
+    b.a.x = 1;
+    b.p1 = & a;
+    b.p2 = & a;
+    b.p3 = & b.a;
+    B * pb = NULL;
+
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa.reserve(16);
+        oa << BOOST_SERIALIZATION_NVP(b);
+        oa << BOOST_SERIALIZATION_NVP(pb);
+        check_stats(oa.get_stats());
+    }
+    B b1;
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia.reserve(16);
+        ia >> BOOST_SERIALIZATION_NVP(b1);
+        ia >> BOOST_SERIALIZATION_NVP(pb);
+        check_stats(ia.get_stats());
+    }
+    BOOST_CHECK(NULL == pb);
+    BOOST_CHECK(b1.p1 == b1.p2);
+    BOOST_CHECK(b1.p3 == & b1.a);
+    BOOST_CHECK_EQUAL(1, b1.p3->x);
+    delete b1.p1;
+    return EXIT_SUCCESS;
+}
+
+// EOF
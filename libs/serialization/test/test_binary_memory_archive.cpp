@@ -0,0 +1,220 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// test_binary_memory_archive.cpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// should pass compilation and execution
+
+#include <cstddef>
+#include <cstring> // memcpy
+#include <algorithm> // equal
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+
+#include <boost/archive/binary_memory_oarchive.hpp>
+#include <boost/archive/binary_memory_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include "test_tools.hpp"
+
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/array_view.hpp>
+
+class A
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(i);
+        ar & BOOST_SERIALIZATION_NVP(d);
+        ar & BOOST_SERIALIZATION_NVP(s);
+        ar & BOOST_SERIALIZATION_NVP(v);
+    }
+public:
+    int i;
+    double d;
+    std::string s;
+    std::vector<int> v;
+    A() : i(0), d(0) {}
+    A(int i_) : i(i_), d(i_ / 4.0), s(i_, 'x') {
+        for(int j = 0; j < i_; ++j)
+            v.push_back(j * j);
+    }
+    bool operator==(const A & rhs) const {
+        return i == rhs.i && d == rhs.d && s == rhs.s && v == rhs.v;
+    }
+};
+
+// a block of samples which is loaded without copying them
+class B
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(tag);
+        ar & BOOST_SERIALIZATION_NVP(samples);
+    }
+public:
+    char tag;
+    boost::serialization::array_view<double> samples;
+};
+
+void test_round_trip(){
+    std::vector<char> buffer;
+    const A a1(7), a2(300);
+    {
+        boost::archive::binary_memory_oarchive oa(buffer);
+        oa << BOOST_SERIALIZATION_NVP(a1);
+        oa << BOOST_SERIALIZATION_NVP(a2);
+        BOOST_CHECK(buffer.size() >= oa.size());
+    }
+    BOOST_REQUIRE(! buffer.empty());
+    A a3, a4;
+    {
+        boost::archive::binary_memory_iarchive ia(& buffer[0], buffer.size());
+        ia >> BOOST_SERIALIZATION_NVP(a3);
+        ia >> BOOST_SERIALIZATION_NVP(a4);
+        BOOST_CHECK_EQUAL(buffer.size(), ia.size());
+    }
+    BOOST_CHECK(a1 == a3);
+    BOOST_CHECK(a2 == a4);
+}
+
+// the data is the same as that written by binary_oarchive
+void test_binary_oarchive_compatible(){
+    const A a1(42);
+    std::ostringstream os;
+    {
+        boost::archive::binary_oarchive oa(os);
+        oa << BOOST_SERIALIZATION_NVP(a1);
+    }
+    const std::string s = os.str();
+    A a2;
+    {
+        boost::archive::binary_memory_iarchive ia(s.data(), s.size());
+        ia >> BOOST_SERIALIZATION_NVP(a2);
+    }
+    BOOST_CHECK(a1 == a2);
+
+    std::vector<char> buffer;
+    {
+        boost::archive::binary_memory_oarchive oa(buffer);
+        oa << BOOST_SERIALIZATION_NVP(a1);
+    }
+    BOOST_CHECK(std::string(buffer.begin(), buffer.end()) == s);
+}
+
+void test_fixed_region(){
+    char region[64];
+    std::size_t used = 0;
+    {
+        boost::archive::binary_memory_oarchive oa(
+            region, sizeof(region), boost::archive::no_header
+        );
+        const int i = 17;
+        oa << BOOST_SERIALIZATION_NVP(i);
+        used = oa.size();
+        // does not fit
+        const A a(100);
+        bool thrown = false;
+        try{
+            oa << BOOST_SERIALIZATION_NVP(a);
+        }
+        catch(const boost::archive::archive_exception & e){
+            thrown = true;
+            BOOST_CHECK(
+                boost::archive::archive_exception::output_stream_error == e.code
+            );
+        }
+        BOOST_CHECK(thrown);
+    }
+    int i = 0;
+    boost::archive::binary_memory_iarchive ia(
+        region, used, boost::archive::no_header
+    );
+    ia >> BOOST_SERIALIZATION_NVP(i);
+    BOOST_CHECK_EQUAL(17, i);
+}
+
+void test_truncated(){
+    std::vector<char> buffer;
+    {
+        boost::archive::binary_memory_oarchive oa(buffer);
+        const A a(50);
+        oa << BOOST_SERIALIZATION_NVP(a);
+    }
+    A a;
+    bool thrown = false;
+    try{
+        boost::archive::binary_memory_iarchive ia(& buffer[0], buffer.size() - 1);
+        ia >> BOOST_SERIALIZATION_NVP(a);
+    }
+    catch(const boost::archive::archive_exception & e){
+        thrown = true;
+        BOOST_CHECK(
+            boost::archive::archive_exception::input_stream_error == e.code
+        );
+    }
+    BOOST_CHECK(thrown);
+}
+
+void test_array_view(){
+    std::vector<double> samples;
+    for(int j = 0; j < 1000; ++j)
+        samples.push_back(j * 0.5);
+
+    std::vector<char> buffer;
+    {
+        boost::archive::binary_memory_oarchive oa(buffer);
+        B b1;
+        b1.tag = 't';
+        b1.samples.reset(& samples[0], samples.size());
+        oa << BOOST_SERIALIZATION_NVP(b1);
+        B b2;
+        b2.tag = 'e';
+        oa << BOOST_SERIALIZATION_NVP(b2);
+    }
+
+    // copy into storage suitably aligned for double, as a memory
+    // mapped file would be
+    std::vector<double> storage(buffer.size() / sizeof(double) + 1);
+    std::memcpy(& storage[0], & buffer[0], buffer.size());
+    const char * begin = reinterpret_cast<const char *>(& storage[0]);
+    const char * end = begin + buffer.size();
+
+    B b1, b2;
+    boost::archive::binary_memory_iarchive ia(begin, buffer.size());
+    ia >> BOOST_SERIALIZATION_NVP(b1);
+    ia >> BOOST_SERIALIZATION_NVP(b2);
+
+    BOOST_CHECK_EQUAL('t', b1.tag);
+    BOOST_CHECK_EQUAL(samples.size(), b1.samples.count());
+    // the view refers to the archive buffer
+    const char * p = reinterpret_cast<const char *>(b1.samples.address());
+    BOOST_CHECK(begin <= p && p < end);
+    BOOST_CHECK(std::equal(samples.begin(), samples.end(), b1.samples.begin()));
+
+    BOOST_CHECK_EQUAL('e', b2.tag);
+    BOOST_CHECK(b2.samples.empty());
+}
+
+int
+test_main( int /* argc */, char* /* argv */[] )
+{
+    test_round_trip();
+    test_binary_oarchive_compatible();
+    test_fixed_region();
+    test_truncated();
+    test_array_view();
+    return EXIT_SUCCESS;
+}
+
+// EOF
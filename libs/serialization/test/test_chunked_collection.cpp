@@ -0,0 +1,136 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// test_chunked_collection.cpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// should pass compilation and execution
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+
+#include <boost/config.hpp>
+
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+#include <boost/archive/xml_iarchive.hpp>
+#include "test_tools.hpp"
+
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/utility.hpp>
+#include <boost/serialization/chunked_collection.hpp>
+
+class A
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(i);
+        ar & BOOST_SERIALIZATION_NVP(s);
+    }
+public:
+    int i;
+    std::string s;
+    A() : i(0) {}
+    explicit A(int i_) : i(i_), s(i_ % 7, 'a') {}
+    bool operator==(const A & rhs) const {
+        return i == rhs.i && s == rhs.s;
+    }
+};
+
+template<class OA, class IA, class Container>
+void test_round_trip(
+    const Container & c1,
+    std::size_t chunk_size,
+    unsigned int thread_count
+){
+    std::stringstream ss;
+    {
+        OA oa(ss);
+        oa << boost::serialization::make_nvp(
+            "c",
+            boost::serialization::make_chunked_collection(
+                c1, chunk_size, thread_count
+            )
+        );
+    }
+    Container c2;
+    {
+        IA ia(ss);
+        ia >> boost::serialization::make_nvp(
+            "c",
+            boost::serialization::make_chunked_collection(
+                c2, chunk_size, thread_count
+            )
+        );
+    }
+    BOOST_CHECK(c1 == c2);
+}
+
+template<class OA, class IA>
+void test_archive(){
+    std::vector<A> v;
+    for(int i = 0; i < 1000; ++i)
+        v.push_back(A(i));
+    std::list<int> l(v.size(), 3);
+    std::map<int, A> m;
+    for(int i = 0; i < 500; ++i)
+        m.insert(std::make_pair(i * 3, A(i)));
+
+    test_round_trip<OA, IA>(v, 64, 4);
+    test_round_trip<OA, IA>(v, 64, 1);
+    test_round_trip<OA, IA>(v, 1000, 0);
+    test_round_trip<OA, IA>(v, 10000, 2);
+    test_round_trip<OA, IA>(std::vector<A>(), 64, 4);
+    test_round_trip<OA, IA>(l, 100, 3);
+    test_round_trip<OA, IA>(m, 33, 4);
+}
+
+// a corrupted chunk is reported on the calling thread
+void test_corrupt(){
+    std::vector<A> v;
+    for(int i = 0; i < 100; ++i)
+        v.push_back(A(i));
+    std::stringstream ss;
+    {
+        boost::archive::binary_oarchive oa(ss);
+        oa << boost::serialization::make_chunked_collection(v, 10, 4);
+    }
+    std::string s = ss.str();
+    // truncate the strings in the last chunk
+    s.resize(s.size() - 5);
+    s.append(5, '\x7f');
+    std::istringstream is(s);
+    std::vector<A> v2;
+    bool thrown = false;
+    try{
+        boost::archive::binary_iarchive ia(is);
+        ia >> boost::serialization::make_chunked_collection(v2, 10, 4);
+    }
+    catch(const boost::archive::archive_exception &){
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+int
+test_main( int /* argc */, char* /* argv */[] )
+{
+    test_archive<boost::archive::text_oarchive, boost::archive::text_iarchive>();
+    test_archive<boost::archive::binary_oarchive, boost::archive::binary_iarchive>();
+    test_archive<boost::archive::xml_oarchive, boost::archive::xml_iarchive>();
+    test_corrupt();
+    return EXIT_SUCCESS;
+}
+
+// EOF
@@ -0,0 +1,242 @@
+/////////1/////////2/////////3/////////4/////////5/////////6/////////7/////////8
+// test_varint_binary_archive.cpp
+
+// (C) Copyright 2002 Robert Ramey - http://www.rrsd.com . 
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// should pass compilation and execution
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+
+#include <boost/archive/varint_binary_oarchive.hpp>
+#include <boost/archive/varint_binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/archive_exception.hpp>
+#include "test_tools.hpp"
+
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+class A
+{
+    friend class boost::serialization::access;
+    template<class Archive>
+    void serialize(Archive & ar, const unsigned int /* file_version */){
+        ar & BOOST_SERIALIZATION_NVP(c);
+        ar & BOOST_SERIALIZATION_NVP(s);
+        ar & BOOST_SERIALIZATION_NVP(i);
+        ar & BOOST_SERIALIZATION_NVP(l);
+        ar & BOOST_SERIALIZATION_NVP(u);
+        ar & BOOST_SERIALIZATION_NVP(f);
+        ar & BOOST_SERIALIZATION_NVP(d);
+        ar & BOOST_SERIALIZATION_NVP(b);
+        ar & BOOST_SERIALIZATION_NVP(str);
+        #ifndef BOOST_NO_STD_WSTRING
+        ar & BOOST_SERIALIZATION_NVP(wstr);
+        #endif
+        ar & BOOST_SERIALIZATION_NVP(v);
+        ar & BOOST_SERIALIZATION_NVP(vd);
+    }
+public:
+    char c;
+    short s;
+    int i;
+    boost::int64_t l;
+    boost::uint64_t u;
+    float f;
+    double d;
+    bool b;
+    std::string str;
+    #ifndef BOOST_NO_STD_WSTRING
+    std::wstring wstr;
+    #endif
+    std::vector<int> v;
+    std::vector<double> vd;
+    A() : c(0), s(0), i(0), l(0), u(0), f(0), d(0), b(false) {}
+    A(int n) :
+        c(static_cast<char>('a' + n % 26)),
+        s(static_cast<short>(-n)),
+        i(n * 1000),
+        l(-(static_cast<boost::int64_t>(n) << 40)),
+        u(static_cast<boost::uint64_t>(n) << 50),
+        f(n / 3.0f),
+        d(-n / 7.0),
+        b(0 != n % 2),
+        str(n, 'x')
+    {
+        #ifndef BOOST_NO_STD_WSTRING
+        wstr = std::wstring(n, L'\x3bb');
+        #endif
+        for(int j = -n; j < n; ++j){
+            v.push_back(j * j * j);
+            vd.push_back(j * 0.5);
+        }
+    }
+    bool operator==(const A & rhs) const {
+        return c == rhs.c && s == rhs.s && i == rhs.i && l == rhs.l
+            && u == rhs.u && f == rhs.f && d == rhs.d && b == rhs.b
+            && str == rhs.str
+            #ifndef BOOST_NO_STD_WSTRING
+            && wstr == rhs.wstr
+            #endif
+            && v == rhs.v && vd == rhs.vd;
+    }
+};
+
+// the extreme values of every integer size
+template<class T>
+void test_limits(){
+    const T values[] = {
+        0,
+        1,
+        (std::numeric_limits<T>::max)(),
+        (std::numeric_limits<T>::min)(),
+        static_cast<T>((std::numeric_limits<T>::max)() / 2),
+        static_cast<T>((std::numeric_limits<T>::min)() / 2)
+    };
+    std::ostringstream os;
+    {
+        boost::archive::varint_binary_oarchive oa(os);
+        for(std::size_t n = 0; n < sizeof(values) / sizeof(values[0]); ++n)
+            oa << values[n];
+    }
+    std::istringstream is(os.str());
+    boost::archive::varint_binary_iarchive ia(is);
+    for(std::size_t n = 0; n < sizeof(values) / sizeof(values[0]); ++n){
+        T t;
+        ia >> t;
+        BOOST_CHECK(values[n] == t);
+    }
+}
+
+// small integers take a single byte whatever their type
+void test_encoding(){
+    std::ostringstream os;
+    {
+        boost::archive::varint_binary_oarchive oa(
+            os,
+            boost::archive::no_header
+        );
+        const boost::int64_t a = 1;
+        const boost::int64_t b = -1;
+        const int c = 63;
+        const int d = -64;
+        const unsigned int e = 127;
+        const unsigned int f = 128;
+        const int g = 300;
+        oa << a << b << c << d << e << f << g;
+    }
+    const unsigned char expected[] = {
+        0x02, 0x01, 0x7e, 0x7f, 0x7f, 0x80, 0x01, 0xd8, 0x04
+    };
+    const std::string s = os.str();
+    BOOST_REQUIRE(sizeof(expected) == s.size());
+    for(std::size_t n = 0; n < s.size(); ++n)
+        BOOST_CHECK_EQUAL(
+            static_cast<unsigned int>(expected[n]),
+            static_cast<unsigned int>(static_cast<unsigned char>(s[n]))
+        );
+}
+
+// values which don't fit in the type read are rejected
+void test_overflow(){
+    std::ostringstream os;
+    {
+        boost::archive::varint_binary_oarchive oa(os);
+        const int i = 70000;
+        oa << i;
+    }
+    std::istringstream is(os.str());
+    boost::archive::varint_binary_iarchive ia(is);
+    short s;
+    bool thrown = false;
+    try {
+        ia >> s;
+    }
+    catch(boost::archive::archive_exception const &){
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+int
+test_main( int /* argc */, char* /* argv */[] )
+{
+    std::vector<A> as;
+    for(int n = 0; n < 20; ++n)
+        as.push_back(A(n));
+    boost::shared_ptr<A> p1(new A(7));
+    boost::shared_ptr<A> p2(p1);
+
+    std::ostringstream os;
+    {
+        boost::archive::varint_binary_oarchive oa(os);
+        oa << BOOST_SERIALIZATION_NVP(as);
+        oa << BOOST_SERIALIZATION_NVP(p1);
+        oa << BOOST_SERIALIZATION_NVP(p2);
+    }
+    std::vector<A> as1;
+    boost::shared_ptr<A> p3, p4;
+    {
+        std::istringstream is(os.str());
+        boost::archive::varint_binary_iarchive ia(is);
+        ia >> BOOST_SERIALIZATION_NVP(as1);
+        ia >> BOOST_SERIALIZATION_NVP(p3);
+        ia >> BOOST_SERIALIZATION_NVP(p4);
+    }
+    BOOST_CHECK(as == as1);
+    BOOST_REQUIRE(p3);
+    BOOST_CHECK(*p1 == *p3);
+    BOOST_CHECK(p3 == p4);
+
+    // the result is smaller than the native binary archive
+    std::ostringstream bs;
+    {
+        boost::archive::binary_oarchive oa(bs);
+        oa << BOOST_SERIALIZATION_NVP(as);
+        oa << BOOST_SERIALIZATION_NVP(p1);
+        oa << BOOST_SERIALIZATION_NVP(p2);
+    }
+    BOOST_CHECK(os.str().size() < bs.str().size());
+
+    test_limits<signed char>();
+    test_limits<unsigned char>();
+    test_limits<short>();
+    test_limits<unsigned short>();
+    test_limits<int>();
+    test_limits<unsigned int>();
+    test_limits<long>();
+    test_limits<unsigned long>();
+    test_limits<boost::int64_t>();
+    test_limits<boost::uint64_t>();
+    test_encoding();
+    test_overflow();
+
+    // an archive from another format is rejected
+    bool thrown = false;
+    try {
+        std::istringstream is(bs.str());
+        boost::archive::varint_binary_iarchive ia(is);
+    }
+    catch(boost::archive::archive_exception const & e){
+        thrown = true;
+        BOOST_CHECK(
+            boost::archive::archive_exception::invalid_signature == e.code
+        );
+    }
+    BOOST_CHECK(thrown);
+    return EXIT_SUCCESS;
+}
+
+// EOF
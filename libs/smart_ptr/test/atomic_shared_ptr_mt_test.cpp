@@ -0,0 +1,137 @@
+
+// Copyright 2013 Peter Dimov
+//
+// Distributed under the Boost Software License, Version 1.0.
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+
+#include <boost/atomic_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
+
+#include <boost/detail/lightweight_mutex.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/detail/lightweight_thread.hpp>
+
+#include <cstdio>
+#include <ctime>
+
+//
+
+int const n = 256 * 1024;
+
+struct X
+{
+    int v_; // version
+
+    static boost::atomic<int> instances;
+
+    X(): v_( 0 )
+    {
+        ++instances;
+    }
+
+    X( X const & x ): v_( x.v_ )
+    {
+        ++instances;
+    }
+
+    ~X()
+    {
+        --instances;
+    }
+};
+
+boost::atomic<int> X::instances( 0 );
+
+static boost::atomic_shared_ptr<X> aps( boost::shared_ptr<X>( new X ) );
+
+static boost::detail::lightweight_mutex lm;
+
+static int tr = 0;
+
+void reader( int r )
+{
+    int k = 0;
+
+    for( int i = 0; i < n * 2; ++k )
+    {
+        boost::shared_ptr<X> p2 = aps.load();
+
+        BOOST_TEST( p2->v_ >= i );
+        i = p2->v_;
+    }
+
+    printf( "Reader %d: %9d iterations\n", r, k );
+
+    boost::detail::lightweight_mutex::scoped_lock lock( lm );
+    tr += k;
+}
+
+// two writers race to increment the version; compare_exchange makes sure no update is lost
+
+void writer()
+{
+    for( int i = 0; i < n; ++i )
+    {
+        boost::shared_ptr<X> p1 = aps.load();
+
+        for( ;; )
+        {
+            boost::shared_ptr<X> p2( new X( *p1 ) );
+            ++p2->v_;
+
+            if( aps.compare_exchange_weak( p1, p2 ) ) break;
+        }
+    }
+}
+
+#if defined( BOOST_HAS_PTHREADS )
+  char const * thmodel = "POSIX";
+#else
+  char const * thmodel = "Windows";
+#endif
+
+int const mr = 4; // reader threads
+int const mw = 2; // writer threads
+
+int main()
+{
+    using namespace std; // printf, clock_t, clock
+
+    printf( "Using %s threads: %dR + %dW threads, %d iterations, atomic_shared_ptr\n\n", thmodel, mr, mw, n );
+
+    clock_t t = clock();
+
+    pthread_t a[ mr+mw ];
+
+    for( int i = 0; i < mr; ++i )
+    {
+        boost::detail::lw_thread_create( a[ i ], boost::bind( reader, i ) );
+    }
+
+    for( int i = mr; i < mr+mw; ++i )
+    {
+        boost::detail::lw_thread_create( a[ i ], writer );
+    }
+
+    for( int j = 0; j < mr+mw; ++j )
+    {
+        pthread_join( a[ j ], 0 );
+    }
+
+    t = clock() - t;
+
+    double ts = static_cast<double>( t ) / CLOCKS_PER_SEC;
+    printf( "%.3f seconds, %.3f reads per microsecond.\n", ts, tr / ts / 1e+6 );
+
+    BOOST_TEST( aps.load()->v_ == n * mw );
+    BOOST_TEST( X::instances == 1 );
+
+    aps.store( boost::shared_ptr<X>() );
+    BOOST_TEST( X::instances == 0 );
+
+    return boost::report_errors();
+}
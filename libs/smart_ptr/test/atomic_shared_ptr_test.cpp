@@ -0,0 +1,128 @@
+#include <boost/config.hpp>
+
+//  atomic_shared_ptr_test.cpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/atomic_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+//
+
+struct X
+{
+    static int instances;
+
+    X()
+    {
+        ++instances;
+    }
+
+    ~X()
+    {
+        --instances;
+    }
+
+private:
+
+    X( X const & );
+    X & operator=( X const & );
+};
+
+int X::instances = 0;
+
+#define BOOST_TEST_SP_EQ( p, q ) BOOST_TEST( p == q && !( p < q ) && !( q < p ) )
+
+int main()
+{
+    {
+        boost::atomic_shared_ptr<X> apx;
+
+        boost::shared_ptr<X> p0 = apx.load();
+        BOOST_TEST( p0.get() == 0 );
+        BOOST_TEST( p0.use_count() == 0 );
+    }
+
+    {
+        boost::shared_ptr<X> px( new X );
+        boost::atomic_shared_ptr<X> apx( px );
+
+        BOOST_TEST( px.use_count() == 2 );
+
+        boost::shared_ptr<X> p2 = apx.load();
+        BOOST_TEST_SP_EQ( p2, px );
+        BOOST_TEST( px.use_count() == 3 );
+
+        boost::shared_ptr<X> px2( new X );
+        apx.store( px2 );
+        BOOST_TEST_SP_EQ( apx.load(), px2 );
+        BOOST_TEST( px.use_count() == 2 );
+
+        p2 = apx;
+        BOOST_TEST_SP_EQ( p2, px2 );
+
+        boost::shared_ptr<X> px3( new X );
+        boost::shared_ptr<X> p3 = apx.exchange( px3 );
+        BOOST_TEST_SP_EQ( p3, px2 );
+        BOOST_TEST_SP_EQ( apx.load(), px3 );
+
+        boost::shared_ptr<X> px4( new X );
+        boost::shared_ptr<X> cmp;
+
+        bool r = apx.compare_exchange_strong( cmp, px4 );
+        BOOST_TEST( !r );
+        BOOST_TEST_SP_EQ( apx.load(), px3 );
+        BOOST_TEST_SP_EQ( cmp, px3 );
+
+        r = apx.compare_exchange_strong( cmp, px4 );
+        BOOST_TEST( r );
+        BOOST_TEST_SP_EQ( apx.load(), px4 );
+
+        // equivalence requires the same owner, not just the same pointer
+        boost::shared_ptr<X> alias( boost::shared_ptr<X>(), px4.get() );
+        r = apx.compare_exchange_weak( alias, px );
+        BOOST_TEST( !r );
+        BOOST_TEST_SP_EQ( alias, px4 );
+
+        apx = boost::shared_ptr<X>();
+        BOOST_TEST( apx.load().get() == 0 );
+
+        boost::shared_ptr<X> empty;
+        r = apx.compare_exchange_strong( empty, px );
+        BOOST_TEST( r );
+        BOOST_TEST_SP_EQ( apx.load(), px );
+
+        BOOST_TEST( X::instances == 4 );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::atomic_shared_ptr<X> apx( boost::shared_ptr<X>( new X ) );
+        BOOST_TEST( X::instances == 1 );
+
+        apx.store( boost::shared_ptr<X>( new X ) );
+        BOOST_TEST( X::instances == 1 );
+
+        apx.exchange( boost::shared_ptr<X>() );
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    {
+        boost::atomic_shared_ptr<X> apx;
+
+#if defined( __i386__ ) || defined( __x86_64__ ) || defined( _M_IX86 ) || defined( _M_X64 )
+
+        BOOST_TEST( apx.is_lock_free() );
+
+#endif
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,250 @@
+//
+//  local_sp_test.cpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+//
+
+#include <boost/local_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+struct X
+{
+    static int instances;
+
+    X()
+    {
+        ++instances;
+    }
+
+    virtual ~X()
+    {
+        --instances;
+    }
+
+private:
+
+    X( X const & );
+    X & operator=( X const & );
+};
+
+int X::instances = 0;
+
+struct Y: public X
+{
+};
+
+static int deleter_calls = 0;
+
+struct deleter
+{
+    void operator()( X * p ) const
+    {
+        ++deleter_calls;
+        delete p;
+    }
+};
+
+static void default_constructor()
+{
+    boost::local_shared_ptr<X> p;
+
+    BOOST_TEST( p.get() == 0 );
+    BOOST_TEST( !p );
+    BOOST_TEST( p.local_use_count() == 0 );
+
+    boost::shared_ptr<X> q = p;
+
+    BOOST_TEST( q.get() == 0 );
+    BOOST_TEST( q.use_count() == 0 );
+}
+
+static void pointer_constructor()
+{
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::local_shared_ptr<X> p( new X );
+
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( p );
+        BOOST_TEST( p.local_use_count() == 1 );
+
+        {
+            boost::local_shared_ptr<X> p2( p );
+
+            BOOST_TEST( p2 == p );
+            BOOST_TEST( p.local_use_count() == 2 );
+
+            boost::local_shared_ptr<X> p3;
+            p3 = p2;
+
+            BOOST_TEST( p.local_use_count() == 3 );
+        }
+
+        BOOST_TEST( p.local_use_count() == 1 );
+        BOOST_TEST( X::instances == 1 );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::local_shared_ptr<X> p( new Y, deleter() );
+
+        BOOST_TEST( X::instances == 1 );
+
+        p.reset();
+
+        BOOST_TEST( X::instances == 0 );
+        BOOST_TEST( deleter_calls == 1 );
+    }
+}
+
+static void shared_ptr_conversion()
+{
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::shared_ptr<X> q;
+
+        {
+            boost::local_shared_ptr<X> p( new X );
+            boost::local_shared_ptr<X> p2( p );
+
+            q = p;
+
+            BOOST_TEST( q.get() == p.get() );
+            BOOST_TEST( q == p );
+            BOOST_TEST( q.use_count() == 2 );
+            BOOST_TEST( p.local_use_count() == 2 );
+        }
+
+        // the object survives its local owners
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( q.use_count() == 1 );
+
+        boost::weak_ptr<X> w( q );
+        q.reset();
+
+        BOOST_TEST( X::instances == 0 );
+        BOOST_TEST( w.expired() );
+    }
+
+    {
+        boost::shared_ptr<X> q( new X );
+
+        {
+            boost::local_shared_ptr<X> p( q );
+
+            BOOST_TEST( p.get() == q.get() );
+            BOOST_TEST( q.use_count() == 2 );
+            BOOST_TEST( p.local_use_count() == 1 );
+
+            boost::local_shared_ptr<X> p2( p );
+
+            // local copies do not touch the shared count
+            BOOST_TEST( q.use_count() == 2 );
+            BOOST_TEST( p.local_use_count() == 2 );
+        }
+
+        BOOST_TEST( q.use_count() == 1 );
+        BOOST_TEST( X::instances == 1 );
+
+        q.reset();
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    {
+        boost::shared_ptr<X> q;
+        boost::local_shared_ptr<X> p( q );
+
+        BOOST_TEST( !p );
+        BOOST_TEST( p.local_use_count() == 0 );
+    }
+}
+
+static void converting_and_aliasing()
+{
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::local_shared_ptr<Y> py( new Y );
+        boost::local_shared_ptr<X> px( py );
+
+        BOOST_TEST( px.get() == py.get() );
+        BOOST_TEST( py.local_use_count() == 2 );
+
+        boost::local_shared_ptr<Y> py2 = boost::static_pointer_cast<Y>( px );
+        BOOST_TEST( py2 == py );
+
+        boost::local_shared_ptr<Y> py3 = boost::dynamic_pointer_cast<Y>( px );
+        BOOST_TEST( py3 == py );
+        BOOST_TEST( py.local_use_count() == 4 );
+
+        boost::shared_ptr<X> sx = py;
+        BOOST_TEST( sx.get() == px.get() );
+
+        boost::local_shared_ptr<X const> pc( px );
+        boost::local_shared_ptr<X> pnc = boost::const_pointer_cast<X>( pc );
+        BOOST_TEST( pnc == px );
+
+        BOOST_TEST( !( px < py ) && !( py < px ) );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        int i = 0;
+        boost::local_shared_ptr<X> px( new X );
+        boost::local_shared_ptr<int> pi( px, &i );
+
+        BOOST_TEST( pi.get() == &i );
+        BOOST_TEST( px.local_use_count() == 2 );
+
+        px.reset();
+        BOOST_TEST( X::instances == 1 );
+
+        pi.reset();
+        BOOST_TEST( X::instances == 0 );
+    }
+}
+
+static void swap_and_reset()
+{
+    boost::local_shared_ptr<X> p1( new X );
+    boost::local_shared_ptr<X> p2;
+
+    X * px = p1.get();
+
+    swap( p1, p2 );
+
+    BOOST_TEST( p1.get() == 0 );
+    BOOST_TEST( p2.get() == px );
+
+    p1.reset( new X );
+    BOOST_TEST( X::instances == 2 );
+
+    p1 = p2;
+    BOOST_TEST( X::instances == 1 );
+    BOOST_TEST( p1.local_use_count() == 2 );
+
+    p1.reset();
+    p2.reset();
+    BOOST_TEST( X::instances == 0 );
+}
+
+int main()
+{
+    default_constructor();
+    pointer_constructor();
+    shared_ptr_conversion();
+    converting_and_aliasing();
+    swap_and_reset();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,176 @@
+//  make_local_shared_test.cpp
+//
+//  Copyright 2013 Peter Dimov
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/make_local_shared.hpp>
+#include <boost/local_shared_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <cstddef>
+
+class X
+{
+private:
+
+    X( X const & );
+    X & operator=( X const & );
+
+    void * operator new( std::size_t n )
+    {
+        // lack of this definition causes link errors on Comeau C++
+        BOOST_ERROR( "private X::new called" );
+        return ::operator new( n );
+    }
+
+    void operator delete( void * p )
+    {
+        // lack of this definition causes link errors on MSVC
+        BOOST_ERROR( "private X::delete called" );
+        ::operator delete( p );
+    }
+
+public:
+
+    static int instances;
+
+    int v;
+
+    explicit X( int a1 = 0, int a2 = 0, int a3 = 0, int a4 = 0, int a5 = 0, int a6 = 0 ): v( a1+a2+a3+a4+a5+a6 )
+    {
+        ++instances;
+    }
+
+    ~X()
+    {
+        --instances;
+    }
+};
+
+int X::instances = 0;
+
+struct Throws
+{
+    explicit Throws( int )
+    {
+        throw 5;
+    }
+};
+
+int main()
+{
+    {
+        boost::local_shared_ptr< int > pi = boost::make_local_shared< int >();
+
+        BOOST_TEST( pi.get() != 0 );
+        BOOST_TEST( pi.local_use_count() == 1 );
+        BOOST_TEST( *pi == 0 );
+    }
+
+    {
+        boost::local_shared_ptr< int > pi = boost::make_local_shared< int >( 5 );
+
+        BOOST_TEST( pi.get() != 0 );
+        BOOST_TEST( *pi == 5 );
+
+        boost::local_shared_ptr< int > pi2( pi );
+        BOOST_TEST( pi.local_use_count() == 2 );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        boost::local_shared_ptr< X > pi = boost::make_local_shared< X >();
+
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( pi.get() != 0 );
+        BOOST_TEST( pi->v == 0 );
+
+        pi.reset();
+
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    {
+        boost::local_shared_ptr< X > pi = boost::make_local_shared_noinit< X >();
+
+        BOOST_TEST( X::instances == 1 );
+
+        pi.reset();
+
+        BOOST_TEST( X::instances == 0 );
+    }
+
+    {
+        boost::local_shared_ptr< X > pi = boost::make_local_shared< X >( 1, 2, 3, 4, 5, 6 );
+
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( pi->v == 1+2+3+4+5+6 );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    {
+        // conversion to shared_ptr keeps the object alive after the local owners are gone
+
+        boost::shared_ptr< X > sp;
+        boost::weak_ptr< X > wp;
+
+        {
+            boost::local_shared_ptr< X > pi = boost::make_local_shared< X >( 1, 2 );
+            boost::local_shared_ptr< X > pi2( pi );
+
+            sp = pi;
+            wp = sp;
+
+            BOOST_TEST( sp.get() == pi.get() );
+            BOOST_TEST( sp.use_count() == 2 );
+            BOOST_TEST( pi.local_use_count() == 2 );
+        }
+
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( sp.use_count() == 1 );
+        BOOST_TEST( sp->v == 3 );
+
+        sp.reset();
+
+        BOOST_TEST( X::instances == 0 );
+        BOOST_TEST( wp.expired() );
+    }
+
+    {
+        // local owners outliving the converted shared_ptr
+
+        boost::local_shared_ptr< X > pi = boost::make_local_shared< X >( 7 );
+
+        {
+            boost::shared_ptr< X > sp = pi;
+            boost::shared_ptr< X > sp2 = pi;
+
+            BOOST_TEST( sp.use_count() == 3 );
+        }
+
+        BOOST_TEST( X::instances == 1 );
+        BOOST_TEST( pi->v == 7 );
+
+        boost::shared_ptr< X > sp3 = pi;
+        BOOST_TEST( sp3.use_count() == 2 );
+    }
+
+    BOOST_TEST( X::instances == 0 );
+
+    try
+    {
+        boost::make_local_shared< Throws >( 1 );
+        BOOST_ERROR( "make_local_shared< Throws > did not throw" );
+    }
+    catch( int )
+    {
+    }
+
+    return boost::report_errors();
+}
@@ -503,6 +503,32 @@ main()
         //]
     }
 
+    {
+        //[reference_using_declarations_memoize
+        using boost::spirit::qi::memoize;
+        using boost::spirit::qi::memo_table;
+        using boost::spirit::qi::hold;
+        using boost::spirit::qi::int_;
+        using boost::spirit::qi::rule;
+        using boost::spirit::ascii::space_type;
+        //]
+
+        //[reference_memoize
+        /*`Both alternatives start with the rule `list`, which is parsed only
+           once. The second alternative takes its outcome from the table. */
+
+        memo_table<char const*> t;
+        rule<char const*, std::vector<int>(), space_type> list = int_ % ',';
+        list.name("list");
+
+        std::vector<int> v;
+        test_phrase_parser_attr("1, 2, 3.",
+              hold[memoize(t)[list] >> ';'] | memoize(t)[list] >> '.', v);
+        std::cout << v.size() << std::endl;     // will output: >3<
+        t.report(std::cout);            // will output: >list: 2 calls, 1 re-parses<
+        //]
+    }
+
     {
         //[reference_using_declarations_no_case
         using boost::spirit::ascii::no_case;
@@ -101,6 +101,26 @@ int main()
         cout << "double_: " << t.elapsed() << " [s]" << flush << endl;
     }
 
+    // test the Karma generation of the shortest round trip representation
+    {
+        typedef karma::real_generator<double
+          , karma::shortest_real_policies<double> > shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        std::string str;
+        util::high_resolution_timer t;
+
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            char *ptr = buffer;
+            karma::generate(ptr, shortest, v[i]);
+            *ptr = '\0';
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "shortest: " << t.elapsed() << " [s]" << flush << endl;
+    }
+
     return 0;
 }
 
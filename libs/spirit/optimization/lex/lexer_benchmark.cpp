@@ -0,0 +1,178 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Compares the dynamic lexer (lexertl::lexer) with the static lexers
+//  generated by lexer_generate.cpp on a large token stream: the table driven
+//  one (generate_static_dfa), the one testing characters in chains of
+//  comparisons (generate_static_switch) and the one switching on characters
+//  and looking up keywords in a perfect hash (generate_static_scanner).
+//  Run lexer_generate again after changing lexer_tokens.hpp.
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_static_lexertl.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "../high_resolution_timer.hpp"
+#include "lexer_tokens.hpp"
+#include "lexer_static_dfa.hpp"
+#include "lexer_static_switch.hpp"
+#include "lexer_static_scanner.hpp"
+
+namespace lex = boost::spirit::lex;
+
+///////////////////////////////////////////////////////////////////////////////
+//  a pseudo random configuration file of about the given size
+std::string make_input(std::size_t size)
+{
+    char const* const words[] = {
+        "module", "import", "const", "var", "function", "return", "if",
+        "else", "elif", "while", "for", "in", "true", "false", "null", "and",
+        "or", "not", "section", "end", "value", "index", "count", "name",
+        "path", "retry_timeout", "max_connections", "x", "i", "buffer_size",
+        "server1", "iff", "endpoint", "infinity", "variable", "format"
+    };
+    char const* const others[] = {
+        "0", "1", "42", "3.14159", "1e-9", "65536", "\"a string\"",
+        "\"C:\\\\path\\\\to\\\\file\"", "==", "!=", "<=", "&&", "||", "=",
+        "+", "(", ")", "{", "}", "[", "]", ";", ",", ".", ":"
+    };
+    std::size_t const word_count = sizeof(words) / sizeof(words[0]);
+    std::size_t const other_count = sizeof(others) / sizeof(others[0]);
+
+    std::string input;
+    input.reserve(size + 100);
+    unsigned int seed = 12345;
+    while (input.size() < size)
+    {
+        seed = seed * 1103515245u + 12345u;
+        unsigned int const r = seed >> 16;
+        switch (r % 16)
+        {
+        case 0:
+            input += "\n    # a comment about the next line\n    ";
+            break;
+        case 1: case 2: case 3: case 4:
+            input += others[(r >> 4) % other_count];
+            input += ' ';
+            break;
+        case 5:
+            input += ";\n    ";
+            break;
+        default:
+            input += words[(r >> 4) % word_count];
+            input += ' ';
+            break;
+        }
+    }
+    return input;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//  print the best of the measured times
+void report(char const* name, double elapsed, std::size_t tokens
+  , std::size_t size, std::size_t ids)
+{
+    std::cout << name << ": " << elapsed << " [s], "
+        << (tokens / elapsed / 1e6) << " [Mtokens/s], "
+        << (size / elapsed / (1024 * 1024)) << " [MB/s] (" << ids << ")"
+        << std::endl;
+}
+
+//  run the token iterator of the lexer over the input
+template <typename Lexer>
+void measure_tokens(char const* name, Lexer const& lexer
+  , std::string const& input, int repeats)
+{
+    double best = 0;
+    std::size_t tokens = 0;
+    std::size_t ids = 0;
+    for (int i = 0; i < repeats; ++i)
+    {
+        util::high_resolution_timer t;
+        char const* first = input.data();
+        char const* last = first + input.size();
+        typename Lexer::iterator_type it = lexer.begin(first, last);
+        typename Lexer::iterator_type end = lexer.end();
+        for (tokens = 0, ids = 0; it != end && token_is_valid(*it); ++it, ++tokens)
+            ids += it->id();
+
+        double const elapsed = t.elapsed();
+        if (i == 0 || elapsed < best)
+            best = elapsed;
+    }
+    report(name, best, tokens, input.size(), ids);
+}
+
+//  call the generated tokenizing function directly
+template <typename StaticLexer>
+void measure_next(char const* name, std::string const& input, int repeats)
+{
+    double best = 0;
+    std::size_t tokens = 0;
+    std::size_t ids = 0;
+    for (int i = 0; i < repeats; ++i)
+    {
+        util::high_resolution_timer t;
+        char const* first = input.data();
+        char const* last = first + input.size();
+        std::size_t state = 0;
+        bool bol = true;
+        std::size_t unique_id = 0;
+        for (tokens = 0, ids = 0; first != last; ++tokens)
+        {
+            std::size_t const id =
+                StaticLexer::next(state, bol, first, last, unique_id);
+            if (id == boost::lexer::npos)
+                break;
+            ids += id;
+        }
+
+        double const elapsed = t.elapsed();
+        if (i == 0 || elapsed < best)
+            best = elapsed;
+    }
+    report(name, best, tokens, input.size(), ids);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    typedef lex::lexertl::token<
+        char const*, lex::omit, boost::mpl::false_
+    > token_type;
+
+    std::string const input = make_input(16 * 1024 * 1024);
+    int const repeats = 7;
+    std::cout << input.size() << " bytes, best of " << repeats << " runs"
+        << std::endl;
+
+    // the dynamic lexer builds its DFA when the first iterator is created
+    util::high_resolution_timer t;
+    config_tokens<lex::lexertl::lexer<token_type> > dynamic;
+    char const* first = input.data();
+    dynamic.begin(first, first);
+    std::cout << "building the dynamic DFA: " << t.elapsed() << " [s]"
+        << std::endl;
+
+    measure_tokens("dynamic     ", dynamic, input, repeats);
+    measure_tokens("static dfa  ", config_tokens<lex::lexertl::static_lexer<
+        token_type, lex::lexertl::static_::lexer_dfa> >(), input, repeats);
+    measure_tokens("static switch", config_tokens<lex::lexertl::static_lexer<
+        token_type, lex::lexertl::static_::lexer_switch> >(), input, repeats);
+    measure_tokens("static scanner", config_tokens<lex::lexertl::static_lexer<
+        token_type, lex::lexertl::static_::lexer_scanner> >(), input, repeats);
+
+    std::cout << "calling the generated functions directly" << std::endl;
+    measure_next<lex::lexertl::static_::lexer_dfa>(
+        "static dfa  ", input, repeats);
+    measure_next<lex::lexertl::static_::lexer_switch>(
+        "static switch", input, repeats);
+    measure_next<lex::lexertl::static_::lexer_scanner>(
+        "static scanner", input, repeats);
+    return 0;
+}
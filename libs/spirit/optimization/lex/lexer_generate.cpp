@@ -0,0 +1,35 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Generates the three static lexers compared by lexer_benchmark.cpp from
+//  the token definitions in lexer_tokens.hpp:
+//
+//    lexer_static_dfa.hpp        generate_static_dfa
+//    lexer_static_switch.hpp     generate_static_switch
+//    lexer_static_scanner.hpp    generate_static_scanner
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_generate_static_lexertl.hpp>
+
+#include <fstream>
+
+#include "lexer_tokens.hpp"
+
+namespace lex = boost::spirit::lex;
+
+int main()
+{
+    config_tokens<lex::lexertl::lexer<> > tokens;
+
+    std::ofstream dfa("lexer_static_dfa.hpp");
+    std::ofstream switch_("lexer_static_switch.hpp");
+    std::ofstream scanner("lexer_static_scanner.hpp");
+
+    return lex::lexertl::generate_static_dfa(tokens, dfa, "dfa") &&
+        lex::lexertl::generate_static_switch(tokens, switch_, "switch") &&
+        lex::lexertl::generate_static_scanner(tokens, scanner, "scanner") ?
+            0 : -1;
+}
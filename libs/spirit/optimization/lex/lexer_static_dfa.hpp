@@ -0,0 +1,820 @@
+// Copyright (c) 2008-2009 Ben Hanson
+// Copyright (c) 2008-2011 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Auto-generated by boost::lexer, do not edit
+
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_DFA_OCT_19_2026_06_57_31)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_DFA_OCT_19_2026_06_57_31
+
+#include <boost/detail/iterator.hpp>
+#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+// the generated table of state names and the tokenizer have to be
+// defined in the boost::spirit::lex::lexertl::static_ namespace
+namespace boost { namespace spirit { namespace lex { namespace lexertl { namespace static_ {
+
+////////////////////////////////////////////////////////////////////////////////
+// this table defines the names of the lexer states
+char const* const lexer_state_names_dfa[1] = 
+{
+    "INITIAL"
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// this variable defines the number of lexer states
+std::size_t const lexer_state_count_dfa = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+// this function returns the next matched token
+template<typename Iterator>
+std::size_t next_token_dfa (std::size_t& /*start_state_*/, bool& /*bol_*/, 
+    Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+{
+    enum {end_state_index, id_index, unique_id_index, state_index, bol_index,
+        eol_index, dead_state_index, dfa_offset};
+
+    static std::size_t const npos = static_cast<std::size_t>(~0);
+    static std::size_t const lookup_[256] = {
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 8, 7, 45, 45, 8, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        8, 9, 11, 12, 45, 10, 13, 45,
+        10, 10, 10, 14, 10, 14, 15, 10,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 10, 10, 18, 19, 20, 45,
+        45, 17, 17, 17, 17, 21, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 10, 22, 10, 45, 17,
+        45, 23, 24, 25, 26, 27, 28, 17,
+        29, 30, 17, 31, 32, 33, 34, 35,
+        36, 17, 37, 38, 39, 40, 41, 42,
+        43, 17, 17, 10, 44, 10, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45,
+        45, 45, 45, 45, 45, 45, 45, 45 };
+    static std::size_t const dfa_alphabet_ = 46;
+    static std::size_t const dfa_[5290] = {
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 20, 20, 21,
+        24, 18, 19, 22, 24, 24, 17, 16,
+        21, 21, 21, 16, 0, 13, 10, 5,
+        16, 4, 7, 16, 3, 16, 16, 2,
+        12, 14, 16, 8, 15, 11, 16, 6,
+        9, 16, 23, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 25,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 27, 16,
+        16, 16, 16, 26, 28, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        30, 16, 31, 16, 16, 16, 16, 16,
+        16, 16, 16, 29, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 32, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 33, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 36, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 35, 16, 16,
+        16, 16, 34, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 37, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 38, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 39, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 40,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 42, 16, 16, 16, 16,
+        41, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        43, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 44, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 45, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65561,
+        25, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 46, 17, 0,
+        0, 0, 0, 47, 0, 0, 0, 0,
+        0, 47, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 18, 18, 18, 18, 49,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 48, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 1, 65563, 27, 0, 0, 0,
+        0, 0, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19,
+        1, 65564, 28, 0, 0, 0, 0, 20,
+        20, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65565,
+        29, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 24, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 24, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 24, 0,
+        1, 65565, 29, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        50, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        51, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65543, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65548, 12, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 52, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 53, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 55, 16, 16, 16, 16, 16,
+        16, 16, 54, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 56, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 57, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 58, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 59, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 60,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        61, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 62, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 63, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 64, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        65, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 66, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 67, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 68, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65555, 19, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 69,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 70, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        71, 0, 72, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 1, 65562,
+        26, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 73, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 74, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        75, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 76, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 77,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 78, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65559, 23, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 79, 80, 16, 16,
+        16, 16, 0, 0, 1, 65540, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 81, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65547, 11, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 82, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 83, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 84, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 85,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 86, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 87, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65556, 20, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65554, 18, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 88, 16, 16,
+        16, 16, 0, 0, 1, 65561, 25, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 70, 0, 0, 0,
+        0, 47, 0, 0, 0, 0, 0, 47,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 72, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 65561, 25, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        72, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 89, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 90, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 91, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 92, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65544,
+        8, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65545, 9, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 93, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 94, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 95, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 96,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 97,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 98, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 99, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65551, 15, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65553, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 100, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 101, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 102, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 103, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 104,
+        16, 16, 16, 16, 0, 0, 1, 65539,
+        3, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 105, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        106, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65552, 16, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        107, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65546, 10, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65549, 13, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 108, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65536,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65537, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 109, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65538, 2, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65560,
+        24, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 110, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 111,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65542, 6, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65560, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 112, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65557,
+        21, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65560, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 113,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0, 1, 65560, 24, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 16, 16, 0, 0, 0, 16,
+        0, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 114, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 0, 0,
+        1, 65558, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 0, 0, 0, 16, 0, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 0, 0, 1, 65550,
+        14, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 16, 16,
+        0, 0, 0, 16, 0, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 0, 0, 1, 65541, 5, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 16, 16, 0, 0,
+        0, 16, 0, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16,
+        0, 0 };
+
+    if (start_token_ == end_)
+    {
+        unique_id_ = npos;
+        return 0;
+    }
+
+    std::size_t const* ptr_ = dfa_ + dfa_alphabet_;
+    Iterator curr_ = start_token_;
+    bool end_state_ = *ptr_ != 0;
+    std::size_t id_ = *(ptr_ + id_index);
+    std::size_t uid_ = *(ptr_ + unique_id_index);
+    Iterator end_token_ = start_token_;
+
+    while (curr_ != end_)
+    {
+        std::size_t const state_ =
+            ptr_[lookup_[static_cast<unsigned char>(*curr_++)]];
+
+        if (state_ == 0) break;
+
+        ptr_ = &dfa_[state_ * dfa_alphabet_];
+
+        if (*ptr_)
+        {
+            end_state_ = true;
+            id_ = *(ptr_ + id_index);
+            uid_ = *(ptr_ + unique_id_index);
+            end_token_ = curr_;
+        }
+    }
+
+    if (end_state_)
+    {
+        // return longest match
+        start_token_ = end_token_;
+    }
+    else
+    {
+        id_ = npos;
+        uid_ = npos;
+    }
+
+    unique_id_ = uid_;
+    return id_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// this defines a generic accessors for the information above
+struct lexer_dfa
+{
+    // version number and feature-set of compatible static lexer engine
+    enum
+    {
+        static_version = 65536,
+        supports_bol = false,
+        supports_eol = false
+    };
+
+    // return the number of lexer states
+    static std::size_t state_count()
+    {
+        return lexer_state_count_dfa; 
+    }
+
+    // return the name of the lexer state as given by 'idx'
+    static char const* state_name(std::size_t idx)
+    {
+        return lexer_state_names_dfa[idx]; 
+    }
+
+    // return the next matched token
+    template<typename Iterator>
+    static std::size_t next(std::size_t &start_state_, bool& bol_
+      , Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+    {
+        return next_token_dfa(start_state_, bol_, start_token_, end_, unique_id_);
+    }
+};
+
+}}}}}  // namespace boost::spirit::lex::lexertl::static_
+
+#endif
@@ -0,0 +1,453 @@
+// Copyright (c) 2008-2009 Ben Hanson
+// Copyright (c) 2008-2011 Hartmut Kaiser
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Auto-generated by boost::lexer, do not edit
+
+#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_SCANNER_OCT_19_2026_06_57_31)
+#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_SCANNER_OCT_19_2026_06_57_31
+
+#include <boost/detail/iterator.hpp>
+#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+// the generated table of state names and the tokenizer have to be
+// defined in the boost::spirit::lex::lexertl::static_ namespace
+namespace boost { namespace spirit { namespace lex { namespace lexertl { namespace static_ {
+
+////////////////////////////////////////////////////////////////////////////////
+// this table defines the names of the lexer states
+char const* const lexer_state_names_scanner[1] = 
+{
+    "INITIAL"
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// this variable defines the number of lexer states
+std::size_t const lexer_state_count_scanner = 1;
+
+////////////////////////////////////////////////////////////////////////////////
+// this function returns the next matched token
+template<typename Iterator>
+std::size_t next_token_scanner (std::size_t& /*start_state_*/, bool& /*bol_*/, 
+    Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+{
+    static std::size_t const npos = static_cast<std::size_t>(~0);
+
+    if (start_token_ == end_)
+    {
+        unique_id_ = npos;
+        return 0;
+    }
+
+    Iterator curr_ = start_token_;
+    bool end_state_ = false;
+    std::size_t id_ = npos;
+    std::size_t uid_ = npos;
+    Iterator end_token_ = start_token_;
+
+    char ch_ = 0;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case 'A': case 'B': case 'C': case 'D': case 'E': case 'F':
+    case 'G': case 'H': case 'I': case 'J': case 'K': case 'L':
+    case 'M': case 'N': case 'O': case 'P': case 'Q': case 'R':
+    case 'S': case 'T': case 'U': case 'V': case 'W': case 'X':
+    case 'Y': case 'Z': case '_': case 'a': case 'b': case 'c':
+    case 'd': case 'e': case 'f': case 'g': case 'h': case 'i':
+    case 'j': case 'k': case 'l': case 'm': case 'n': case 'o':
+    case 'p': case 'q': case 'r': case 's': case 't': case 'u':
+    case 'v': case 'w': case 'x': case 'y': case 'z':
+        goto state0_1;
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_2;
+    case '"':
+        goto state0_3;
+    case '#':
+        goto state0_4;
+    case 9: case 10: case 13: case ' ':
+        goto state0_5;
+    case '!': case '<': case '=': case '>':
+        goto state0_6;
+    case '&':
+        goto state0_7;
+    case '|':
+        goto state0_8;
+    case '%': case '(': case ')': case '*': case '+': case ',':
+    case '-': case '.': case '/': case ':': case ';': case '[':
+    case ']': case '{': case '}':
+        goto state0_9;
+    default:
+        goto end;
+    }
+
+state0_1:
+    end_state_ = true;
+    id_ = 65560;
+    uid_ = 24;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9': case 'A': case 'B':
+    case 'C': case 'D': case 'E': case 'F': case 'G': case 'H':
+    case 'I': case 'J': case 'K': case 'L': case 'M': case 'N':
+    case 'O': case 'P': case 'Q': case 'R': case 'S': case 'T':
+    case 'U': case 'V': case 'W': case 'X': case 'Y': case 'Z':
+    case '_': case 'a': case 'b': case 'c': case 'd': case 'e':
+    case 'f': case 'g': case 'h': case 'i': case 'j': case 'k':
+    case 'l': case 'm': case 'n': case 'o': case 'p': case 'q':
+    case 'r': case 's': case 't': case 'u': case 'v': case 'w':
+    case 'x': case 'y': case 'z':
+        goto state0_1;
+    default:
+        goto end;
+    }
+
+state0_2:
+    end_state_ = true;
+    id_ = 65561;
+    uid_ = 25;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_2;
+    case '.':
+        goto state0_10;
+    case 'E': case 'e':
+        goto state0_11;
+    default:
+        goto end;
+    }
+
+state0_3:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '\\':
+        goto state0_12;
+    case '"':
+        goto state0_13;
+    default:
+        goto state0_3;
+    }
+
+state0_4:
+    end_state_ = true;
+    id_ = 65563;
+    uid_ = 27;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case 10:
+        goto end;
+    default:
+        goto state0_4;
+    }
+
+state0_5:
+    end_state_ = true;
+    id_ = 65564;
+    uid_ = 28;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case 9: case 10: case 13: case ' ':
+        goto state0_5;
+    default:
+        goto end;
+    }
+
+state0_6:
+    end_state_ = true;
+    id_ = 65565;
+    uid_ = 29;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '=':
+        goto state0_9;
+    default:
+        goto end;
+    }
+
+state0_7:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '&':
+        goto state0_9;
+    default:
+        goto end;
+    }
+
+state0_8:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '|':
+        goto state0_9;
+    default:
+        goto end;
+    }
+
+state0_9:
+    end_state_ = true;
+    id_ = 65565;
+    uid_ = 29;
+    end_token_ = curr_;
+    goto end;
+
+state0_10:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_14;
+    default:
+        goto end;
+    }
+
+state0_11:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '+': case '-':
+        goto state0_15;
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_16;
+    default:
+        goto end;
+    }
+
+state0_12:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    default:
+        goto state0_3;
+    }
+
+state0_13:
+    end_state_ = true;
+    id_ = 65562;
+    uid_ = 26;
+    end_token_ = curr_;
+    goto end;
+
+state0_14:
+    end_state_ = true;
+    id_ = 65561;
+    uid_ = 25;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case 'E': case 'e':
+        goto state0_11;
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_14;
+    default:
+        goto end;
+    }
+
+state0_15:
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_16;
+    default:
+        goto end;
+    }
+
+state0_16:
+    end_state_ = true;
+    id_ = 65561;
+    uid_ = 25;
+    end_token_ = curr_;
+
+    if (curr_ == end_) goto end;
+    ch_ = *curr_;
+    ++curr_;
+
+    switch (static_cast<unsigned char>(ch_))
+    {
+    case '0': case '1': case '2': case '3': case '4': case '5':
+    case '6': case '7': case '8': case '9':
+        goto state0_16;
+    default:
+        goto end;
+    }
+
+end:
+    if (end_state_ && uid_ == 24)
+    {
+        // the keywords matched by this rule
+        static char const* const keywords_[32] = {
+            "", "", "else", "module",
+            "elif", "in", "end", "",
+            "", "return", "export", "false",
+            "break", "null", "true", "",
+            "not", "import", "section", "include",
+            "continue", "", "or", "function",
+            "", "", "if", "while",
+            "var", "const", "for", "and" };
+        static std::size_t const keyword_lengths_[32] = {
+            npos, npos, 4, 6, 4, 2, 3, npos,
+            npos, 6, 6, 5, 5, 4, 4, npos,
+            3, 6, 7, 7, 8, npos, 2, 8,
+            npos, npos, 2, 5, 3, 5, 3, 3 };
+        static std::size_t const keyword_ids_[32] = {
+            npos, npos, 65544, 65536, 65545, 65548, 65559, npos,
+            npos, 65542, 65538, 65552, 65549, 65553, 65551, npos,
+            65556, 65537, 65558, 65557, 65550, npos, 65555, 65541,
+            npos, npos, 65543, 65546, 65540, 65539, 65547, 65554 };
+        static std::size_t const keyword_uids_[32] = {
+            npos, npos, 8, 0, 9, 12, 23, npos,
+            npos, 6, 2, 16, 13, 17, 15, npos,
+            20, 1, 22, 21, 14, npos, 19, 5,
+            npos, npos, 7, 10, 4, 3, 11, 18 };
+
+        char kw_[8];
+        std::size_t len_ = 0;
+        Iterator it_ = start_token_;
+        for (/**/; it_ != end_token_ && len_ != 8; ++it_, ++len_)
+        {
+            kw_[len_] = *it_;
+        }
+
+        if (it_ == end_token_ && len_ >= 2)
+        {
+            std::size_t const h_ = (((static_cast<unsigned char>(kw_[0]) << 8) ^
+                static_cast<unsigned char>(kw_[len_ - 1]) ^ (len_ << 4)) * 2959) & 0xffff;
+            std::size_t const i_ = h_ >> 11;
+            if (keyword_lengths_[i_] == len_)
+            {
+                std::size_t n_ = 0;
+                while (n_ != len_ && kw_[n_] == keywords_[i_][n_])
+                    ++n_;
+                if (n_ == len_)
+                {
+                    id_ = keyword_ids_[i_];
+                    uid_ = keyword_uids_[i_];
+                }
+            }
+        }
+    }
+
+    if (end_state_)
+    {
+        // return longest match
+        start_token_ = end_token_;
+    }
+    else
+    {
+        id_ = npos;
+        uid_ = npos;
+    }
+
+    unique_id_ = uid_;
+    return id_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// this defines a generic accessors for the information above
+struct lexer_scanner
+{
+    // version number and feature-set of compatible static lexer engine
+    enum
+    {
+        static_version = 65536,
+        supports_bol = false,
+        supports_eol = false
+    };
+
+    // return the number of lexer states
+    static std::size_t state_count()
+    {
+        return lexer_state_count_scanner; 
+    }
+
+    // return the name of the lexer state as given by 'idx'
+    static char const* state_name(std::size_t idx)
+    {
+        return lexer_state_names_scanner[idx]; 
+    }
+
+    // return the next matched token
+    template<typename Iterator>
+    static std::size_t next(std::size_t &start_state_, bool& bol_
+      , Iterator &start_token_, Iterator const& end_, std::size_t& unique_id_)
+    {
+        return next_token_scanner(start_state_, bol_, start_token_, end_, unique_id_);
+    }
+};
+
+}}}}}  // namespace boost::spirit::lex::lexertl::static_
+
+#endif
@@ -0,0 +1,36 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(SPIRIT_LEXER_BENCHMARK_TOKENS_OCT_19_2013)
+#define SPIRIT_LEXER_BENCHMARK_TOKENS_OCT_19_2013
+
+#include <boost/spirit/include/lex.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+//  The tokens of a small configuration language, shared by the generator of
+//  the static lexers and by the benchmark
+template <typename Lexer>
+struct config_tokens : boost::spirit::lex::lexer<Lexer>
+{
+    config_tokens()
+    {
+        this->self.add_pattern("IDENT", "[a-zA-Z_][a-zA-Z0-9_]*");
+
+        this->self.add
+            ("module")("import")("export")("const")("var")("function")
+            ("return")("if")("else")("elif")("while")("for")("in")("break")
+            ("continue")("true")("false")("null")("and")("or")("not")
+            ("include")("section")("end")
+            ("{IDENT}")
+            ("[0-9]+(\\.[0-9]+)?([eE][-+]?[0-9]+)?")
+            ("\\\"([^\\\"\\\\]|\\\\.)*\\\"")
+            ("#[^\\n]*")
+            ("[ \\t\\r\\n]+")
+            ("==|!=|<=|>=|&&|\\|\\||[-+*/%=<>!(){}\\[\\];,.:]")
+        ;
+    }
+};
+
+#endif
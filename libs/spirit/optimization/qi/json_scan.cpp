@@ -0,0 +1,123 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+//  Measures a JSON-like grammar, where most of the input is whitespace
+//  skipped by the skipper and runs of string characters. Build it again
+//  with BOOST_SPIRIT_NO_SIMD defined to compare with the scans testing
+//  one character at a time.
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace qi = boost::spirit::qi;
+namespace ascii = boost::spirit::ascii;
+
+///////////////////////////////////////////////////////////////////////////////
+// A JSON-like recognizer, and a variant collecting the strings
+template <typename Iterator, typename String>
+struct json : qi::grammar<Iterator, ascii::space_type>
+{
+    json() : json::base_type(value)
+    {
+        using qi::lexeme;
+        using qi::lit;
+        using qi::double_;
+        using ascii::char_;
+        using ascii::alnum;
+
+        value = object | array | string | double_
+            | lit("true") | lit("false") | lit("null");
+        object = '{' >> -(member % ',') >> '}';
+        member = (string | key) >> ':' >> value;
+        array = '[' >> -(value % ',') >> ']';
+        string = lexeme['"' >> *~char_('"') >> '"'];
+        key = lexeme[+alnum];
+    }
+
+    qi::rule<Iterator, ascii::space_type> value, object, member, array;
+    qi::rule<Iterator, String(), ascii::space_type> string, key;
+};
+
+// entries of a few short strings and numbers, each one followed by a
+// text of text_size characters, indented by indent spaces
+std::string make_document(int entries, int text_size, int indent)
+{
+    std::string const pad(indent, ' ');
+    std::string text;
+    while (int(text.size()) < text_size)
+        text += "a string value with several words in it, ";
+    text.resize(text_size);
+
+    std::ostringstream out;
+    out << "[\n";
+    for (int i = 0; i < entries; ++i)
+    {
+        out << (i ? ",\n" : "")
+            << pad << "{\n"
+            << pad << pad << "\"id\"          : " << i << ",\n"
+            << pad << pad << "\"name\"        : \"entry number " << i << "\",\n"
+            << pad << pad << "tags            : [ \"alpha\", \"beta\", \"gamma\" ],\n"
+            << pad << pad << "\"nested\"      : {\n"
+            << pad << pad << pad << "\"ratio\"   : 0.25,\n"
+            << pad << pad << pad << "\"enabled\" : true,\n"
+            << pad << pad << pad << "\"parent\"  : null\n"
+            << pad << pad << "},\n"
+            << pad << pad << "\"text\"        : \"" << text << "\"\n"
+            << pad << "}";
+    }
+    out << "\n]\n";
+    return out.str();
+}
+
+template <typename Grammar>
+void measure(char const* name, Grammar const& g, std::string const& doc
+  , int repeats)
+{
+    util::high_resolution_timer t;
+    bool ok = true;
+    for (int i = 0; i < repeats; ++i)
+    {
+        std::string::const_iterator first = doc.begin();
+        ok = qi::phrase_parse(first, doc.end(), g, ascii::space)
+            && first == doc.end() && ok;
+    }
+    double elapsed = t.elapsed();
+    std::cout << name << ": " << elapsed << " [s], "
+        << (double(doc.size()) * repeats / elapsed / (1024 * 1024))
+        << " [MB/s]" << (ok ? "" : " (parse failed)") << std::endl;
+}
+
+template <typename Iterator>
+void measure_document(char const* name, std::string const& doc, int repeats)
+{
+    std::cout << name << ", " << doc.size() << " bytes x " << repeats
+        << std::endl;
+    measure("    recognize", json<Iterator, qi::unused_type>(), doc, repeats);
+    measure("    strings  ", json<Iterator, std::string>(), doc, repeats);
+}
+
+int main()
+{
+#if defined(BOOST_SPIRIT_QI_AVX2)
+    std::cout << "AVX2 scans" << std::endl;
+#elif defined(BOOST_SPIRIT_QI_SSE2)
+    std::cout << "SSE2 scans" << std::endl;
+#else
+    std::cout << "scalar scans" << std::endl;
+#endif
+
+    typedef std::string::const_iterator iterator_type;
+    measure_document<iterator_type>("compact, short strings"
+      , make_document(4000, 20, 1), 100);
+    measure_document<iterator_type>("indented, medium strings"
+      , make_document(2000, 100, 4), 100);
+    measure_document<iterator_type>("deeply indented, long strings"
+      , make_document(500, 2000, 24), 100);
+    return 0;
+}
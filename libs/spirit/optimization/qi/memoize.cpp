@@ -0,0 +1,99 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+//  Measures a grammar whose alternatives share their prefixes, parsing
+//  nested parentheses with and without memoize(table)[], and reports the
+//  re-parses counted per rule.
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <iostream>
+#include <string>
+
+namespace qi = boost::spirit::qi;
+
+typedef std::string::const_iterator iterator_type;
+
+struct calc : qi::grammar<iterator_type, qi::ascii::space_type>
+{
+    calc(qi::memo_table<iterator_type> const* table)
+      : calc::base_type(expr)
+    {
+        using qi::int_;
+        using qi::memoize;
+
+        if (table)
+        {
+            expr = memoize(*table)[term] >> '+' >> expr
+                |  memoize(*table)[term] >> '-' >> expr
+                |  memoize(*table)[term];
+            term = memoize(*table)[factor] >> '*' >> term
+                |  memoize(*table)[factor] >> '/' >> term
+                |  memoize(*table)[factor];
+        }
+        else
+        {
+            expr = term >> '+' >> expr | term >> '-' >> expr | term;
+            term = factor >> '*' >> term | factor >> '/' >> term | factor;
+        }
+        factor = int_ | '(' >> expr >> ')';
+
+        expr.name("expr");
+        term.name("term");
+        factor.name("factor");
+    }
+
+    qi::rule<iterator_type, qi::ascii::space_type> expr, term, factor;
+};
+
+// depth levels of parentheses around a few operations
+std::string make_input(int depth)
+{
+    std::string s = "1 + 2 * 3";
+    for (int i = 0; i < depth; ++i)
+        s = "(" + s + ") * " + char('1' + i % 9) + " - 4 / 5";
+    return s;
+}
+
+double measure(calc const& g, qi::memo_table<iterator_type>* table
+  , std::string const& in, int repeats)
+{
+    util::high_resolution_timer t;
+    for (int i = 0; i < repeats; ++i)
+    {
+        if (table)
+            table->clear();
+        iterator_type first = in.begin();
+        if (!qi::phrase_parse(first, in.end(), g, qi::ascii::space)
+          || first != in.end())
+        {
+            std::cout << "parse failed" << std::endl;
+        }
+    }
+    return t.elapsed() / repeats;
+}
+
+int main()
+{
+    qi::memo_table<iterator_type> table;
+    calc const plain(0);
+    calc const memoized(&table);
+
+    for (int depth = 2; depth <= 10; depth += 2)
+    {
+        std::string const in = make_input(depth);
+        std::cout << "depth " << depth << ", " << in.size() << " bytes: "
+            << "plain " << measure(plain, 0, in, 1000) << " [s], "
+            << "memoized " << measure(memoized, &table, in, 1000) << " [s]"
+            << std::endl;
+    }
+
+    // the statistics for the deepest input, without caching
+    qi::memo_table<iterator_type> counting(false);
+    calc const counted(&counting);
+    measure(counted, 0, make_input(10), 1);
+    counting.report(std::cout);
+    return 0;
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "real.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+//  shortest_real_policies, forcing the sign or the scientific notation
+template <typename T>
+struct signed_shortest_policy : boost::spirit::karma::shortest_real_policies<T>
+{
+    static bool force_sign(T) { return true; }
+};
+
+template <typename T>
+struct scientific_shortest_policy
+  : boost::spirit::karma::shortest_real_policies<T>
+{
+    typedef boost::spirit::karma::shortest_real_policies<T> base_type;
+    static int floatfield(T) { return base_type::fmtflags::scientific; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//  the generated string reads back as the value it was generated from
+template <typename T, typename Generator>
+bool round_trips(Generator const& g, T n)
+{
+    std::string s;
+    std::back_insert_iterator<std::string> sink(s);
+    if (!boost::spirit::karma::generate(sink, g, n))
+        return false;
+
+    // lexical_cast doesn't read the exponents without a sign
+    std::string::size_type e = s.find('e');
+    if (e != std::string::npos && s[e+1] != '-')
+        s.insert(e+1, "+");
+    return boost::lexical_cast<T>(s) == n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using namespace boost::spirit;
+
+#if !defined(BOOST_LCAST_NO_FAST_FLOAT)
+    {
+        using namespace boost::spirit::ascii;
+
+        typedef karma::real_generator<double
+          , karma::shortest_real_policies<double> > shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        BOOST_TEST(test("0.0", shortest, 0.0));
+        BOOST_TEST(test("0.0", shortest, -0.0));
+        BOOST_TEST(test("1.0", shortest, 1.0));
+        BOOST_TEST(test("-1.0", shortest, -1.0));
+        BOOST_TEST(test("0.1", shortest, 0.1));
+        BOOST_TEST(test("0.3", shortest, 0.3));
+        BOOST_TEST(test("0.30000000000000004", shortest, 0.1 + 0.2));
+        BOOST_TEST(test("0.3333333333333333", shortest, 1.0 / 3));
+        BOOST_TEST(test("123.456", shortest, 123.456));
+        BOOST_TEST(test("99999.5", shortest, 99999.5));
+        BOOST_TEST(test("0.00125", shortest, 0.00125));
+        BOOST_TEST(test("0.001", shortest, 0.001));
+        BOOST_TEST(test("1.0e05", shortest, 100000.0));
+        BOOST_TEST(test("1.2345678e07", shortest, 12345678.0));
+        BOOST_TEST(test("9.0e-04", shortest, 0.0009));
+        BOOST_TEST(test("1.5e300", shortest, 1.5e300));
+        BOOST_TEST(test("-2.5e-300", shortest, -2.5e-300));
+        BOOST_TEST(test("1.7976931348623157e308", shortest
+          , (std::numeric_limits<double>::max)()));
+        BOOST_TEST(test("2.2250738585072014e-308", shortest
+          , (std::numeric_limits<double>::min)()));
+        BOOST_TEST(test("5.0e-324", shortest
+          , std::numeric_limits<double>::denorm_min()));
+
+        BOOST_TEST(test("nan", shortest, std::numeric_limits<double>::quiet_NaN()));
+        BOOST_TEST(test("-inf", shortest, -std::numeric_limits<double>::infinity()));
+
+        // the directives and the generator properties still apply
+        BOOST_TEST(test("1.5E300", upper[shortest], 1.5e300));
+        BOOST_TEST(test("INF", upper[shortest], std::numeric_limits<double>::infinity()));
+        BOOST_TEST(test("  0.25", right_align(6)[shortest], 0.25));
+        BOOST_TEST(test("0.5", shortest(0.5)));
+        BOOST_TEST(!test("0.5", shortest(0.25)));
+
+        typedef karma::real_generator<double
+          , signed_shortest_policy<double> > signed_type;
+        signed_type const signed_ = signed_type();
+        BOOST_TEST(test("+0.1", signed_, 0.1));
+        BOOST_TEST(test("-0.1", signed_, -0.1));
+        BOOST_TEST(test(" 0.0", signed_, 0.0));
+
+        typedef karma::real_generator<double
+          , scientific_shortest_policy<double> > scientific_type;
+        scientific_type const scientific = scientific_type();
+        BOOST_TEST(test("0.0e00", scientific, 0.0));
+        BOOST_TEST(test("1.0e00", scientific, 1.0));
+        BOOST_TEST(test("1.25e-01", scientific, 0.125));
+        BOOST_TEST(test("1.2345e04", scientific, 12345.0));
+
+        // pseudo random bit patterns
+        boost::uint64_t bits = 0x0123456789abcdefULL;
+        for (int i = 0; i < 100000; ++i)
+        {
+            bits = bits * 6364136223846793005ULL + 1442695040888963407ULL;
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            if (!(boost::math::isfinite)(d))
+                continue;
+            if (!round_trips(shortest, d))
+            {
+                BOOST_ERROR("double doesn't round trip");
+                break;
+            }
+        }
+    }
+
+    {
+        typedef karma::real_generator<float
+          , karma::shortest_real_policies<float> > shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        BOOST_TEST(test("0.1", shortest, 0.1f));
+        BOOST_TEST(test("3.1415927", shortest, 3.14159265f));
+        BOOST_TEST(test("1.0e10", shortest, 1e10f));
+        BOOST_TEST(test("3.4028235e38", shortest, (std::numeric_limits<float>::max)()));
+
+        boost::uint32_t bits = 0x01234567;
+        for (int i = 0; i < 100000; ++i)
+        {
+            bits = bits * 1664525u + 1013904223u;
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            if (!(boost::math::isfinite)(f))
+                continue;
+            if (!round_trips(shortest, f))
+            {
+                BOOST_ERROR("float doesn't round trip");
+                break;
+            }
+        }
+    }
+
+#endif
+
+    {
+        // other types use the default conversion
+        typedef karma::real_generator<long double
+          , karma::shortest_real_policies<long double> > shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        BOOST_TEST(test("1.5", shortest, 1.5L));
+        BOOST_TEST(test("0.333", shortest, 1.0L / 3));
+    }
+
+    {
+        // integers are generated two digits at a time
+        BOOST_TEST(test("0", int_, 0));
+        BOOST_TEST(test("7", int_, 7));
+        BOOST_TEST(test("-42", int_, -42));
+        BOOST_TEST(test("100", int_, 100));
+        BOOST_TEST(test("12345", int_, 12345));
+        BOOST_TEST(test("-2147483648", int_
+          , (std::numeric_limits<int>::min)()));
+        BOOST_TEST(test("4294967295", uint_
+          , (std::numeric_limits<unsigned>::max)()));
+#ifdef BOOST_HAS_LONG_LONG
+        BOOST_TEST(test("-9223372036854775808", long_long
+          , (std::numeric_limits<boost::long_long_type>::min)()));
+        BOOST_TEST(test("18446744073709551615", ulong_long
+          , (std::numeric_limits<boost::ulong_long_type>::max)()));
+#endif
+        BOOST_TEST(test("255", ushort_, (unsigned short)255));
+        BOOST_TEST(test("ff", hex, 255));
+        BOOST_TEST(test("1.235e06", double_, 1234567.0));
+        BOOST_TEST(test("-12345.0", double_, -12345.0));
+    }
+
+    return boost::report_errors();
+}
@@ -40,5 +40,8 @@ int main(int argc, char* argv[])
 
     basic_ofstream<wchar_t> output_switch("test_switch.hpp");
     BOOST_TEST(lex::lexertl::generate_static_switch(lexer, output_switch, L"test_switch"));
+
+    basic_ofstream<wchar_t> output_scanner("test_scanner.hpp");
+    BOOST_TEST(lex::lexertl::generate_static_scanner(lexer, output_scanner, L"test_scanner"));
     return boost::report_errors();
 }
@@ -0,0 +1,43 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SCANNER_TOKENS_H_OCT_19_2013
+#define SCANNER_TOKENS_H_OCT_19_2013
+
+#include <boost/spirit/include/lex.hpp>
+
+// token definitions with keywords, some of which can be looked up by the
+// scanner generated by generate_static_scanner, and some which can't
+template <typename Lexer>
+struct scanner_tokens : boost::spirit::lex::lexer<Lexer>
+{
+    scanner_tokens()
+    {
+        this->self.add_pattern("WORD", "[a-zA-Z_][a-zA-Z0-9_]*");
+
+        this->self.add
+            ("if")("else")("while")("in")("int")("interface")("return")
+            ("_1")
+            ("{WORD}")          // matches all keywords above
+            ("late")            // never matched, the identifiers come first
+            ("[0-9]+")
+            ("0x")              // no other rule matches all of it
+            ("\\\"[^\\\"]*\\\"")
+            ("[ \\t\\n]+")
+            ("[-+*/=<>;(){}]")
+        ;
+
+        this->self("INITIAL", "COMMENT").add("\\/\\*");
+        this->self("COMMENT").add
+            ("if")              // a keyword of another lexer state
+            ("todo")("tado")    // differing in the middle only
+            ("[^*]+")
+            ("\\*")
+        ;
+        this->self("COMMENT", "INITIAL").add("\\*\\/");
+    }
+};
+
+#endif
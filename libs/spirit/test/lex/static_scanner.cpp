@@ -0,0 +1,126 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_static_lexertl.hpp>
+
+#include <string>
+#include <vector>
+
+#include "scanner_static.h"
+#include "scanner_tokens.h"
+
+namespace lex = boost::spirit::lex;
+
+typedef std::string::const_iterator base_iterator;
+typedef lex::lexertl::token<
+    base_iterator, boost::mpl::vector<>, boost::mpl::true_
+> token_type;
+
+struct token_info
+{
+    token_info(std::size_t id, std::size_t state, std::string const& value)
+      : id(id), state(state), value(value) {}
+
+    bool operator==(token_info const& rhs) const
+    {
+        return id == rhs.id && state == rhs.state && value == rhs.value;
+    }
+
+    std::size_t id;
+    std::size_t state;
+    std::string value;
+};
+
+template <typename Lexer>
+std::vector<token_info> tokenize(Lexer const& lexer, std::string const& input)
+{
+    std::vector<token_info> result;
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(token_info(it->id(), it->state()
+          , std::string(it->value().begin(), it->value().end())));
+    }
+    if (it != end)
+        result.push_back(token_info(0, 0, "<invalid>"));
+    return result;
+}
+
+// the scanner gives the same tokens as the dynamic lexer built from the
+// same definitions
+template <typename Dynamic, typename Static>
+bool same_tokens(Dynamic const& dynamic, Static const& static_
+  , std::string const& input)
+{
+    return tokenize(dynamic, input) == tokenize(static_, input);
+}
+
+std::size_t id_of(std::vector<token_info> const& tokens, std::size_t i)
+{
+    return i < tokens.size() ? tokens[i].id : 0;
+}
+
+int main()
+{
+    scanner_tokens<lex::lexertl::lexer<token_type> > dynamic;
+    scanner_tokens<lex::lexertl::static_lexer<
+        token_type, lex::lexertl::static_::lexer_scanner
+    > > static_;
+
+    {
+        std::string const input("if (interface) return int_1 + in;\n"
+            "while (late < 0x) { x = \"if else\"; }\n"
+            "/* if inside of a comment, if */ _1 else iff /*todo*/");
+        std::vector<token_info> tokens = tokenize(static_, input);
+        BOOST_TEST(tokens.size() == 49);
+        BOOST_TEST(tokenize(dynamic, input) == tokens);
+
+        // keywords, identifiers and keywords of the COMMENT state
+        std::vector<token_info> words = tokenize(static_
+          , "if iff late /*if*/if");
+        BOOST_TEST(words.size() == 10);
+        BOOST_TEST(id_of(words, 0) != id_of(words, 2));
+        BOOST_TEST(id_of(words, 2) == id_of(words, 4));
+        BOOST_TEST(id_of(words, 7) != id_of(words, 0));
+        BOOST_TEST(id_of(words, 7) != id_of(words, 2));
+        BOOST_TEST(id_of(words, 9) == id_of(words, 0));
+
+        words = tokenize(static_, "/*todo*//*tado*//*toto*/");
+        BOOST_TEST(words.size() == 9);
+        BOOST_TEST(id_of(words, 1) != id_of(words, 4));
+        BOOST_TEST(id_of(words, 1) != id_of(words, 7));
+        BOOST_TEST(id_of(words, 4) != id_of(words, 7));
+        BOOST_TEST(tokenize(dynamic, "/*todo*//*tado*//*toto*/") == words);
+    }
+
+    {
+        // words close to the keywords, in random order
+        char const* const words[] = {
+            "if", "i", "iff", "If", "else", "elsewhere", "in", "int", "int_",
+            "inter", "interface", "interfaces", "return", "_1", "_12", "late",
+            "0", "0x", "0x1", "42", "\"\"", "\"a b\"", " ", "\n", "\t", ";",
+            "+", "/", "*", "/*", "*/", "=", "{", "}", "x", "while", "whilst"
+        };
+        std::size_t const count = sizeof(words) / sizeof(words[0]);
+
+        std::string input;
+        unsigned int seed = 12345;
+        for (int i = 0; i < 20000; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            input += words[(seed >> 16) % count];
+        }
+        BOOST_TEST(same_tokens(dynamic, static_, input));
+
+        input += "@ if";
+        BOOST_TEST(same_tokens(dynamic, static_, input));
+    }
+
+    return boost::report_errors();
+}
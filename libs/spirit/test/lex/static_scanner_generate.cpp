@@ -0,0 +1,23 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_generate_static_lexertl.hpp>
+
+#include <fstream>
+
+#include "scanner_tokens.h"
+
+int main(int argc, char* argv[])
+{
+    typedef boost::spirit::lex::lexertl::lexer<> lexer_type;
+    scanner_tokens<lexer_type> tokens;
+
+    std::ofstream out(argc < 2 ? "scanner_static.h" : argv[1]);
+    BOOST_TEST(boost::spirit::lex::lexertl::generate_static_scanner(
+        tokens, out, "scanner"));
+    return boost::report_errors();
+}
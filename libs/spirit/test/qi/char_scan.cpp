@@ -0,0 +1,114 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_string.hpp>
+#include <boost/spirit/include/qi_directive.hpp>
+#include <boost/spirit/include/qi_parse.hpp>
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include "test.hpp"
+
+// runs of characters long enough to go through the vectorized scans,
+// with the mismatch at every position of a block
+std::string run(char ch, std::size_t n, char const* tail = "")
+{
+    return std::string(n, ch) + tail;
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::qi::parse;
+    using boost::spirit::qi::phrase_parse;
+    using boost::spirit::qi::lexeme;
+
+    {
+        using namespace boost::spirit::ascii;
+
+        for (std::size_t n = 1; n < 80; ++n)
+        {
+            std::string s = run('a', n, "1");
+            std::string attr;
+            BOOST_TEST(test_attr(s.c_str(), +alpha, attr, false));
+            BOOST_TEST(attr == std::string(n, 'a'));
+
+            s = run(' ', n, "x");
+            BOOST_TEST(test(s.c_str(), *space >> 'x'));
+            BOOST_TEST(test(s.c_str(), char_('x'), space));
+        }
+
+        std::string attr;
+        BOOST_TEST(test_attr("0123456789abcdefABCDEF0123456789xyz", +xdigit
+          , attr, false));
+        BOOST_TEST(attr == "0123456789abcdefABCDEF0123456789");
+
+        attr.clear();
+        BOOST_TEST(test_attr(" \t\r\n\v\f \t\r\n\v\f \t\r\n\v\f \t\r\n\v\f \t\r\nx"
+          , *space >> 'x', attr));
+        BOOST_TEST(attr == " \t\r\n\v\f \t\r\n\v\f \t\r\n\v\f \t\r\n\v\f \t\r\n");
+
+        BOOST_TEST(!test("", +digit));
+        BOOST_TEST(test("", *digit));
+        BOOST_TEST(!test("x123", +digit, false));
+        BOOST_TEST(test("x123", *digit, false));
+
+        // the character just past the ASCII ranges
+        BOOST_TEST(!test("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa{", +lower));
+        BOOST_TEST(!test("ZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZ[", +upper));
+        BOOST_TEST(!test("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\x7f", +print));
+        BOOST_TEST(!test("!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!! ", +graph));
+
+        // other char parsers and attributes
+        std::vector<char> v;
+        BOOST_TEST(test_attr("abcabcabcabcabcabcabcabcabcabcabcabcabcd", +char_("a-c")
+          , v, false));
+        BOOST_TEST(v.size() == 39);
+        BOOST_TEST(test("xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxy", *~char_('y') >> 'y'));
+        BOOST_TEST(test("  abc  def  ", +lexeme[+alpha], space));
+
+        // std::string and std::vector iterators
+        std::string const s = run('7', 100, " 42");
+        std::string::const_iterator f = s.begin();
+        BOOST_TEST(phrase_parse(f, s.end(), +lexeme[+digit], space));
+        BOOST_TEST(f == s.end());
+
+        std::vector<char> in(s.begin(), s.end());
+        std::vector<char>::iterator vf = in.begin();
+        BOOST_TEST(phrase_parse(vf, in.end(), lexeme[+digit] >> lexeme[+digit]
+          , space));
+        BOOST_TEST(vf == in.end());
+    }
+
+    {
+        // non-ASCII characters are classified by the encoding
+        using namespace boost::spirit::iso8859_1;
+        std::string s = run('a', 40, "\xe9\xe9") + run('b', 40, "1");
+        std::string attr;
+        BOOST_TEST(test_attr(s.c_str(), +alpha, attr, false));
+        BOOST_TEST(attr.size() == 82);
+
+        s = run(' ', 40, "\xa0 1");      // no-break space
+        BOOST_TEST(test(s.c_str(), +space >> '1'));
+    }
+
+    {
+        using namespace boost::spirit::standard;
+        std::string s = run('a', 40, "\xe9") + run('b', 40);
+        std::string attr;
+        BOOST_TEST(test_attr(s.c_str(), +alpha, attr, false));
+        BOOST_TEST(attr == run('a', 40));
+    }
+
+    return boost::report_errors();
+}
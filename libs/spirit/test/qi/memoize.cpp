@@ -0,0 +1,164 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/qi_directive.hpp>
+#include <boost/spirit/include/qi_char.hpp>
+#include <boost/spirit/include/qi_int.hpp>
+#include <boost/spirit/include/qi_operator.hpp>
+#include <boost/spirit/include/qi_nonterminal.hpp>
+#include <boost/spirit/include/qi_action.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+int count = 0;
+void counter() { ++count; }
+
+// each level of parentheses triples the work without memoization
+template <typename Iterator>
+struct calc : boost::spirit::qi::grammar<Iterator>
+{
+    calc(boost::spirit::qi::memo_table<Iterator> const* table)
+      : calc::base_type(expr)
+    {
+        using boost::spirit::qi::int_;
+        using boost::spirit::qi::memoize;
+
+        if (table)
+        {
+            expr = memoize(*table)[term] >> '+' >> expr
+                |  memoize(*table)[term] >> '-' >> expr
+                |  memoize(*table)[term];
+            term = memoize(*table)[factor] >> '*' >> term
+                |  memoize(*table)[factor] >> '/' >> term
+                |  memoize(*table)[factor];
+        }
+        else
+        {
+            expr = term >> '+' >> expr | term >> '-' >> expr | term;
+            term = factor >> '*' >> term | factor >> '/' >> term | factor;
+        }
+        factor = int_[&counter] | '(' >> expr >> ')';
+
+        expr.name("expr");
+        term.name("term");
+        factor.name("factor");
+    }
+
+    boost::spirit::qi::rule<Iterator> expr, term, factor;
+};
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::qi::memoize;
+    using boost::spirit::qi::memo_table;
+    using boost::spirit::qi::memo_statistics;
+    using boost::spirit::qi::hold;
+    using boost::spirit::qi::int_;
+    using boost::spirit::qi::rule;
+    using boost::spirit::ascii::alpha;
+
+    typedef char const* iterator_type;
+
+    {
+        memo_table<iterator_type> t;
+        int n = 0;
+        BOOST_TEST(test_attr("123", memoize(t)[int_], n));
+        BOOST_TEST(n == 123);
+        BOOST_TEST(t.size() == 1);
+        t.clear();
+        BOOST_TEST(t.size() == 0);
+
+        BOOST_TEST(test("abc", memoize(t)[+alpha]));
+        BOOST_TEST(!test("123", memoize(t)[+alpha]));
+    }
+
+    {
+        // the second alternative gets the attribute from the table
+        memo_table<iterator_type> t;
+        rule<iterator_type, std::string()> r;
+        r %= +alpha[&counter];
+        r.name("r");
+
+        count = 0;
+        std::string s;
+        BOOST_TEST(test_attr("abc2"
+          , hold[memoize(t)[r] >> '1'] | memoize(t)[r] >> '2', s));
+        BOOST_TEST(s == "abc");
+        BOOST_TEST(count == 3);
+
+        std::vector<memo_statistics> stats = t.statistics();
+        BOOST_TEST(stats.size() == 1);
+        BOOST_TEST(stats[0].name == "r");
+        BOOST_TEST(stats[0].calls == 2);
+        BOOST_TEST(stats[0].reparses == 1);
+
+        // failures are stored as well
+        t.clear();
+        count = 0;
+        BOOST_TEST(!test("123", memoize(t)[r] >> '1' | memoize(t)[r]));
+        BOOST_TEST(t.statistics()[0].reparses == 1);
+    }
+
+    {
+        // container attributes are appended to
+        memo_table<iterator_type> t;
+        rule<iterator_type, std::vector<int>()> list = int_ % ',';
+
+        std::vector<int> v;
+        BOOST_TEST(test_attr("1:2,3."
+          , hold[int_ >> ':' >> memoize(t)[list] >> ';']
+          | int_ >> ':' >> memoize(t)[list] >> '.', v));
+        BOOST_TEST(v.size() == 3 && v[0] == 1 && v[1] == 2 && v[2] == 3);
+        BOOST_TEST(t.statistics()[0].reparses == 1);
+    }
+
+    {
+        // the same results with and without memoization, in fewer steps
+        std::string const in = "((((((((1+2)*3)-4)/5)+6)*7)-8)/9)";
+
+        memo_table<iterator_type> t;
+        calc<iterator_type> memoized(&t);
+        calc<iterator_type> plain(0);
+
+        count = 0;
+        BOOST_TEST(test(in.c_str(), plain));
+        int const plain_count = count;
+
+        count = 0;
+        BOOST_TEST(test(in.c_str(), memoized));
+        BOOST_TEST(count == 9);
+        BOOST_TEST(count < plain_count);
+        t.clear();
+        BOOST_TEST(!test("((1+2)", memoized));
+
+        // without caching the parsers are invoked again, but the re-parses
+        // are counted
+        memo_table<iterator_type> counting(false);
+        calc<iterator_type> counted(&counting);
+
+        count = 0;
+        BOOST_TEST(test(in.c_str(), counted));
+        BOOST_TEST(count == plain_count);
+
+        std::vector<memo_statistics> stats = counting.statistics();
+        BOOST_TEST(stats.size() == 2);
+        BOOST_TEST(stats[0].name == "term" && stats[0].reparses > 0);
+        BOOST_TEST(stats[1].name == "factor" && stats[1].reparses > 0);
+
+        std::ostringstream out;
+        counting.report(out);
+        BOOST_TEST(out.str().find("factor: ") != std::string::npos);
+    }
+
+    return boost::report_errors();
+}
@@ -169,6 +169,9 @@ int main(int argc, char**const argv)
         test_find_all("^[^\n]*?Twain", twain);
         test_find_all("Tom|Sawyer|Huckleberry|Finn", twain);
         test_find_all("(Tom|Sawyer|Huckleberry|Finn).{0,30}river|river.{0,30}(Tom|Sawyer|Huckleberry|Finn)", twain);
+        test_find_all("[Hh]uck[[:alpha:]]*", twain);
+        test_find_all("\"[^\"\n]*\"", twain);
+        test_find_all("[!?]+\\s", twain);
 
         output_xml_results(false, "Moderate Searches", "short_twain_search.xml");
     }
@@ -185,6 +188,9 @@ int main(int argc, char**const argv)
         //time_posix = false;
         test_find_all("(Tom|Sawyer|Huckleberry|Finn).{0,30}river|river.{0,30}(Tom|Sawyer|Huckleberry|Finn)", twain);
         //time_posix = true;
+        test_find_all("[Hh]uck[[:alpha:]]*", twain);
+        test_find_all("\"[^\"\n]*\"", twain);
+        test_find_all("[!?]+\\s", twain);
 
         output_xml_results(false, "Long Searches", "long_twain_search.xml");
     }   
@@ -106,6 +106,15 @@ boost::xpressive::sregex rx19 =
     >> repeat<0,30>(_)
     >> (s2= as_xpr("Tom") | "Sawyer" | "Huckleberry" | "Finn" );
 
+char const * sz20 = "[Hh]uck[[:alpha:]]*";
+boost::xpressive::sregex rx20 = (set= 'H','h') >> "uck" >> *set[alpha];
+
+char const * sz21 = "\"[^\"\n]*\"";
+boost::xpressive::sregex rx21 = '"' >> *~(set= '"','\n') >> '"';
+
+char const * sz22 = "[!?]+\\s";
+boost::xpressive::sregex rx22 = +(set= '!','?') >> _s;
+
 std::map< std::string, sregex > rxmap;
 
 struct map_init
@@ -131,6 +140,9 @@ struct map_init
         rxmap[ sz17 ] = rx17;
         rxmap[ sz18 ] = rx18;
         rxmap[ sz19 ] = rx19;
+        rxmap[ sz20 ] = rx20;
+        rxmap[ sz21 ] = rx21;
+        rxmap[ sz22 ] = rx22;
     }
 };
 
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+// test_parallel_regex_search.cpp
+//
+//  Copyright 2008 Eric Niebler. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+#include <iterator>
+#include <boost/xpressive/xpressive.hpp>
+#include <boost/xpressive/parallel_regex_search.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::xpressive;
+
+///////////////////////////////////////////////////////////////////////////////
+// a log-like text, with empty lines and a last line without a newline
+std::string make_log(std::size_t lines)
+{
+    static char const *const words[] = {"INFO", "ERROR", "user", "bob@example", "42", "", "x"};
+    std::string log;
+    unsigned int seed = 7;
+    for(std::size_t i = 0; i != lines; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        std::size_t const n = (seed >> 16) % 6;
+        for(std::size_t j = 0; j != n; ++j)
+        {
+            seed = seed * 1103515245 + 12345;
+            log += words[(seed >> 16) % 7];
+            log += ' ';
+        }
+        log += '\n';
+    }
+    return log + "ERROR last";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// compare with the matches of a regex_iterator
+template<typename BidiIter>
+void check_matches(BidiIter begin, BidiIter end, basic_regex<BidiIter> const &rx, std::size_t chunk_size, unsigned int thread_count)
+{
+    std::vector<match_results<BidiIter> > matches;
+    parallel_regex_search(std::back_inserter(matches), begin, end, rx, chunk_size, thread_count);
+
+    regex_iterator<BidiIter> cur(begin, end, rx), last;
+    std::size_t i = 0;
+    for(; cur != last && i != matches.size(); ++cur, ++i)
+    {
+        BOOST_CHECK_EQUAL(cur->position(), matches[i].position());
+        BOOST_CHECK_EQUAL(cur->length(), matches[i].length());
+        BOOST_CHECK_EQUAL(cur->size(), matches[i].size());
+        BOOST_CHECK_EQUAL(cur->position(1), matches[i].position(1));
+        BOOST_CHECK(cur->prefix() == matches[i].prefix());
+        BOOST_CHECK(cur->suffix() == matches[i].suffix());
+    }
+    BOOST_CHECK(cur == last);
+    BOOST_CHECK_EQUAL(i, matches.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_chunks
+void test_chunks()
+{
+    std::string const log = make_log(2000);
+    char const *const patterns[] =
+    {
+        "ERROR"
+      , "\\d+"
+      , "^ERROR[^\\n]*$"
+      , "\\b(\\w+)@\\w+"
+      , "(?<=user )\\w+"
+      , "^$"
+      , "^"
+      , "x*"
+      , "\\w+\\n"
+      , "last\\z"
+    };
+
+    for(std::size_t p = 0; p != sizeof(patterns) / sizeof(*patterns); ++p)
+    {
+        sregex const rx = sregex::compile(patterns[p]);
+        check_matches(log.begin(), log.end(), rx, 1, 1);
+        check_matches(log.begin(), log.end(), rx, 100, 1);
+        check_matches(log.begin(), log.end(), rx, 100, 3);
+        check_matches(log.begin(), log.end(), rx, 1000, 4);
+        check_matches(log.begin(), log.end(), rx, 0, 0);
+
+        cregex const crx = cregex::compile(patterns[p]);
+        check_matches(log.c_str(), log.c_str() + log.size(), crx, 64, 2);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_edge_cases
+void test_edge_cases()
+{
+    std::string const empty;
+    std::vector<smatch> matches;
+
+    // a default-constructed regex matches nothing
+    parallel_regex_search(std::back_inserter(matches), empty.begin(), empty.end(), sregex(), 10, 2);
+    BOOST_CHECK(matches.empty());
+
+    parallel_regex_search(std::back_inserter(matches), empty, sregex::compile("a*"), 10, 2);
+    BOOST_REQUIRE_EQUAL(matches.size(), 1u);
+    BOOST_CHECK_EQUAL(matches[0].position(), 0);
+
+    // a single line longer than the chunks
+    std::string const line(1000, 'a');
+    matches.clear();
+    parallel_regex_search(std::back_inserter(matches), line, sregex::compile("a{300}"), 10, 4);
+    BOOST_CHECK_EQUAL(matches.size(), 3u);
+
+    // lines of newlines only
+    std::string const newlines(100, '\n');
+    check_matches(newlines.begin(), newlines.end(), sregex::compile("^"), 7, 3);
+    check_matches(newlines.begin(), newlines.end(), sregex::compile("$"), 7, 3);
+
+    // matches written to an output iterator as they are found
+    std::string const log = make_log(500);
+    std::vector<cmatch> cmatches;
+    cregex const rx = cregex::compile("\\d+");
+    parallel_regex_search(std::back_inserter(cmatches), log.c_str(), log.c_str() + log.size(), rx, 128, 2);
+    BOOST_REQUIRE(!cmatches.empty());
+    BOOST_CHECK_EQUAL(cmatches.back().str(), "42");
+    BOOST_CHECK_EQUAL(log.substr(cmatches.back().position(), 2), "42");
+}
+
+using namespace boost::unit_test;
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("test_parallel_regex_search");
+    test->add(BOOST_TEST_CASE(&test_chunks));
+    test->add(BOOST_TEST_CASE(&test_edge_cases));
+    return test;
+}
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+// test_peek_chars.cpp
+//
+//  Copyright 2008 Eric Niebler. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/xpressive/xpressive.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::xpressive;
+
+///////////////////////////////////////////////////////////////////////////////
+// a text of the characters the patterns look for, with runs longer than
+// the blocks searched at once
+std::string make_text(std::size_t size)
+{
+    static char const chars[] = "abqxyzuABQXYZ 0\n\r\f\xe9\xe9";
+    std::string text;
+    unsigned int seed = 11;
+    while(text.size() < size)
+    {
+        seed = seed * 1103515245 + 12345;
+        std::size_t const run = (seed >> 16) % 40;
+        seed = seed * 1103515245 + 12345;
+        char const ch = chars[(seed >> 16) % (sizeof(chars) - 1)];
+        text.append(0 == run % 3 ? run : 1, ch);
+        text += 'a';
+    }
+    return text;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the positions and lengths of all the matches
+template<typename BidiIter>
+std::vector<std::pair<long, long> > find_all(BidiIter begin, BidiIter end, char const *pattern)
+{
+    basic_regex<BidiIter> const rx = basic_regex<BidiIter>::compile(pattern);
+    std::vector<std::pair<long, long> > matches;
+    regex_iterator<BidiIter> cur(begin, end, rx), last;
+    for(; cur != last; ++cur)
+    {
+        matches.push_back(std::make_pair(static_cast<long>(cur->position()), static_cast<long>(cur->length())));
+    }
+    return matches;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_find_all
+//   the matches in contiguous input, which is searched with memchr, are the
+//   same as in a std::list, which is searched one character at a time
+void test_find_all()
+{
+    char const *const patterns[] =
+    {
+        "q"
+      , "[xyz]\\w*"
+      , "[xy][xy]"
+      , "(?i)q\\w"
+      , "(?i)[qx]"
+      , "ab|qa|Xa"
+      , "\xe9+a"
+      , "q+a\\w"
+      , "[xy]+a"
+      , "(?i)y+a"
+      , "z*q"
+      , "^\\w+"
+      , "^$"
+      , "^[^\\n]*Q"
+      , "\\d+"
+      , "[^a\\n]+"
+    };
+
+    for(std::size_t size = 0; size < 200; size += 13)
+    {
+        std::string const text = make_text(size);
+        std::list<char> const list(text.begin(), text.end());
+        for(std::size_t p = 0; p != sizeof(patterns) / sizeof(*patterns); ++p)
+        {
+            std::vector<std::pair<long, long> > const expected = find_all(list.begin(), list.end(), patterns[p]);
+            BOOST_CHECK(expected == find_all(text.begin(), text.end(), patterns[p]));
+            BOOST_CHECK(expected == find_all(text.c_str(), text.c_str() + text.size(), patterns[p]));
+        }
+    }
+
+    std::string const text = make_text(10000);
+    std::list<char> const list(text.begin(), text.end());
+    for(std::size_t p = 0; p != sizeof(patterns) / sizeof(*patterns); ++p)
+    {
+        std::vector<std::pair<long, long> > const expected = find_all(list.begin(), list.end(), patterns[p]);
+        BOOST_CHECK_MESSAGE(!expected.empty(), patterns[p]);
+        BOOST_CHECK(expected == find_all(text.begin(), text.end(), patterns[p]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_static_sets
+//
+void test_static_sets()
+{
+    std::string const text = make_text(5000);
+    sregex const rx = +(set= 'x','y') >> 'a';
+
+    std::size_t count = 0;
+    for(std::string::const_iterator cur = text.begin(); cur != text.end(); ++cur)
+    {
+        count += (('x' == *cur || 'y' == *cur) && 'a' == *(cur + 1)) ? 1 : 0;
+    }
+
+    BOOST_CHECK(0 != count);
+    BOOST_CHECK_EQUAL(count, static_cast<std::size_t>(std::distance(sregex_iterator(text.begin(), text.end(), rx), sregex_iterator())));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_partial_matches
+//
+void test_partial_matches()
+{
+    std::string const text = std::string(40, 'a') + "xy";
+    smatch what;
+
+    BOOST_REQUIRE(regex_search(text, what, sregex::compile("[xy]z"), regex_constants::match_partial));
+    BOOST_CHECK(!what[0].matched);
+    BOOST_CHECK_EQUAL(what[0].first - text.begin(), 41);
+
+    BOOST_REQUIRE(regex_search(text, what, sregex::compile("y+z"), regex_constants::match_partial));
+    BOOST_CHECK(!what[0].matched);
+    BOOST_CHECK_EQUAL(what[0].first - text.begin(), 41);
+
+    // an empty partial match at the end of the input
+    BOOST_REQUIRE(regex_search(text, what, sregex::compile("z+a"), regex_constants::match_partial));
+    BOOST_CHECK(!what[0].matched);
+    BOOST_CHECK(what[0].first == text.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// test_line_starts
+//
+void test_line_starts()
+{
+    std::string const text = std::string(20, 'a') + "\r" + std::string(20, 'b') + "\f\fc\n";
+    sregex const rx = sregex::compile("^.");
+    sregex_iterator cur(text.begin(), text.end(), rx), last;
+    BOOST_REQUIRE(cur != last);
+    BOOST_CHECK_EQUAL(cur->position(), 0);
+    BOOST_REQUIRE(++cur != last);
+    BOOST_CHECK_EQUAL(cur->position(), 21);
+    BOOST_REQUIRE(++cur != last);
+    BOOST_CHECK_EQUAL(cur->position(), 42);
+    BOOST_REQUIRE(++cur != last);
+    BOOST_CHECK_EQUAL(cur->position(), 43);
+    BOOST_CHECK(++cur == last);
+
+    // not at the beginning of a line when match_not_bol is set
+    BOOST_CHECK(!regex_search(text.substr(0, 20), sregex::compile("^a"), regex_constants::match_not_bol));
+}
+
+using namespace boost::unit_test;
+
+///////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("test_peek_chars");
+    test->add(BOOST_TEST_CASE(&test_find_all));
+    test->add(BOOST_TEST_CASE(&test_static_sets));
+    test->add(BOOST_TEST_CASE(&test_partial_matches));
+    test->add(BOOST_TEST_CASE(&test_line_starts));
+    return test;
+}